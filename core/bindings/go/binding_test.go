@@ -1,7 +1,14 @@
 package tree_sitter_objectscript_core_test
 
 import (
+	"bufio"
+	"context"
+	"errors"
+	"os"
+	"strconv"
+	"strings"
 	"testing"
+	"time"
 
 	tree_sitter "github.com/smacker/go-tree-sitter"
 	"github.com/intersystems/tree-sitter-objectscript/core"
@@ -13,3 +20,95 @@ func TestCanLoadGrammar(t *testing.T) {
 		t.Errorf("Error loading ObjectscriptCore grammar")
 	}
 }
+
+// Every case in test/pathological must finish or give up within its budget
+// plus the time between two polls of the clock by the parser
+const (
+	budget = 2 * time.Second
+	slack  = 500 * time.Millisecond
+)
+
+type pathologicalCase struct {
+	name   string
+	source []byte
+}
+
+func loadPathologicalCases(t *testing.T) []pathologicalCase {
+	file, err := os.Open("../../test/pathological/cases.tsv")
+	if err != nil {
+		t.Fatal(err)
+	}
+	defer file.Close()
+
+	unescape := strings.NewReplacer(`\\`, `\`, `\n`, "\n", `\t`, "\t")
+	var cases []pathologicalCase
+	scanner := bufio.NewScanner(file)
+	for scanner.Scan() {
+		line := scanner.Text()
+		if line == "" || strings.HasPrefix(line, "#") {
+			continue
+		}
+		fields := strings.Split(line, "\t")
+		if len(fields) != 5 {
+			t.Fatalf("bad case: %q", line)
+		}
+		count, err := strconv.Atoi(fields[1])
+		if err != nil {
+			t.Fatalf("bad count in %s: %v", fields[0], err)
+		}
+		source := unescape.Replace(fields[2]) +
+			strings.Repeat(unescape.Replace(fields[3]), count) +
+			unescape.Replace(fields[4])
+		cases = append(cases, pathologicalCase{fields[0], []byte(source)})
+	}
+	if err := scanner.Err(); err != nil {
+		t.Fatal(err)
+	}
+	return cases
+}
+
+func TestPathological(t *testing.T) {
+	for _, c := range loadPathologicalCases(t) {
+		t.Run(c.name, func(t *testing.T) {
+			t.Parallel()
+			ctx, cancel := context.WithTimeout(context.Background(), budget)
+			defer cancel()
+			start := time.Now()
+			tree, err := tree_sitter_objectscript_core.Parse(ctx, c.source)
+			elapsed := time.Since(start)
+			if err != nil && !errors.Is(err, context.DeadlineExceeded) {
+				t.Fatalf("unexpected error: %v", err)
+			}
+			if tree != nil {
+				tree.Close()
+			}
+			if elapsed > budget+slack {
+				t.Errorf("took %v, over the %v budget", elapsed, budget)
+			}
+		})
+	}
+}
+
+func TestCancel(t *testing.T) {
+	cases := loadPathologicalCases(t)
+	largest := cases[0]
+	for _, c := range cases {
+		if len(c.source) > len(largest.source) {
+			largest = c
+		}
+	}
+	ctx, cancel := context.WithCancel(context.Background())
+	time.AfterFunc(10*time.Millisecond, cancel)
+	start := time.Now()
+	tree, err := tree_sitter_objectscript_core.Parse(ctx, largest.source)
+	elapsed := time.Since(start)
+	if err != nil && !errors.Is(err, context.Canceled) {
+		t.Fatalf("unexpected error: %v", err)
+	}
+	if tree != nil {
+		tree.Close()
+	}
+	if elapsed > slack {
+		t.Errorf("took %v to return after being cancelled", elapsed)
+	}
+}
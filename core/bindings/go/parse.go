@@ -0,0 +1,40 @@
+package tree_sitter_objectscript_core
+
+import (
+	"context"
+	"time"
+
+	sitter "github.com/smacker/go-tree-sitter"
+)
+
+// Parse source with a deadline and cancellation taken from ctx.
+//
+// The parser polls for both as it goes, so a pathological input gives up
+// close to the deadline instead of holding the goroutine: the error is then
+// context.DeadlineExceeded, or context.Canceled if ctx was cancelled.
+func Parse(ctx context.Context, source []byte) (*sitter.Tree, error) {
+	if err := ctx.Err(); err != nil {
+		return nil, err
+	}
+	parser := sitter.NewParser()
+	defer parser.Close()
+	parser.SetLanguage(sitter.NewLanguage(Language()))
+
+	deadline, hasDeadline := ctx.Deadline()
+	if hasDeadline {
+		// At least a microsecond, 0 is no limit
+		parser.SetOperationLimit(int(max(time.Until(deadline).Microseconds(), 1)))
+	}
+	tree, err := parser.ParseCtx(ctx, nil, source)
+	if err == nil {
+		return tree, nil
+	}
+	if ctxErr := ctx.Err(); ctxErr != nil {
+		return nil, ctxErr
+	}
+	if hasDeadline && err == sitter.ErrOperationLimit {
+		// The parser's clock ran out just before the context's
+		return nil, context.DeadlineExceeded
+	}
+	return nil, err
+}
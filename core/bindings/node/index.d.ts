@@ -18,10 +18,65 @@ type NodeInfo =
       children: ChildNode[];
     });
 
+type Point = {
+  row: number;
+  column: number;
+};
+
+type ParseOptions = {
+  /** Include the S-expression of the tree (default true) */
+  sexp?: boolean;
+  /** Stop collecting errors after this many (default 100) */
+  maxErrors?: number;
+  /** Give up after this many microseconds, rejecting with code `ETIMEDOUT` */
+  timeoutMicros?: number;
+  /** Stop the parse when aborted, rejecting with an `AbortError` */
+  signal?: AbortSignal;
+};
+
+type BatchOptions = ParseOptions & {
+  /** Inputs parsed at the same time (default UV_THREADPOOL_SIZE or 4) */
+  concurrency?: number;
+};
+
+type ParseError = {
+  /** `ERROR`, or the type of the MISSING node */
+  type: string;
+  isMissing: boolean;
+  /** Offsets and columns are in bytes of the UTF-8 input */
+  startIndex: number;
+  endIndex: number;
+  startPosition: Point;
+  endPosition: Point;
+};
+
+type ParseResult = {
+  rootType: string;
+  hasError: boolean;
+  /** Milliseconds spent on the threadpool */
+  parseTime: number;
+  /** Same as `tree.rootNode.toString()`, unless `sexp: false` */
+  sexp?: string;
+  errors: ParseError[];
+};
+
 type Language = {
   name: string;
   language: unknown;
   nodeTypeInfo: NodeInfo[];
+  /** Highlights query with the `;; inherits` chain resolved */
+  HIGHLIGHTS_QUERY: string;
+  /** Injections query with the `;; inherits` chain resolved */
+  INJECTIONS_QUERY: string;
+  /** Locals query with the `;; inherits` chain resolved */
+  LOCALS_QUERY: string;
+  /** Parse on the libuv threadpool instead of blocking the event loop, to plain data, not a `Tree` */
+  parseAsync(input: string | Buffer, options?: ParseOptions): Promise<ParseResult>;
+  /** Parse many inputs on the libuv threadpool, `null` for those that timed out */
+  parseBatch(
+    inputs: (string | Buffer)[],
+    options?: BatchOptions,
+  ): Promise<(ParseResult | null)[]>;
 };
 
 declare const language: Language;
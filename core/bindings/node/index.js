@@ -5,3 +5,84 @@ module.exports = require("node-gyp-build")(root);
 try {
   module.exports.nodeTypeInfo = require("../../src/node-types.json");
 } catch (_) {}
+
+const nativeParseAsync = module.exports.parseAsync;
+
+/**
+ * Parse off the main thread.  With `timeoutMicros`, rejects with code
+ * `ETIMEDOUT` once the parse has taken that long; with `signal`, rejects with
+ * an `AbortError` once it is aborted.  Either way the threadpool slot is
+ * released right away.
+ */
+module.exports.parseAsync = function parseAsync(input, options = {}) {
+  const { signal, ...rest } = options;
+  if (!signal) return nativeParseAsync(input, rest);
+  if (signal.aborted) {
+    return Promise.reject(
+      Object.assign(new Error("Parsing was cancelled"), {
+        name: "AbortError",
+        code: "ABORT_ERR",
+      }),
+    );
+  }
+  // Polled by the parser on the threadpool
+  const cancellationFlag = new BigUint64Array(1);
+  const onAbort = () => {
+    Atomics.store(cancellationFlag, 0, 1n);
+  };
+  signal.addEventListener("abort", onAbort, { once: true });
+  return nativeParseAsync(input, { ...rest, cancellationFlag }).finally(() =>
+    signal.removeEventListener("abort", onAbort),
+  );
+};
+
+/**
+ * Parse many inputs off the main thread, at most `concurrency` at a time so
+ * that other users of the libuv threadpool (fs, dns, zlib) aren't starved.
+ * Results are in the order of `inputs`; an input that timed out is `null`.
+ * Aborting `signal` rejects the batch and stops the parses in progress.
+ */
+module.exports.parseBatch = async function parseBatch(inputs, options = {}) {
+  const concurrency = Math.max(
+    1,
+    options.concurrency ?? (Number(process.env.UV_THREADPOOL_SIZE) || 4),
+  );
+  const results = new Array(inputs.length);
+  let next = 0;
+  const worker = async () => {
+    while (next < inputs.length) {
+      const index = next++;
+      try {
+        results[index] = await module.exports.parseAsync(inputs[index], options);
+      } catch (error) {
+        if (error.code !== "ETIMEDOUT") throw error;
+        results[index] = null;
+      }
+    }
+  };
+  await Promise.all(
+    Array.from({ length: Math.min(concurrency, inputs.length) }, worker),
+  );
+  return results;
+};
+
+// The merged query bundles (see scripts/merge-queries.js), read on first use
+const queries = {
+  HIGHLIGHTS_QUERY: "highlights.scm",
+  INJECTIONS_QUERY: "injections.scm",
+  LOCALS_QUERY: "locals.scm",
+};
+for (const [name, file] of Object.entries(queries)) {
+  let query;
+  Object.defineProperty(module.exports, name, {
+    configurable: true,
+    enumerable: true,
+    get() {
+      query ??= require("fs").readFileSync(
+        require("path").join(root, "queries", "merged", file),
+        "utf8",
+      );
+      return query;
+    },
+  });
+}
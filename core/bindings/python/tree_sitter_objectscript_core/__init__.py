@@ -1,5 +1,141 @@
 "ObjectscriptCore grammar for tree-sitter"
 
+from concurrent.futures import CancelledError as _CancelledError
+from ctypes import addressof as _addressof, c_size_t as _c_size_t
+from importlib.resources import files as _files
+from os import PathLike as _PathLike, cpu_count as _cpu_count, fsencode as _fsencode
+from typing import Iterable, List, NamedTuple, Optional, Tuple, Union
+
 from ._binding import language
 
-__all__ = ["language"]
+
+class ParseSummary(NamedTuple):
+    """What parse_files() and parse_bytes_many() return for each input"""
+
+    #: None if the parse ran out of time, was cancelled or failed
+    root_type: Optional[str]
+    has_error: bool
+    node_count: int
+    error_count: int
+    #: ``(start_byte, end_byte, (row, column))`` of the first ``max_errors``
+    #: ERROR or MISSING nodes
+    errors: List[Tuple[int, int, Tuple[int, int]]]
+    #: The S-expression of the tree, if asked for
+    sexp: Optional[str]
+    #: Milliseconds spent parsing and summarizing
+    parse_time: float
+    #: The parse took longer than ``timeout`` and was given up
+    timed_out: bool = False
+
+
+class Cancellation:
+    """Stops a parse_files() or parse_bytes_many() call from another thread
+
+    The parsers in progress poll a flag owned by this object, and inputs that
+    haven't been started are skipped; the call then raises CancelledError.
+    """
+
+    def __init__(self):
+        self._flag = _c_size_t(0)
+
+    def cancel(self) -> None:
+        self._flag.value = 1
+
+    @property
+    def cancelled(self) -> bool:
+        return self._flag.value != 0
+
+
+def _parse_many(items, paths, threads, sexp, max_errors, timeout, cancel):
+    try:
+        from ._parallel import parse_many
+    except ImportError as error:
+        raise ImportError(
+            "batch parsing needs the _parallel extension, which is only built "
+            "when the tree-sitter library is found by pkg-config"
+        ) from error
+
+    if threads is None:
+        threads = _cpu_count() or 1
+    if timeout is not None and timeout <= 0:
+        raise ValueError("timeout must be positive")
+    timeout_micros = 0 if timeout is None else max(1, int(timeout * 1e6))
+    flag = None if cancel is None else _addressof(cancel._flag)
+    summaries = parse_many(items, paths, threads, sexp, max_errors, timeout_micros, flag)
+    if cancel is not None and cancel.cancelled:
+        raise _CancelledError()
+    return [ParseSummary(*summary) for summary in summaries]
+
+
+def parse_files(
+    paths: Iterable[Union[str, bytes, _PathLike]],
+    threads: Optional[int] = None,
+    *,
+    sexp: bool = False,
+    max_errors: int = 100,
+    timeout: Optional[float] = None,
+    cancel: Optional[Cancellation] = None,
+) -> List[ParseSummary]:
+    """Read and parse files on ``threads`` threads (default: one per core)
+    without holding the GIL, returning a summary per file in order
+
+    A file taking more than ``timeout`` seconds to parse is given up and its
+    summary has ``timed_out`` set."""
+    return _parse_many(
+        [_fsencode(path) for path in paths], True, threads, sexp, max_errors, timeout, cancel
+    )
+
+
+def parse_bytes_many(
+    sources: Iterable[bytes],
+    threads: Optional[int] = None,
+    *,
+    sexp: bool = False,
+    max_errors: int = 100,
+    timeout: Optional[float] = None,
+    cancel: Optional[Cancellation] = None,
+) -> List[ParseSummary]:
+    """Parse UTF-8 sources on ``threads`` threads (default: one per core)
+    without holding the GIL, returning a summary per source in order
+
+    A source taking more than ``timeout`` seconds to parse is given up and
+    its summary has ``timed_out`` set."""
+    return _parse_many(list(sources), False, threads, sexp, max_errors, timeout, cancel)
+
+
+
+def _get_query(name, file):
+    query = _files(f"{__package__}.queries") / "merged" / file
+    globals()[name] = query.read_text()
+    return globals()[name]
+
+
+def __getattr__(name):
+    # The merged query bundles (see scripts/merge-queries.js), read on first use
+    if name == "HIGHLIGHTS_QUERY":
+        return _get_query("HIGHLIGHTS_QUERY", "highlights.scm")
+    if name == "INJECTIONS_QUERY":
+        return _get_query("INJECTIONS_QUERY", "injections.scm")
+    if name == "LOCALS_QUERY":
+        return _get_query("LOCALS_QUERY", "locals.scm")
+
+    raise AttributeError(f"module {__name__!r} has no attribute {name!r}")
+
+
+__all__ = [
+    "language",
+    "parse_files",
+    "parse_bytes_many",
+    "ParseSummary",
+    "Cancellation",
+    "HIGHLIGHTS_QUERY",
+    "INJECTIONS_QUERY",
+    "LOCALS_QUERY",
+]
+
+
+def __dir__():
+    return sorted(__all__ + [
+        "__all__", "__builtins__", "__cached__", "__doc__", "__file__",
+        "__loader__", "__name__", "__package__", "__path__", "__spec__",
+    ])
@@ -1 +1,43 @@
+from os import PathLike
+from typing import Final, Iterable, List, NamedTuple, Optional, Tuple, Union
+
+HIGHLIGHTS_QUERY: Final[str]
+INJECTIONS_QUERY: Final[str]
+LOCALS_QUERY: Final[str]
+
+class ParseSummary(NamedTuple):
+    root_type: Optional[str]
+    has_error: bool
+    node_count: int
+    error_count: int
+    errors: List[Tuple[int, int, Tuple[int, int]]]
+    sexp: Optional[str]
+    parse_time: float
+    timed_out: bool = False
+
+class Cancellation:
+    def cancel(self) -> None: ...
+    @property
+    def cancelled(self) -> bool: ...
+
 def language() -> int: ...
+
+def parse_files(
+    paths: Iterable[Union[str, bytes, PathLike]],
+    threads: Optional[int] = None,
+    *,
+    sexp: bool = False,
+    max_errors: int = 100,
+    timeout: Optional[float] = None,
+    cancel: Optional[Cancellation] = None,
+) -> List[ParseSummary]: ...
+
+def parse_bytes_many(
+    sources: Iterable[bytes],
+    threads: Optional[int] = None,
+    *,
+    sexp: bool = False,
+    max_errors: int = 100,
+    timeout: Optional[float] = None,
+    cancel: Optional[Cancellation] = None,
+) -> List[ParseSummary]: ...
@@ -17,7 +17,10 @@
 //! [Parser]: https://docs.rs/tree-sitter/*/tree_sitter/struct.Parser.html
 //! [tree-sitter]: https://tree-sitter.github.io/
 
-use tree_sitter::Language;
+use std::sync::atomic::AtomicUsize;
+use std::time::Duration;
+
+use tree_sitter::{Language, Parser, Tree};
 
 extern "C" {
     fn tree_sitter_objectscript_core() -> Language;
@@ -35,15 +38,81 @@ pub fn language() -> Language {
 /// [`node-types.json`]: https://tree-sitter.github.io/tree-sitter/using-parsers#static-node-types
 pub const NODE_TYPES: &str = include_str!("../../src/node-types.json");
 
-// Uncomment these to include any queries that this grammar contains
+/// The highlights query, with the `;; inherits` chain already resolved.
+///
+/// Generated by `scripts/merge-queries.js`, so it can be compiled as is.
+pub const HIGHLIGHTS_QUERY: &str = include_str!("../../queries/merged/highlights.scm");
+
+/// The injections query, with the `;; inherits` chain already resolved.
+pub const INJECTIONS_QUERY: &str = include_str!("../../queries/merged/injections.scm");
+
+/// The locals query, with the `;; inherits` chain already resolved.
+pub const LOCALS_QUERY: &str = include_str!("../../queries/merged/locals.scm");
 
-// pub const HIGHLIGHTS_QUERY: &str = include_str!("../../queries/highlights.scm");
-// pub const INJECTIONS_QUERY: &str = include_str!("../../queries/injections.scm");
-// pub const LOCALS_QUERY: &str = include_str!("../../queries/locals.scm");
-// pub const TAGS_QUERY: &str = include_str!("../../queries/tags.scm");
+/// Parse `source` with `parser`, giving up after `timeout` or once `cancel`
+/// is set to a non-zero value from another thread.
+///
+/// Returns `None` if the parse was given up.  The parser polls both as it
+/// goes, so a pathological input costs about `timeout` at most; either way
+/// the parser is left without a limit and ready for the next input.
+pub fn parse_with_budget(
+    parser: &mut Parser,
+    source: &[u8],
+    timeout: Option<Duration>,
+    cancel: Option<&AtomicUsize>,
+) -> Option<Tree> {
+    // At least a microsecond, 0 is no limit
+    parser.set_timeout_micros(timeout.map_or(0, |timeout| (timeout.as_micros() as u64).max(1)));
+    // Safety: the flag is unset again before it goes out of scope
+    unsafe { parser.set_cancellation_flag(cancel) };
+    let tree = parser.parse(source, None);
+    parser.set_timeout_micros(0);
+    unsafe { parser.set_cancellation_flag(None) };
+    if tree.is_none() {
+        // Otherwise the next parse would resume this one
+        parser.reset();
+    }
+    tree
+}
 
 #[cfg(test)]
 mod tests {
+    use std::sync::atomic::{AtomicUsize, Ordering};
+    use std::time::{Duration, Instant};
+
+    // Every case in test/pathological must finish or give up within its
+    // budget plus the time between two polls of the clock by the parser
+    const BUDGET: Duration = Duration::from_secs(2);
+    const SLACK: Duration = Duration::from_millis(500);
+
+    fn pathological_cases() -> Vec<(&'static str, Vec<u8>)> {
+        let unescape = |field: &str| {
+            field
+                .replace("\\\\", "\0")
+                .replace("\\n", "\n")
+                .replace("\\t", "\t")
+                .replace('\0', "\\")
+        };
+        include_str!("../../test/pathological/cases.tsv")
+            .lines()
+            .filter(|line| !line.is_empty() && !line.starts_with('#'))
+            .map(|line| {
+                let fields: Vec<&str> = line.split('\t').collect();
+                assert_eq!(fields.len(), 5, "bad case: {line:?}");
+                let count: usize = fields[1].parse().expect("bad count");
+                let source =
+                    unescape(fields[2]) + &unescape(fields[3]).repeat(count) + &unescape(fields[4]);
+                (fields[0], source.into_bytes())
+            })
+            .collect()
+    }
+
+    fn new_parser() -> tree_sitter::Parser {
+        let mut parser = tree_sitter::Parser::new();
+        parser.set_language(&super::language()).unwrap();
+        parser
+    }
+
     #[test]
     fn test_can_load_grammar() {
         let mut parser = tree_sitter::Parser::new();
@@ -51,4 +120,46 @@ mod tests {
             .set_language(&super::language())
             .expect("Error loading ObjectscriptCore grammar");
     }
+
+    #[test]
+    fn test_can_compile_queries() {
+        for source in [super::HIGHLIGHTS_QUERY, super::INJECTIONS_QUERY, super::LOCALS_QUERY] {
+            tree_sitter::Query::new(&super::language(), source)
+                .expect("Error compiling ObjectscriptCore query");
+        }
+    }
+
+    #[test]
+    fn test_pathological_inputs_stay_within_budget() {
+        let mut parser = new_parser();
+        for (name, source) in pathological_cases() {
+            let start = Instant::now();
+            super::parse_with_budget(&mut parser, &source, Some(BUDGET), None);
+            let elapsed = start.elapsed();
+            assert!(elapsed <= BUDGET + SLACK, "{name} took {elapsed:?}");
+        }
+    }
+
+    #[test]
+    fn test_cancel_from_another_thread() {
+        let (name, source) = pathological_cases()
+            .into_iter()
+            .max_by_key(|(_, source)| source.len())
+            .unwrap();
+        let mut parser = new_parser();
+        let cancel = AtomicUsize::new(0);
+        std::thread::scope(|scope| {
+            scope.spawn(|| {
+                std::thread::sleep(Duration::from_millis(10));
+                cancel.store(1, Ordering::SeqCst);
+            });
+            let start = Instant::now();
+            super::parse_with_budget(&mut parser, &source, None, Some(&cancel));
+            let elapsed = start.elapsed();
+            assert!(elapsed <= SLACK, "{name} took {elapsed:?} to stop");
+        });
+
+        // The parser is usable again afterwards
+        assert!(super::parse_with_budget(&mut parser, b"", None, None).is_some());
+    }
 }
@@ -71,6 +71,13 @@ module.exports = grammar(objectscript_expr, {
     $._block_comment_inner,
     $.macro_value_line_with_continue,
     $.sentinel,
+    // The expr grammar's strings, see expr/src/scanner.h
+    $.string_literal,
+    $.json_string_literal,
+    // Legacy dotted DO blocks, see dotted_block
+    $._dotted_block_start,
+    $._dotted_line,
+    $._dotted_block_end,
   ],
   conflicts: ($, previous) =>
     previous.concat([
@@ -170,15 +177,21 @@ module.exports = grammar(objectscript_expr, {
         $.tag,
         $.tag_with_params,
         $.procedure,
-        $.dotted_statement,
       ),
 
-    dotted_statement: ($) =>
-      prec.right(10, seq(
-        repeat1('.'),
-        optional(token.immediate(/[ \t]+/)),
-        $.statement,
-      )),
+    // The lines under an argumentless DO that start with one more dot than
+    // the DO's line, the `block` of its command_do.  The scanner counts the
+    // dots at the start of each line (ObjectScript_Core_Scanner_lex_dots),
+    // so a block holds the statements of all its lines, and a deeper block
+    // is nested in the command_do of the DO that opens it.  Since the block
+    // tokens are only valid after a DO and inside a block, the scanner only
+    // reads whitespace for them there.
+    dotted_block: ($) =>
+      seq(
+        $._dotted_block_start,
+        repeat(choice($.statement, $._dotted_line)),
+        $._dotted_block_end,
+      ),
     pound_dim: ($) =>
       seq(
         field('preproc_keyword', $.keyword_dim),
@@ -401,8 +414,13 @@ module.exports = grammar(objectscript_expr, {
           $.keyword_do,
           repeat_with_commas($.do_parameter),
         ),
-        // Argumentless DO
-        build_command_rule_argumentless($, $.keyword_do),
+        // Argumentless DO, with the dotted block of the lines under it.  The
+        // block has to follow the DO at the end of its line, `do  write x`
+        // followed by dotted lines doesn't parse.
+        seq(
+          build_command_rule_argumentless($, $.keyword_do),
+          optional(field('block', $.dotted_block)),
+        ),
       ),
     keyword_do: (_) => /[dD]([oO])?/,
     do_parameter: ($) =>
@@ -1131,7 +1149,7 @@ module.exports = grammar(objectscript_expr, {
         $.keyword_zn,
         repeat_with_commas($.expression),
       ),
-    keyword_zn: (_) => /ZN(SPACE)/i,
+    keyword_zn: (_) => /ZN(SPACE)?/i,
 
     command_zsu: ($) =>
       choice(
@@ -0,0 +1,78 @@
+; Generated by scripts/merge-queries.js from core/queries/highlights.scm, do not edit
+(gvn) @variable.special
+(ssvn) @variable.special
+(lvn) @variable
+(instance_variable) @variable.special
+(string_literal) @string
+(pattern_expression) @string.regex
+(_ operator: _ @operator)
+(integer_literal) @number
+(decimal_literal) @float
+(system_defined_variable) @function.builtin
+(system_defined_function) @function.builtin
+(dollarsf
+  (dollar_system_keyword) @function.builtin
+)
+(property_name) @property
+(parameter_name) @constant
+(parameter_name) @variable.parameter
+(class_method_call
+    (class_ref (class_name) @type.definition)
+    (method_name) @function.method.call
+)
+(oref_method (method_name) @function.method.call)
+(_ preproc_keyword: (_) @keyword.directive)
+(_ modifier: (_) @keyword.directive)
+(extrinsic_function) @function.call
+(_ label: (_) @label)
+(_ offset: (_) @number)
+(_ routine: (_) @namespace)
+(json_boolean_literal) @boolean
+(json_null_literal) @constant.builtin
+(json_number_literal) @number
+(json_string_literal) @string.escape
+(macro (macro_constant)) @constant.macro
+(macro (macro_function)) @function.macro
+(_ command_name: (_) @keyword)
+(_ macro_name: (_) @keyword.macro)
+(_ macro_arg: (_) @constant.macro)
+(_ mnemonic: (_) @constant.macro)
+(_ parameter: _ @variable.parameter)
+(doable_dollar_functions) @function.builtin
+(routine_tag_call) @function.call
+(instance_method_call) @function.method.call
+"{" @punctuation.bracket
+"}" @punctuation.bracket
+[
+  (line_comment_1)
+  (line_comment_2)
+  (line_comment_3)
+  (block_comment)
+] @comment
+(embedded_html
+  (keyword_embedded_html) @keyword.directive
+  "<" @keyword.directive
+  ">" @keyword.directive
+)
+(embedded_sql_amp
+  (keyword_embedded_sql_amp) @keyword.directive
+  "(" @keyword.directive
+  ")" @keyword.directive
+)
+(embedded_sql_hash
+  (keyword_embedded_sql_hash) @keyword.directive
+  "(" @keyword.directive
+  ")" @keyword.directive
+)
+(embedded_js
+  (keyword_embedded_js) @keyword.directive
+  "<" @keyword.directive
+  ">" @keyword.directive
+)
+(embedded_xml
+  (keyword_embedded_xml) @keyword.directive
+  "<" @keyword.directive
+  ">" @keyword.directive
+)
+(tag) @label
+(locktype) @type.qualifier
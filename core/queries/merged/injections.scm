@@ -0,0 +1,26 @@
+; Generated by scripts/merge-queries.js from core/queries/injections.scm, do not edit
+(embedded_html
+ (angled_bracket_fenced_text) @injection.content
+ (#set! injection.language "html")
+)
+(embedded_sql
+  (_
+    (paren_fenced_text) @injection.content
+  )
+ (#set! injection.language "sql")
+)
+(embedded_js
+ (angled_bracket_fenced_text) @injection.content
+ (#set! injection.language "javascript")
+)
+(embedded_xml
+ (angled_bracket_fenced_text) @injection.content
+ (#set! injection.language "xml")
+)
+([
+  (line_comment_1)
+  (line_comment_2)
+  (line_comment_3)
+  (block_comment)
+] @injection.content
+  (#set! injection.language "comment"))
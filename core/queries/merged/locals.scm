@@ -0,0 +1 @@
+; Generated by scripts/merge-queries.js from core/queries/locals.scm, do not edit
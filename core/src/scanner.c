@@ -27,7 +27,14 @@ tree_sitter_objectscript_core_external_scanner_serialize(void *payload,
 
 void tree_sitter_objectscript_core_external_scanner_deserialize(
     void *payload, const char *buffer, unsigned length) {
-  memcpy(payload, buffer, length);
+  struct ObjectScript_Core_Scanner *scanner =
+      (struct ObjectScript_Core_Scanner *)payload;
+  // An empty state is the start of a parse, e.g. the parser's previous one
+  // was halted or its language was set again
+  ObjectScript_Core_Scanner_init(scanner);
+  if (length == sizeof(struct ObjectScript_Core_Scanner)) {
+    memcpy(scanner, buffer, length);
+  }
 }
 
 void tree_sitter_objectscript_core_external_scanner_destroy(void *payload) {
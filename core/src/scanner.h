@@ -1,7 +1,13 @@
+#include "expr_scanner.h"
 #include "tree_sitter/parser.h"
 #include <string.h>
 #include <wctype.h>
 
+// Thread safety: everything a scan reads or writes is either in the
+// ObjectScript_Core_Scanner of its own parser or a `static const` table, so
+// any number of parsers may share the language from different threads.  Keep
+// it that way: no mutable statics here or in the scanners that include this.
+
 enum ObjectScript_Core_Scanner_TokenType {
   _WHITESPACE_BEFORE_BLOCK,
   _IMMEDIATE_SINGLE_WHITESPACE_FOLLOWED_BY_NON_WHITESPACE,
@@ -17,11 +23,18 @@ enum ObjectScript_Core_Scanner_TokenType {
   _BLOCK_COMMENT_INNER,
   MACRO_VALUE_LINE_WITH_CONTINUE,
   SENTINEL,
+  // The expr grammar's, see expr/src/scanner.h
+  STRING_LITERAL,
+  JSON_STRING_LITERAL,
+  // Legacy dotted DO blocks, see ObjectScript_Core_Scanner_lex_dots()
+  _DOTTED_BLOCK_START,
+  _DOTTED_LINE,
+  _DOTTED_BLOCK_END,
   /* Max token type */
   OBJECTSCRIPT_CORE_TOKEN_TYPE_MAX
 };
 
-static const char* token_names[] = {
+static const char *const token_names[] = {
   "_WHITESPACE_BEFORE_BLOCK",
   "_IMMEDIATE_SINGLE_WHITESPACE_FOLLOWED_BY_NON_WHITESPACE",
   "_ASSERT_NO_SPACE_BETWEEN_RULES",
@@ -36,26 +49,29 @@ static const char* token_names[] = {
   "_BLOCK_COMMENT_INNER",
   "MACRO_VALUE_LINE_WITH_CONTINUE",
   "SENTINEL",
+  "STRING_LITERAL",
+  "JSON_STRING_LITERAL",
+  "_DOTTED_BLOCK_START",
+  "_DOTTED_LINE",
+  "_DOTTED_BLOCK_END",
 };
 
 #if 0
-static char* debug_enum(TSLexer *lexer, const bool *valid_symbols) {
-  static char work[1024];
+#include <stdio.h>
+
+// Writes the names of the valid symbols into `work`, which the caller owns
+static char* debug_enum(const bool *valid_symbols, char *work, size_t size) {
   size_t n = 0;
+  work[0] = 0;
 
-  for (int i = 0; i < OBJECTSCRIPT_CORE_TOKEN_TYPE_MAX + 1; i++) {
+  for (int i = 0; i < OBJECTSCRIPT_CORE_TOKEN_TYPE_MAX && n < size; i++) {
     if (valid_symbols[i]) {
-      if (n > 0) {
-        strncpy(&work[n], ", ", sizeof(work)-n);
-        n += strlen(&work[n]);
-      }
-      strncpy(&work[n], token_names[i], sizeof(work)-n);
-      n += strlen(&work[n]);
+      int written = snprintf(&work[n], size-n, "%s%s", n > 0 ? ", " : "", token_names[i]);
+      if (written < 0) break;
+      n += (size_t)written;
     }
   }
 
-  work[n] = 0;
-
   return work;
 }
 #endif
@@ -75,6 +91,7 @@ static inline void skip(TSLexer *lexer) {
 struct ObjectScript_Core_Scanner {
   int32_t marker_buffer[MARKER_BUFFER_MAX_LEN];
   char marker_buffer_len;
+  uint8_t dot_level;   // Of the innermost open dotted block, 0 outside
 };
 
 static bool ObjectScript_Core_Scanner_lex_fenced_text(
@@ -103,12 +120,87 @@ static inline void eat_whitespace(TSLexer *lexer) {
   }
 }
 
+static inline bool is_dotted_valid(const bool *valid_symbols) {
+  return valid_symbols[_DOTTED_BLOCK_START] || valid_symbols[_DOTTED_LINE] ||
+         valid_symbols[_DOTTED_BLOCK_END];
+}
+
+// Whitespace after an argumentless DO and between the statements of a
+// dotted block, the only places the block tokens are valid; everywhere else
+// the grammar stays blind to line breaks.  Legacy code nests blocks under
+// an argumentless DO by prefixing each of their lines with one dot per
+// level:
+//
+//    do
+//    . set x=1 do
+//    . . write x
+//    quit
+//
+// At the end of a line this counts the dots that start the next non blank
+// line, like INDENT and DEDENT in Python: one more than the open blocks
+// opens a block (the token takes the line break and the dots), as many
+// continues the block (the same), and fewer closes the innermost block
+// with an empty token at the end of the line, once per level.  Anything
+// else is plain _WHITESPACE, which is also what whitespace in the middle
+// of a line is.
+static bool ObjectScript_Core_Scanner_lex_dots(struct ObjectScript_Core_Scanner *scanner,
+                                               TSLexer *lexer, const bool *valid_symbols) {
+  bool moved = false;
+  while (iswspace(lexer->lookahead) && lexer->lookahead != '\n') {
+    advance(lexer);
+    moved = true;
+  }
+  lexer->mark_end(lexer);
+  if (!lexer->eof(lexer) && lexer->lookahead != '\n') {
+    lexer->result_symbol = _WHITESPACE;
+    return moved && valid_symbols[_WHITESPACE];
+  }
+
+  // The next non blank line's dots, `. .` is two
+  while (iswspace(lexer->lookahead)) {
+    advance(lexer);
+    moved = true;
+  }
+  uint32_t level = 0;
+  while (lexer->lookahead == '.') {
+    advance(lexer);
+    level++;
+    while (lexer->lookahead == ' ' || lexer->lookahead == '\t') advance(lexer);
+  }
+
+  if (level < scanner->dot_level && valid_symbols[_DOTTED_BLOCK_END]) {
+    // Nothing past the end of the line, the next scan looks again
+    scanner->dot_level--;
+    lexer->result_symbol = _DOTTED_BLOCK_END;
+    return true;
+  }
+  if (level > 0 && level == scanner->dot_level && valid_symbols[_DOTTED_LINE]) {
+    lexer->mark_end(lexer);
+    lexer->result_symbol = _DOTTED_LINE;
+    return true;
+  }
+  if (level > 0 && level == (uint32_t)scanner->dot_level + 1 && level <= UINT8_MAX &&
+      valid_symbols[_DOTTED_BLOCK_START]) {
+    lexer->mark_end(lexer);
+    scanner->dot_level++;
+    lexer->result_symbol = _DOTTED_BLOCK_START;
+    return true;
+  }
+  // Dots where no block can open or continue are an error for the parser
+  if (level > 0) return false;
+  lexer->mark_end(lexer);
+  lexer->result_symbol = _WHITESPACE;
+  return moved && valid_symbols[_WHITESPACE];
+}
+
 /// This is the interesting function. The rest is infrastructure
 static bool
 ObjectScript_Core_Scanner_scan(struct ObjectScript_Core_Scanner *scanner,
                                TSLexer *lexer, const bool *valid_symbols)
 {
-  // lexer->log(lexer, "scan: %c (%d): %s\n", lexer->lookahead, lexer->lookahead, debug_enum(lexer, valid_symbols));
+  // char work[1024];
+  // lexer->log(lexer, "scan: %c (%d): %s\n", lexer->lookahead, lexer->lookahead,
+  //            debug_enum(valid_symbols, work, sizeof(work)));
 
   // Tree sitter will mark all terminals as valid on error
   // The sentinel should never be valid in a good parse, so this ensures
@@ -119,6 +211,27 @@ ObjectScript_Core_Scanner_scan(struct ObjectScript_Core_Scanner *scanner,
     return false;
   }
 
+  // A string in one pass over its body, see expr/src/scanner.h
+  if (lexer->lookahead == '"' && !valid_symbols[_ASSERT_NO_SPACE_BETWEEN_RULES]) {
+    if (valid_symbols[STRING_LITERAL]) {
+      lexer->result_symbol = STRING_LITERAL;
+      return ObjectScript_Expr_Scanner_lex_string(lexer);
+    }
+    if (valid_symbols[JSON_STRING_LITERAL]) {
+      lexer->result_symbol = JSON_STRING_LITERAL;
+      return ObjectScript_Expr_Scanner_lex_json_string(lexer);
+    }
+  }
+
+  // After an argumentless DO or in a dotted block, unless a command still
+  // needs its whitespace
+  if ((iswspace(lexer->lookahead) || lexer->eof(lexer)) && is_dotted_valid(valid_symbols) &&
+      !valid_symbols[_IMMEDIATE_SINGLE_WHITESPACE_FOLLOWED_BY_NON_WHITESPACE] &&
+      !valid_symbols[_ARGUMENTLESS_COMMAND_END] && !valid_symbols[_WHITESPACE_BEFORE_BLOCK] &&
+      !valid_symbols[_ASSERT_NO_SPACE_BETWEEN_RULES]) {
+    return ObjectScript_Core_Scanner_lex_dots(scanner, lexer, valid_symbols);
+  }
+
   if (valid_symbols[_IMMEDIATE_SINGLE_WHITESPACE_FOLLOWED_BY_NON_WHITESPACE] ||
       valid_symbols[_ARGUMENTLESS_COMMAND_END] ||
       valid_symbols[_WHITESPACE_BEFORE_BLOCK]) {
@@ -142,7 +255,7 @@ ObjectScript_Core_Scanner_scan(struct ObjectScript_Core_Scanner *scanner,
     // Argumentless termination patterns which if we match, indicate that we have
     // an _ARGUMENTLESS_COMMAND_END
 #define _TERM_MAX  8
-    static const char* terminations[_TERM_MAX] = {
+    static const char *const terminations[_TERM_MAX] = {
       " ",    // space (for two spaces total)
       "\n",   // newline
       "\t",   // tab
@@ -412,6 +525,7 @@ ObjectScript_Core_Scanner_scan(struct ObjectScript_Core_Scanner *scanner,
   return false;
 }
 
-void ObjectScript_Core_Scanner_init(struct ObjectScript_Core_Scanner *scanner) {
+static void ObjectScript_Core_Scanner_init(struct ObjectScript_Core_Scanner *scanner) {
   scanner->marker_buffer_len = 0;
+  scanner->dot_level = 0;
 }
@@ -0,0 +1,70 @@
+"""Every case in test/pathological must finish or give up within its budget
+
+    pytest test/test_pathological.py
+
+Plus the time between two polls of the clock by the parser.  A parse
+cancelled from another thread must also return promptly.
+"""
+
+import re
+import threading
+import time
+from concurrent.futures import CancelledError
+from pathlib import Path
+
+import pytest
+
+import tree_sitter_objectscript_core as core
+
+BUDGET = 2.0
+SLACK = 0.5
+
+
+def unescape(field):
+    return re.sub(r"\\([\\nt])", lambda m: {"n": "\n", "t": "\t"}.get(m[1], m[1]), field)
+
+
+def load_cases():
+    cases = []
+    path = Path(__file__).parent / "pathological" / "cases.tsv"
+    for line in path.read_text().splitlines():
+        if not line or line.startswith("#"):
+            continue
+        name, count, prefix, repeat, suffix = line.split("\t")
+        source = unescape(prefix) + unescape(repeat) * int(count) + unescape(suffix)
+        cases.append(pytest.param(source.encode(), id=name))
+    return cases
+
+
+CASES = load_cases()
+
+
+@pytest.mark.parametrize("source", CASES)
+def test_within_budget(source):
+    start = time.perf_counter()
+    [summary] = core.parse_bytes_many([source], 1, timeout=BUDGET)
+    elapsed = time.perf_counter() - start
+    assert summary.timed_out == (summary.root_type is None)
+    assert elapsed <= BUDGET + SLACK
+
+
+def test_batch_within_budget():
+    sources = [case.values[0] for case in CASES]
+    start = time.perf_counter()
+    summaries = core.parse_bytes_many(sources, timeout=BUDGET)
+    elapsed = time.perf_counter() - start
+    assert len(summaries) == len(sources)
+    # Every thread gives up on its input in time, so the batch takes no
+    # longer than each thread's share of the inputs
+    assert elapsed <= (BUDGET + SLACK) * len(sources)
+
+
+def test_cancel_from_another_thread():
+    largest = max((case.values[0] for case in CASES), key=len)
+    cancel = core.Cancellation()
+    threading.Timer(0.01, cancel.cancel).start()
+    start = time.perf_counter()
+    with pytest.raises(CancelledError):
+        # Parses the largest input over and over, so there's one in progress
+        core.parse_bytes_many([largest] * 1000, 1, cancel=cancel)
+    assert time.perf_counter() - start <= SLACK
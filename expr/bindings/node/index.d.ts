@@ -22,6 +22,12 @@ type Language = {
   name: string;
   language: unknown;
   nodeTypeInfo: NodeInfo[];
+  /** Highlights query with the `;; inherits` chain resolved */
+  HIGHLIGHTS_QUERY: string;
+  /** Injections query with the `;; inherits` chain resolved */
+  INJECTIONS_QUERY: string;
+  /** Locals query with the `;; inherits` chain resolved */
+  LOCALS_QUERY: string;
 };
 
 declare const language: Language;
@@ -5,3 +5,24 @@ module.exports = require("node-gyp-build")(root);
 try {
   module.exports.nodeTypeInfo = require("../../src/node-types.json");
 } catch (_) {}
+
+// The merged query bundles (see scripts/merge-queries.js), read on first use
+const queries = {
+  HIGHLIGHTS_QUERY: "highlights.scm",
+  INJECTIONS_QUERY: "injections.scm",
+  LOCALS_QUERY: "locals.scm",
+};
+for (const [name, file] of Object.entries(queries)) {
+  let query;
+  Object.defineProperty(module.exports, name, {
+    configurable: true,
+    enumerable: true,
+    get() {
+      query ??= require("fs").readFileSync(
+        require("path").join(root, "queries", "merged", file),
+        "utf8",
+      );
+      return query;
+    },
+  });
+}
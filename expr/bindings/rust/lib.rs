@@ -35,12 +35,16 @@ pub fn language() -> Language {
 /// [`node-types.json`]: https://tree-sitter.github.io/tree-sitter/using-parsers#static-node-types
 pub const NODE_TYPES: &str = include_str!("../../src/node-types.json");
 
-// Uncomment these to include any queries that this grammar contains
+/// The highlights query, with the `;; inherits` chain already resolved.
+///
+/// Generated by `scripts/merge-queries.js`, so it can be compiled as is.
+pub const HIGHLIGHTS_QUERY: &str = include_str!("../../queries/merged/highlights.scm");
+
+/// The injections query, with the `;; inherits` chain already resolved.
+pub const INJECTIONS_QUERY: &str = include_str!("../../queries/merged/injections.scm");
 
-// pub const HIGHLIGHTS_QUERY: &str = include_str!("../../queries/highlights.scm");
-// pub const INJECTIONS_QUERY: &str = include_str!("../../queries/injections.scm");
-// pub const LOCALS_QUERY: &str = include_str!("../../queries/locals.scm");
-// pub const TAGS_QUERY: &str = include_str!("../../queries/tags.scm");
+/// The locals query, with the `;; inherits` chain already resolved.
+pub const LOCALS_QUERY: &str = include_str!("../../queries/merged/locals.scm");
 
 #[cfg(test)]
 mod tests {
@@ -51,4 +55,12 @@ mod tests {
             .set_language(&super::language())
             .expect("Error loading ObjectscriptExpr grammar");
     }
+
+    #[test]
+    fn test_can_compile_queries() {
+        for source in [super::HIGHLIGHTS_QUERY, super::INJECTIONS_QUERY, super::LOCALS_QUERY] {
+            tree_sitter::Query::new(&super::language(), source)
+                .expect("Error compiling ObjectscriptExpr query");
+        }
+    }
 }
@@ -19,6 +19,13 @@ const repeat_with_commas = function (rule) {
 
 module.exports = grammar({
   name: 'objectscript_expr',
+  // Strings are lexed by the scanner (src/scanner.h) in one pass over their
+  // body, their rules below are the fallback.  Grammars that replace these
+  // externals must list both, see core/grammar.js.
+  externals: ($) => [
+    $.string_literal,
+    $.json_string_literal,
+  ],
   precedences: ($) => [
     [$.oref_method, $.oref_property],
     [$.method_arg, $.subscripts],
@@ -43,6 +50,11 @@ module.exports = grammar({
   ],
   rules: {
     source_file: ($) => $.expression, // expr grammar is for expressions only
+
+    // ObjectScript has no operator precedence: a_b+c*d is evaluated strictly
+    // left to right.  So an expression is a flat sequence of operands and
+    // operators, which keeps the tree's depth the same however long the
+    // chain is, instead of nesting an expression per operator.
     expression: ($) =>
       prec.left(
         seq(
@@ -96,16 +108,17 @@ module.exports = grammar({
         choice(
           seq(
             field('operator', $.binary_operator),
-            $.expression,
+            $.expr_atom,
           ),
           $._pattern_operator,
         ),
       ),
 
     _parenthetical_expression: ($) => seq('(', $.expression, ')'),
+    // Unary operators apply to the operand that follows: -a_b is (-a)_b
     unary_expression: ($) =>
       choice(
-        seq(field('operator', $._unary_operator), $.expression),
+        seq(field('operator', $._unary_operator), $.expr_atom),
         seq(field('operator', '@'), $.glvn),
       ),
     _unary_operator: (_) => choice('+', '-', "'"),
@@ -302,7 +315,8 @@ module.exports = grammar({
         ),
         $.method_args,
       ),
-    dollar_system_keyword: (_) => /\$SYSTEM/i,
+    // Ahead of the `$SYSTEM` (`$SY`) system_defined_variable
+    dollar_system_keyword: (_) => token(prec(1, /\$SYSTEM/i)),
 
     method_args: ($) =>
       seq(
@@ -512,54 +526,12 @@ module.exports = grammar({
         $.oref_parameter,
       ),
 
-    system_defined_variable: (_) =>
-      choice(
-        /\$D(EVICE)?/i, // $DEVICE
-        /\$EC(ODE)?/i, // $ECODE
-        /\$ES(TACK)?/i, // $ESTACK
-        /\$ET(RAP)?/i, // $ETRAP
-        /\$HALT/i, // $HALT
-        /\$H(OROLOG)?/i, // $HOROLOG
-        /\$I(O)?/i, // $IO
-        /\$J(OB)?/i, // $JOB
-        /\$K(EY)?/i, // $KEY
-        /\$NAMESPACE/i, // $NAMESPACE
-        /\$P(RINCIPAL)?/i, // $P[RINCIPAL] conflicts with $P[IECE]
-        /\$Q(UIT)?/i, // $QUIT
-        /\$ROLES/i, // $ROLES
-        /\$ST(ACK)?/i, // $STACK conflits with $STACK()
-        /\$S(TORAGE)?/i, // $S[TORAGE] conflicts with $S[ELECT]
-        /\$SY(STEM)?/i, // $SYSTEM
-        /\$T(EST)?/i, // $TEST
-        /\$THIS/i, // $THIS
-        /\$THROWOBJ/i, // $THROWOBJ
-        /\$TL(EVEL)?/i, // $TLEVEL
-        /\$USERNAME/i, // $USERNAME
-        /\$X/i, // $X
-        /\$Y/i, // $Y
-        /\$ZA/i, // $ZA
-        /\$ZB/i, // $ZB
-        /\$ZC(HILD)?/i, // $ZCHILD
-        /\$ZEOF/i, // $ZEOF
-        /\$ZEOS/i, // $ZEOS
-        /\$ZE(RROR)?/i, // $ZERROR
-        /\$ZH(OROLOG)?/i, // $ZHOROLOG
-        /\$ZI(O)?/i, // $ZIO
-        /\$ZJ(OB)?/i, // $ZJOB
-        /\$ZM(ODE)?/i, // $ZMODE
-        /\$ZN(AME)?/i, // $ZNAME
-        /\$ZNSPACE/i, // $ZNSPACE
-        /\$ZO(RDER)?/i, // $ZORDER
-        /\$ZP(ARENT)?/i, // $ZPARENT
-        /\$ZPI/i, // $ZPI
-        /\$ZPOS(ITION)?/i, // $ZPOSITION
-        /\$ZR(EFERENCE)?/i, // $ZREFERENCE
-        /\$ZS(TORAGE)?/i, // $ZSTORAGE
-        choice(/\$ZTIMESTAMP/i, /\$ZTS/i), // $ZTIMESTAMP
-        choice(/\$ZTIMEZONE/i, /\$ZTZ/i), // $ZTIMEZONE
-        /\$ZT(RAP)?/i, // $ZTRAP
-        /\$ZV(ERSION)?/i, // $ZVERSION
-      ),
+    // Any `$name`, the names themselves are listed in expr/system-names.js.
+    // One token instead of an alternation of every spelling keeps them out
+    // of the lexer; hosts that need to know which variable it is (or that
+    // it is one at all) classify it with the perfect hash table generated
+    // into tools/src/system_names.c.
+    system_defined_variable: (_) => /\$[A-Za-z][A-Za-z0-9]*/,
     system_defined_function: ($) =>
       choice(
         // NOTE: Make sure you add any new rules here to the inline key at top of the file
@@ -573,163 +545,23 @@ module.exports = grammar({
         $.dollar_classmethod,
         $.dollar_function,    // Fallback case
       ),
+    // Any `$name(`, classified the same way as system_defined_variable.
+    // The functions with their own rules above win over this by precedence.
     dollar_function: ($) =>
       seq(
-        token(
-          seq(
-            field(
-              'function_name',
-              choice(
-                /\$BIT/i,
-                /\$D(ATA)?/i,
-                choice(/\$LISTSAME/i, /\$LS/i),
-                /\$MATCH/i,
-                /\$NORMALIZE/i,
-                /\$QS(UBSCRIPT)?/i,
-                /\$ZBITAND/i,
-                /\$ZBITCOUNT/i,
-                /\$ZPOWER/i,
-                /\$BITCOUNT/i,
-                /\$BITFIND/i,
-                /\$C(HAR)?/i,
-                /\$WC(HAR)?/i,
-                /\$ZF/i,
-                /\$ZU(TIL)?/i,
-                /\$XECUTE/i,
-                /\$A(SCII)?/i,
-                /\$BITLOGIC/i,
-                /\$DECIMAL/i,
-                /\$FACTOR/i,
-                /\$G(ET)?/i,
-                /\$L(ENGTH)?/i,
-                /\$NA(ME)?/i,
-                /\$ST(ACK)?/i,
-                /\$WA(SCII)?/i,
-                /\$ZDA(SCII)?/i,
-                /\$ZLA(SCII)?/i,
-                /\$ZQA(SCII)?/i,
-                /\$ZSEEK/i,
-                /\$ZWA(SCII)?/i,
-                /\$ZWIDTH/i,
-                /\$CLASSNAME/i,
-                /\$NOW/i,
-                /\$COMPILE/i,
-                /\$DOUBLE/i,
-                /\$ISOBJECT/i,
-                /\$ISVECTOR/i,
-                choice(/\$LISTLENGTH/i, /\$LL/i),
-                choice(/\$LISTVALID/i, /\$LV/i),
-                /\$QL(ENGTH)?/i,
-                /\$RE(VERSE)?/i,
-                /\$T(EXT)?/i,
-                /\$WISWIDE/i,
-                /\$WL(ENGTH)?/i,
-                /\$WRE(VERSE)?/i,
-                /\$WF(IND)?/i,
-                /\$ZABS/i,
-                /\$ZARCCOS/i,
-                /\$ZARCSIN/i,
-                /\$ZARCTAN/i,
-                /\$ZCOS/i,
-                /\$ZCOT/i,
-                /\$ZCSC/i,
-                /\$ZC(YC)?/i,
-                /\$ZDC(HAR)?/i,
-                /\$ZEXP/i,
-                /\$ZH(EX)?/i,
-                /\$ZISWIDE/i,
-                /\$ZLC(HAR)?/i,
-                /\$ZLN/i,
-                /\$ZLOG/i,
-                /\$ZQC(HAR)?/i,
-                /\$ZSE(ARCH)?/i,
-                /\$ZSEC/i,
-                /\$ZSIN/i,
-                /\$ZSQR/i,
-                /\$ZTAN/i,
-                /\$ZVERSION/i,
-                /\$ZWC(HAR)?/i,
-                /\$ZWPACK/i,
-                /\$ZWBPACK/i,
-                /\$ZWUNPACK/i,
-                /\$ZWBUNPACK/i,
-                /\$F(IND)?/i,
-                /\$IN(UMBER)?/i,
-                /\$J(USTIFY)?/i,
-                /\$NC(ONVERT)?/i,
-                /\$VE(CTOR)?/i,
-                choice(/\$VECTORDEFINED/i, /\$VD/i),
-                choice(/\$VECTOROP/i, /\$VOP/i),
-                /\$TR(ANSLATE)?/i,
-                /\$ZCRC/i,
-                /\$ZPOSITION/i,
-                /\$FN(UMBER)?/i,
-                choice(/\$LISTDATA/i, /\$LD/i),
-                choice(/\$LISTFROMSTRING/i, /\$LFS/i),
-                choice(/\$LISTTOSTRING/i, /\$LTS/i),
-                /\$V(IEW)?/i,
-                /\$ZNAME/i,
-                choice(/\$ZTIMEH/i, /\$ZTH/i),
-                /\$ZZENKAKU/i,
-                /\$I(NCREMENT)?/i,
-                /\$ISVALIDDOUBLE/i,
-                /\$ISVALIDNUM/i,
-                /\$ZT(IME)?/i,
-                choice(/\$LISTBUILD/i, /\$LB/i),
-                /\$LISTNEXT/i,
-                choice(/\$LISTFIND/i, /\$LF/i),
-                /\$ZB(OOLEAN)?/i,
-                choice(/\$LISTUPDATE/i, /\$LU/i),
-                /\$LOCATE/i,
-                /\$METHOD/i,
-                /\$NUM(BER)?/i,
-                /\$PREPROCESS/i,
-                /\$O(RDER)?/i,
-                /\$PARAMETER/i,
-                /\$PREFETCHOFF/i,
-                /\$PREFETCHON/i,
-                /\$PROPERTY/i,
-                /\$Q(UERY)?/i,
-                /\$R(ANDOM)?/i,
-                /\$SEQ(UENCE)?/i,
-                /\$REPLACE/i,
-                /\$SC(ONVERT)?/i,
-                choice(/\$ZCONVERT/i, /\$ZCVT/i),
-                /\$ZSTRIP/i,
-                /\$SORTBEGIN/i,
-                /\$SORTEND/i,
-                /\$ZD(ATE)?/i,
-                choice(/\$ZDATEH/i, /\$ZDH/i),
-                choice(/\$ZDATETIME/i, /\$ZDT/i),
-                choice(/\$ZDATETIMEH/i, /\$ZDTH/i),
-                /\$ZBITFIND/i,
-                /\$ZBITGET/i,
-                /\$ZBITLEN/i,
-                /\$ZBITNOT/i,
-                /\$ZBITOR/i,
-                /\$ZBITSET/i,
-                /\$ZBITSTR/i,
-                /\$ZBITXOR/i,
-                /\$ZOBJCLASS/i,
-                /\$ZOBJPROPERTY/i,
-                /\$ZV(ERSION)?/i, // $ZVERSION
-              ),
-            ),
-            token.immediate('('),
-          ),
-        ),
+        token(seq(field('function_name', /\$[A-Za-z][A-Za-z0-9]*/), token.immediate('('))),
         optional(repeat_with_commas($.expression)),
         ')',
       ),
     dollar_select: ($) =>
       seq(
-        token(seq(field('name', /\$S(ELECT)?/i), token.immediate('('))),
+        token(prec(1, seq(field('name', /\$S(ELECT)?/i), token.immediate('(')))),
         repeat_with_commas(seq(field('case', $.dollar_arg_pair))),
         ')',
       ),
     dollar_case: ($) =>
       seq(
-        token(seq(field('name', /\$CASE/i), token.immediate('('))),
+        token(prec(1, seq(field('name', /\$CASE/i), token.immediate('(')))),
         field('target', $.expression),
         choice(
           seq(
@@ -766,8 +598,9 @@ module.exports = grammar({
 
     dollar_piece: ($) =>
       seq(
-        // NOTE: `$P(` must be one token to avoid ambiguity with $P[RINCIPAL]
-        token(seq(field('function_name', /\$P(IECE)?/i), token.immediate('('))),
+        // NOTE: `$P(` must be one token to avoid ambiguity with $P[RINCIPAL].
+        //       These function tokens all have precedence over dollar_function.
+        token(prec(1, seq(field('function_name', /\$P(IECE)?/i), token.immediate('(')))),
         $.expression,
         ',',
         $.expression,
@@ -786,7 +619,10 @@ module.exports = grammar({
       ),
     dollar_extract: ($) =>
       seq(
-        token(seq(field('function_name', choice(/\$E(XTRACT)?/i, /\$WE(XTRACT)?/i)), token.immediate('('))),
+        token(prec(1, seq(
+          field('function_name', choice(/\$E(XTRACT)?/i, /\$WE(XTRACT)?/i)),
+          token.immediate('('),
+        ))),
         $.expression,
         optional(
           seq(',', $.dollar_func_pos, optional(seq(',', $.dollar_func_pos))),
@@ -795,7 +631,7 @@ module.exports = grammar({
       ),
     dollar_list: ($) =>
       seq(
-        token(seq(field('function_name', /\$LI(ST)?/i), token.immediate('('))),
+        token(prec(1, seq(field('function_name', /\$LI(ST)?/i), token.immediate('(')))),
         $.expression,
         optional(
           seq(
@@ -808,10 +644,10 @@ module.exports = grammar({
     dollar_listget: ($) =>
       seq(
         token(
-          seq(
+          prec(1, seq(
             field('function_name', choice(/\$LISTGET/i, /\$LG/i)),
             token.immediate('('),
-          ),
+          )),
         ),
         $.expression,
         optional(
@@ -826,7 +662,7 @@ module.exports = grammar({
     dollar_classmethod: ($) =>
       seq(
         token(
-          seq(field('function_name', /\$(ZOBJ)?CLASSMETHOD/i), token.immediate('(')),
+          prec(1, seq(field('function_name', /\$(ZOBJ)?CLASSMETHOD/i), token.immediate('('))),
         ),
         optional($.expression),
         ',',
@@ -837,7 +673,7 @@ module.exports = grammar({
     dollar_method: ($) =>
       seq(
         token(
-          seq(field('function_name', /\$(ZOBJ)?METHOD/i), token.immediate('(')),
+          prec(1, seq(field('function_name', /\$(ZOBJ)?METHOD/i), token.immediate('('))),
         ),
         optional($.expression),
         ',',
@@ -0,0 +1,35 @@
+; Generated by scripts/merge-queries.js from expr/queries/highlights.scm, do not edit
+(gvn) @variable.special
+(ssvn) @variable.special
+(lvn) @variable
+(instance_variable) @variable.special
+(string_literal) @string
+(pattern_expression) @string.regex
+(_ operator: _ @operator)
+(integer_literal) @number
+(decimal_literal) @float
+(system_defined_variable) @function.builtin
+(system_defined_function) @function.builtin
+(dollarsf
+  (dollar_system_keyword) @function.builtin
+)
+(property_name) @property
+(parameter_name) @constant
+(parameter_name) @variable.parameter
+(class_method_call
+    (class_ref (class_name) @type.definition)
+    (method_name) @function.method.call
+)
+(oref_method (method_name) @function.method.call)
+(_ preproc_keyword: (_) @keyword.directive)
+(_ modifier: (_) @keyword.directive)
+(extrinsic_function) @function.call
+(_ label: (_) @label)
+(_ offset: (_) @number)
+(_ routine: (_) @namespace)
+(json_boolean_literal) @boolean
+(json_null_literal) @constant.builtin
+(json_number_literal) @number
+(json_string_literal) @string.escape
+(macro (macro_constant)) @constant.macro
+(macro (macro_function)) @function.macro
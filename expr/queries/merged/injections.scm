@@ -0,0 +1 @@
+; Generated by scripts/merge-queries.js from expr/queries/injections.scm, do not edit
@@ -27,7 +27,7 @@ setup(
     package_dir={"": "bindings/python"},
     package_data={
         "tree_sitter_objectscript_expr": ["*.pyi", "py.typed"],
-        "tree_sitter_objectscript_expr.queries": ["*.scm"],
+        "tree_sitter_objectscript_expr.queries": ["*.scm", "merged/*.scm"],
     },
     ext_package="tree_sitter_objectscript_expr",
     ext_modules=[
@@ -36,7 +36,7 @@ setup(
             sources=[
                 "bindings/python/tree_sitter_objectscript_expr/binding.c",
                 "src/parser.c",
-                # NOTE: if your language uses an external scanner, add it here.
+                "src/scanner.c",
             ],
             extra_compile_args=[
                 "-std=c11",
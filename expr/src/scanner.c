@@ -0,0 +1,51 @@
+#include "scanner.h"
+#include "tree_sitter/parser.h"
+
+// Keep in the order of `externals` in grammar.js
+enum ObjectScript_Expr_Scanner_TokenType {
+  STRING_LITERAL,
+  JSON_STRING_LITERAL,
+};
+
+// The scanner has no state
+void *tree_sitter_objectscript_expr_external_scanner_create() { return NULL; }
+
+bool tree_sitter_objectscript_expr_external_scanner_scan(
+    void *payload, TSLexer *lexer, const bool *valid_symbols) {
+  (void)payload;
+  // All symbols are valid during error recovery, leave it to the lexer
+  if (valid_symbols[STRING_LITERAL] && valid_symbols[JSON_STRING_LITERAL]) {
+    return false;
+  }
+  while (lexer->lookahead == ' ' || lexer->lookahead == '\t' ||
+         lexer->lookahead == '\r' || lexer->lookahead == '\n') {
+    lexer->advance(lexer, true);
+  }
+  if (valid_symbols[STRING_LITERAL]) {
+    lexer->result_symbol = STRING_LITERAL;
+    return ObjectScript_Expr_Scanner_lex_string(lexer);
+  }
+  if (valid_symbols[JSON_STRING_LITERAL]) {
+    lexer->result_symbol = JSON_STRING_LITERAL;
+    return ObjectScript_Expr_Scanner_lex_json_string(lexer);
+  }
+  return false;
+}
+
+unsigned tree_sitter_objectscript_expr_external_scanner_serialize(void *payload,
+                                                                  char *buffer) {
+  (void)payload;
+  (void)buffer;
+  return 0;
+}
+
+void tree_sitter_objectscript_expr_external_scanner_deserialize(
+    void *payload, const char *buffer, unsigned length) {
+  (void)payload;
+  (void)buffer;
+  (void)length;
+}
+
+void tree_sitter_objectscript_expr_external_scanner_destroy(void *payload) {
+  (void)payload;
+}
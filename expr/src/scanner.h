@@ -0,0 +1,82 @@
+#ifndef OBJECTSCRIPT_EXPR_SCANNER_H_
+#define OBJECTSCRIPT_EXPR_SCANNER_H_
+
+#include "tree_sitter/parser.h"
+
+// String literals, shared with the core scanner (and through it the udl
+// one), which calls these when its own string_literal or
+// json_string_literal is valid and the lookahead is the opening `"`.
+//
+// A string's body can be kilobytes of `&html<>` or JSON text, and in the
+// generated lexer every character of it is a state dispatch.  Here the body
+// is one loop that only compares against the characters that can end it.
+// TSLexer hands out one character at a time, so this can't search the
+// buffer the way memchr() would, but it is the closest a scanner gets.
+//
+// Both only look at the lexer, the caller sets the result symbol.  On
+// false the generated lexer, which still has both tokens, tries again.
+// Nothing here is mutable, see the thread safety note in
+// core/src/scanner.h.
+//
+// core and udl build a copy of this file, src/expr_scanner.h, so that each
+// grammar's src is complete; rerun scripts/copy-expr-scanner.js after
+// changing it.
+
+// `"` ... `"`, with `""` for a quote inside.  Like the grammar's regex a
+// string may span lines.
+static inline bool ObjectScript_Expr_Scanner_lex_string(TSLexer *lexer) {
+  if (lexer->lookahead != '"') return false;
+  lexer->advance(lexer, false);
+  for (;;) {
+    int32_t c = lexer->lookahead;
+    while (c != '"') {
+      if (c == 0 && lexer->eof(lexer)) return false;
+      lexer->advance(lexer, false);
+      c = lexer->lookahead;
+    }
+    lexer->advance(lexer, false);
+    if (lexer->lookahead != '"') return true;
+    lexer->advance(lexer, false);
+  }
+}
+
+static inline bool is_hex_digit(int32_t c) {
+  return (c >= '0' && c <= '9') || (c >= 'A' && c <= 'F') || (c >= 'a' && c <= 'f');
+}
+
+// A JSON string: no raw newlines, `\` escapes per RFC 8259.
+static inline bool ObjectScript_Expr_Scanner_lex_json_string(TSLexer *lexer) {
+  if (lexer->lookahead != '"') return false;
+  lexer->advance(lexer, false);
+  for (;;) {
+    int32_t c = lexer->lookahead;
+    while (c != '"' && c != '\\' && c != '\n') {
+      if (c == 0 && lexer->eof(lexer)) return false;
+      lexer->advance(lexer, false);
+      c = lexer->lookahead;
+    }
+    if (c == '"') {
+      lexer->advance(lexer, false);
+      return true;
+    }
+    if (c == '\n') return false;
+
+    lexer->advance(lexer, false);
+    switch (lexer->lookahead) {
+      case '"': case '\\': case '/': case 'b': case 'f': case 'n': case 'r': case 't':
+        lexer->advance(lexer, false);
+        break;
+      case 'u':
+        lexer->advance(lexer, false);
+        for (int i = 0; i < 4; i++) {
+          if (!is_hex_digit(lexer->lookahead)) return false;
+          lexer->advance(lexer, false);
+        }
+        break;
+      default:
+        return false;
+    }
+  }
+}
+
+#endif // OBJECTSCRIPT_EXPR_SCANNER_H_
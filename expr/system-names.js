@@ -0,0 +1,211 @@
+/**
+ * System functions and special variables
+ *
+ * The grammar lexes any `$name` as a system_defined_variable and any
+ * `$name(` as a system_defined_function, these lists say which names exist.
+ * scripts/generate-system-names.js turns them into the perfect hash table
+ * in tools/src/system_names.c, regenerate it after changing them.
+ *
+ * Each entry is the full name followed by its abbreviations, without the
+ * `$`.  Names are case insensitive.
+ */
+
+/* eslint-disable camelcase */
+// @ts-check
+
+/** @type {string[][]} */
+const functions = [
+  ['ASCII', 'A'],
+  ['BIT'],
+  ['BITCOUNT'],
+  ['BITFIND'],
+  ['BITLOGIC'],
+  ['CASE'],
+  ['CHAR', 'C'],
+  ['CLASSMETHOD'],
+  ['CLASSNAME'],
+  ['COMPILE'],
+  ['DATA', 'D'],
+  ['DECIMAL'],
+  ['DOUBLE'],
+  ['EXTRACT', 'E'],
+  ['FACTOR'],
+  ['FIND', 'F'],
+  ['FNUMBER', 'FN'],
+  ['GET', 'G'],
+  ['INCREMENT', 'I'],
+  ['INUMBER', 'IN'],
+  ['ISOBJECT'],
+  ['ISVALIDDOUBLE'],
+  ['ISVALIDNUM'],
+  ['ISVECTOR'],
+  ['JUSTIFY', 'J'],
+  ['LENGTH', 'L'],
+  ['LIST', 'LI'],
+  ['LISTBUILD', 'LB'],
+  ['LISTDATA', 'LD'],
+  ['LISTFIND', 'LF'],
+  ['LISTFROMSTRING', 'LFS'],
+  ['LISTGET', 'LG'],
+  ['LISTLENGTH', 'LL'],
+  ['LISTNEXT'],
+  ['LISTSAME', 'LS'],
+  ['LISTTOSTRING', 'LTS'],
+  ['LISTUPDATE', 'LU'],
+  ['LISTVALID', 'LV'],
+  ['LOCATE'],
+  ['MATCH'],
+  ['METHOD'],
+  ['NAME', 'NA'],
+  ['NCONVERT', 'NC'],
+  ['NORMALIZE'],
+  ['NOW'],
+  ['NUMBER', 'NUM'],
+  ['ORDER', 'O'],
+  ['PARAMETER'],
+  ['PIECE', 'P'],
+  ['PREFETCHOFF'],
+  ['PREFETCHON'],
+  ['PREPROCESS'],
+  ['PROPERTY'],
+  ['QLENGTH', 'QL'],
+  ['QSUBSCRIPT', 'QS'],
+  ['QUERY', 'Q'],
+  ['RANDOM', 'R'],
+  ['REPLACE'],
+  ['REVERSE', 'RE'],
+  ['SCONVERT', 'SC'],
+  ['SELECT', 'S'],
+  ['SEQUENCE', 'SEQ'],
+  ['SORTBEGIN'],
+  ['SORTEND'],
+  ['STACK', 'ST'],
+  ['TEXT', 'T'],
+  ['TRANSLATE', 'TR'],
+  ['VECTOR', 'VE'],
+  ['VECTORDEFINED', 'VD'],
+  ['VECTOROP', 'VOP'],
+  ['VIEW', 'V'],
+  ['WASCII', 'WA'],
+  ['WCHAR', 'WC'],
+  ['WEXTRACT', 'WE'],
+  ['WFIND', 'WF'],
+  ['WISWIDE'],
+  ['WLENGTH', 'WL'],
+  ['WREVERSE', 'WRE'],
+  ['XECUTE'],
+  ['ZABS'],
+  ['ZARCCOS'],
+  ['ZARCSIN'],
+  ['ZARCTAN'],
+  ['ZBITAND'],
+  ['ZBITCOUNT'],
+  ['ZBITFIND'],
+  ['ZBITGET'],
+  ['ZBITLEN'],
+  ['ZBITNOT'],
+  ['ZBITOR'],
+  ['ZBITSET'],
+  ['ZBITSTR'],
+  ['ZBITXOR'],
+  ['ZBOOLEAN', 'ZB'],
+  ['ZCONVERT', 'ZCVT'],
+  ['ZCOS'],
+  ['ZCOT'],
+  ['ZCRC'],
+  ['ZCSC'],
+  ['ZCYC', 'ZC'],
+  ['ZDASCII', 'ZDA'],
+  ['ZDATE', 'ZD'],
+  ['ZDATEH', 'ZDH'],
+  ['ZDATETIME', 'ZDT'],
+  ['ZDATETIMEH', 'ZDTH'],
+  ['ZDCHAR', 'ZDC'],
+  ['ZEXP'],
+  ['ZF'],
+  ['ZHEX', 'ZH'],
+  ['ZISWIDE'],
+  ['ZLASCII', 'ZLA'],
+  ['ZLCHAR', 'ZLC'],
+  ['ZLN'],
+  ['ZLOG'],
+  ['ZNAME'],
+  ['ZOBJCLASS'],
+  ['ZOBJCLASSMETHOD'],
+  ['ZOBJMETHOD'],
+  ['ZOBJPROPERTY'],
+  ['ZPOSITION'],
+  ['ZPOWER'],
+  ['ZQASCII', 'ZQA'],
+  ['ZQCHAR', 'ZQC'],
+  ['ZSEARCH', 'ZSE'],
+  ['ZSEC'],
+  ['ZSEEK'],
+  ['ZSIN'],
+  ['ZSQR'],
+  ['ZSTRIP'],
+  ['ZTAN'],
+  ['ZTIME', 'ZT'],
+  ['ZTIMEH', 'ZTH'],
+  ['ZUTIL', 'ZU'],
+  ['ZVERSION', 'ZV'],
+  ['ZWASCII', 'ZWA'],
+  ['ZWBPACK'],
+  ['ZWBUNPACK'],
+  ['ZWCHAR', 'ZWC'],
+  ['ZWIDTH'],
+  ['ZWPACK'],
+  ['ZWUNPACK'],
+  ['ZZENKAKU'],
+];
+
+/** @type {string[][]} */
+const variables = [
+  ['DEVICE', 'D'],
+  ['ECODE', 'EC'],
+  ['ESTACK', 'ES'],
+  ['ETRAP', 'ET'],
+  ['HALT'],
+  ['HOROLOG', 'H'],
+  ['IO', 'I'],
+  ['JOB', 'J'],
+  ['KEY', 'K'],
+  ['NAMESPACE'],
+  ['PRINCIPAL', 'P'],
+  ['QUIT', 'Q'],
+  ['ROLES'],
+  ['STACK', 'ST'],
+  ['STORAGE', 'S'],
+  ['SYSTEM', 'SY'],
+  ['TEST', 'T'],
+  ['THIS'],
+  ['THROWOBJ'],
+  ['TLEVEL', 'TL'],
+  ['USERNAME'],
+  ['X'],
+  ['Y'],
+  ['ZA'],
+  ['ZB'],
+  ['ZCHILD', 'ZC'],
+  ['ZEOF'],
+  ['ZEOS'],
+  ['ZERROR', 'ZE'],
+  ['ZHOROLOG', 'ZH'],
+  ['ZIO', 'ZI'],
+  ['ZJOB', 'ZJ'],
+  ['ZMODE', 'ZM'],
+  ['ZNAME', 'ZN'],
+  ['ZNSPACE'],
+  ['ZORDER', 'ZO'],
+  ['ZPARENT', 'ZP'],
+  ['ZPI'],
+  ['ZPOSITION', 'ZPOS'],
+  ['ZREFERENCE', 'ZR'],
+  ['ZSTORAGE', 'ZS'],
+  ['ZTIMESTAMP', 'ZTS'],
+  ['ZTIMEZONE', 'ZTZ'],
+  ['ZTRAP', 'ZT'],
+  ['ZVERSION', 'ZV'],
+];
+
+module.exports = { functions, variables };
@@ -0,0 +1,149 @@
+#!/usr/bin/env node
+/**
+ * Size optimized wasm build of a grammar, for shipping in web IDEs.
+ *
+ * `tree-sitter build --wasm` targets the playground (-Os, symbols kept).
+ * This builds `<grammar>/tree-sitter-objectscript_<grammar>.min.wasm` with:
+ *
+ * - `-Oz` and LTO, with only the `tree_sitter_objectscript_<grammar>` entry
+ *   point exported, so that `--gc-sections` drops every function and table
+ *   it doesn't reach
+ * - the name section, producers and debug info stripped
+ * - a final `wasm-opt -Oz` pass when binaryen is installed
+ * - with `--compact-keywords`, the parser regenerated with
+ *   OBJECTSCRIPT_COMPACT_KEYWORDS set (see udl/keywords.js), into
+ *   `<grammar>/build/wasm/src`, leaving `src` alone
+ *
+ * Usage: node scripts/build-wasm.js [--compact-keywords] [grammar...]
+ *
+ * Needs emcc (emscripten) on the PATH.  Sizes are reported raw, gzip and
+ * brotli, compare the startup and throughput with udl/benches/wasm.js.
+ */
+
+/* eslint-disable camelcase */
+// @ts-check
+
+const { execFileSync } = require('child_process');
+const fs = require('fs');
+const path = require('path');
+const zlib = require('zlib');
+
+const ROOT = path.join(__dirname, '..');
+const GRAMMARS = ['expr', 'core', 'udl'];
+
+/**
+ * @param {string} command
+ * @param {string[]} args
+ * @param {import('child_process').ExecFileSyncOptions} options
+ */
+function run(command, args, options = {}) {
+  console.log(`$ ${command} ${args.join(' ')}`);
+  execFileSync(command, args, { stdio: 'inherit', ...options });
+}
+
+/**
+ * @param {string} command
+ * @return {boolean} whether `command` can be run
+ */
+function has(command) {
+  try {
+    execFileSync(command, ['--version'], { stdio: 'ignore' });
+    return true;
+  } catch (_) {
+    return false;
+  }
+}
+
+/**
+ * @param {string} file
+ * @return {string}
+ */
+function sizes(file) {
+  const data = fs.readFileSync(file);
+  const kb = (/** @type {number} */ n) => `${(n / 1024).toFixed(1)} KB`;
+  return (
+    `${kb(data.length)}, gzip ${kb(zlib.gzipSync(data, { level: 9 }).length)}` +
+    `, brotli ${kb(zlib.brotliCompressSync(data).length)}`
+  );
+}
+
+/**
+ * @param {string} dir grammar directory
+ * @param {boolean} compact_keywords
+ */
+function build(dir, compact_keywords) {
+  const grammar_dir = path.join(ROOT, dir);
+  const name = `objectscript_${dir}`;
+  let src_dir = path.join(grammar_dir, 'src');
+
+  if (compact_keywords) {
+    src_dir = path.join(grammar_dir, 'build', 'wasm', 'src');
+    fs.mkdirSync(src_dir, { recursive: true });
+    run('tree-sitter', ['generate', '--output', src_dir], {
+      cwd: grammar_dir,
+      env: { ...process.env, OBJECTSCRIPT_COMPACT_KEYWORDS: '1' },
+    });
+  }
+
+  // The scanner is compiled from src either way, it includes core's by path
+  const sources = [
+    path.join(src_dir, 'parser.c'),
+    ...fs
+      .readdirSync(path.join(grammar_dir, 'src'))
+      .filter((file) => file.endsWith('.c') && file !== 'parser.c')
+      .map((file) => path.join(grammar_dir, 'src', file)),
+  ];
+  const output = path.join(grammar_dir, `tree-sitter-${name}.min.wasm`);
+
+  run('emcc', [
+    '-Oz',
+    '-flto',
+    '-fno-exceptions',
+    '-fvisibility=hidden',
+    '-ffunction-sections',
+    '-fdata-sections',
+    '-std=c11',
+    '-DNDEBUG',
+    '-sWASM=1',
+    '-sSIDE_MODULE=2',
+    '-sTOTAL_MEMORY=33554432',
+    '-sNODEJS_CATCH_EXIT=0',
+    `-sEXPORTED_FUNCTIONS=["_tree_sitter_${name}"]`,
+    '-Wl,--gc-sections',
+    '-Wl,--strip-all',
+    '-I',
+    src_dir,
+    ...sources,
+    '-o',
+    output,
+  ]);
+  if (has('wasm-opt')) {
+    run('wasm-opt', [
+      '-Oz',
+      '--strip-debug',
+      '--strip-producers',
+      output,
+      '-o',
+      output,
+    ]);
+  } else {
+    console.log('wasm-opt (binaryen) not found, skipping the final -Oz pass');
+  }
+
+  const playground = path.join(grammar_dir, `tree-sitter-${name}.wasm`);
+  if (fs.existsSync(playground)) {
+    console.log(`${path.relative(ROOT, playground)}: ${sizes(playground)}`);
+  }
+  console.log(`${path.relative(ROOT, output)}: ${sizes(output)}`);
+}
+
+function main() {
+  const args = process.argv.slice(2);
+  const compact_keywords = args.includes('--compact-keywords');
+  const grammars = args.filter((arg) => !arg.startsWith('--'));
+  for (const dir of grammars.length ? grammars : GRAMMARS) {
+    build(dir, compact_keywords);
+  }
+}
+
+main();
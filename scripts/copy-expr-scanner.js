@@ -0,0 +1,51 @@
+#!/usr/bin/env node
+/**
+ * Copy the expr grammar's string scanner into core and udl.
+ *
+ * The core scanner (and through it the udl one) lexes string literals with
+ * the functions in `expr/src/scanner.h`.  Each grammar's `src` is what its
+ * npm package, crate and python sdist ship, so instead of reaching into
+ * `../../expr`, core and udl build a copy of it, `src/expr_scanner.h`.
+ * Edit `expr/src/scanner.h` and rerun this.
+ *
+ * Usage: node scripts/copy-expr-scanner.js [--check]
+ *
+ * With `--check` nothing is written, it fails if a copy is out of date.
+ */
+
+/* eslint-disable camelcase */
+// @ts-check
+
+const fs = require('fs');
+const path = require('path');
+
+const ROOT = path.join(__dirname, '..');
+const SOURCE = path.join(ROOT, 'expr', 'src', 'scanner.h');
+const COPIES = ['core', 'udl'].map((grammar) =>
+  path.join(ROOT, grammar, 'src', 'expr_scanner.h'));
+
+function main() {
+  const source =
+    '// Copied from expr/src/scanner.h by scripts/copy-expr-scanner.js, edit that\n' +
+    '// file instead of this one.\n\n' +
+    fs.readFileSync(SOURCE, 'utf8');
+
+  const check = process.argv.includes('--check');
+  let stale = false;
+  for (const copy of COPIES) {
+    const relative = path.relative(ROOT, copy);
+    const current = fs.existsSync(copy) ? fs.readFileSync(copy, 'utf8') : '';
+    if (current === source) {
+      console.log(`${relative} is up to date`);
+    } else if (check) {
+      console.error(`${relative} is out of date, run node scripts/copy-expr-scanner.js`);
+      stale = true;
+    } else {
+      fs.writeFileSync(copy, source);
+      console.log(`${relative}: copied`);
+    }
+  }
+  if (stale) process.exit(1);
+}
+
+main();
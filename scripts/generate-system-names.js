@@ -0,0 +1,190 @@
+#!/usr/bin/env node
+/**
+ * Generate the perfect hash table of system function and variable names.
+ *
+ * The grammar lexes `$name` and `$name(` generically, which keeps the ~300
+ * spellings out of the lexer; hosts classify the name afterwards with
+ * ObjectScript_System_Name_lookup() (tools/src/system_names.h).  This
+ * writes the table it probes, `tools/src/system_names_table.h`, from
+ * expr/system-names.js.
+ *
+ * The table is hash-and-displace: a spelling's first hash picks a bucket,
+ * and the bucket's seed, found here, sends each of its spellings to a slot
+ * of its own, so a lookup is two hashes and one string compare.
+ *
+ * Usage: node scripts/generate-system-names.js [--check]
+ *
+ * With `--check` nothing is written, it fails if the table is out of date.
+ */
+
+/* eslint-disable camelcase */
+// @ts-check
+
+const fs = require('fs');
+const path = require('path');
+
+const ROOT = path.join(__dirname, '..');
+const OUTPUT = path.join(ROOT, 'tools', 'src', 'system_names_table.h');
+const { functions, variables } = require(path.join(ROOT, 'expr', 'system-names'));
+
+// enum ObjectScript_System_Name_Kind
+const KIND_FUNCTION = 1;
+const KIND_VARIABLE = 2;
+
+const SPELLINGS_PER_BUCKET = 4;
+const MAX_SEED = 0xffff;
+
+/**
+ * Must stay the same as hash_name() in tools/src/system_names.c: FNV-1a
+ * over the kind and the upper case name (without the `$`), then the
+ * murmur3 finalizer so that every bit depends on the seed.
+ *
+ * @param {number} seed
+ * @param {number} kind
+ * @param {string} name upper case, without the `$`
+ * @return {number}
+ */
+function hash_name(seed, kind, name) {
+  let hash = (0x811c9dc5 ^ seed) >>> 0;
+  hash = Math.imul(hash ^ kind, 0x01000193) >>> 0;
+  for (let i = 0; i < name.length; i++) {
+    hash = Math.imul(hash ^ name.charCodeAt(i), 0x01000193) >>> 0;
+  }
+  hash ^= hash >>> 16;
+  hash = Math.imul(hash, 0x85ebca6b) >>> 0;
+  hash ^= hash >>> 13;
+  hash = Math.imul(hash, 0xc2b2ae35) >>> 0;
+  hash ^= hash >>> 16;
+  return hash >>> 0;
+}
+
+/**
+ * @typedef {{spelling: string, name: string, id: number, kind: number}} Entry
+ */
+
+/** @return {Entry[]} */
+function entries() {
+  /** @type {Entry[]} */
+  const result = [];
+  const seen = new Set();
+  let id = 0;
+  for (const [kind, groups] of [[KIND_FUNCTION, functions], [KIND_VARIABLE, variables]]) {
+    for (const group of /** @type {string[][]} */ (groups)) {
+      for (const spelling of group) {
+        if (!/^[A-Z][A-Z0-9]*$/.test(spelling)) {
+          throw new Error(`'${spelling}' must be upper case letters and digits`);
+        }
+        if (seen.has(`${kind}:${spelling}`)) {
+          throw new Error(`'$${spelling}' is listed twice`);
+        }
+        seen.add(`${kind}:${spelling}`);
+        result.push({ spelling, name: group[0], id, kind: /** @type {number} */ (kind) });
+      }
+      id++;
+    }
+  }
+  return result;
+}
+
+/**
+ * @param {Entry[]} table
+ * @return {{bucket_count: number, slot_count: number, seeds: number[], slots: number[]}}
+ */
+function displace(table) {
+  const bucket_count = Math.ceil(table.length / SPELLINGS_PER_BUCKET);
+  let slot_count = 1;
+  while (slot_count < table.length * 1.5) slot_count *= 2;
+
+  /** @type {number[][]} */
+  const buckets = Array.from({ length: bucket_count }, () => []);
+  table.forEach((entry, index) => {
+    buckets[hash_name(0, entry.kind, entry.spelling) % bucket_count].push(index);
+  });
+
+  const seeds = new Array(bucket_count).fill(0);
+  const slots = new Array(slot_count).fill(0);   // index + 1, 0 == empty
+  const order = buckets.map((_, bucket) => bucket)
+    .sort((a, b) => buckets[b].length - buckets[a].length || a - b);
+  for (const bucket of order) {
+    if (!buckets[bucket].length) continue;
+    let placed = false;
+    for (let seed = 1; seed <= MAX_SEED && !placed; seed++) {
+      const wanted = buckets[bucket].map((index) => {
+        const entry = table[index];
+        return hash_name(seed, entry.kind, entry.spelling) & (slot_count - 1);
+      });
+      if (new Set(wanted).size !== wanted.length || wanted.some((slot) => slots[slot])) {
+        continue;
+      }
+      wanted.forEach((slot, i) => slots[slot] = buckets[bucket][i] + 1);
+      seeds[bucket] = seed;
+      placed = true;
+    }
+    if (!placed) throw new Error(`No seed places bucket ${bucket}, raise the slot count`);
+  }
+  return { bucket_count, slot_count, seeds, slots };
+}
+
+/**
+ * @param {number[]} values
+ * @return {string}
+ */
+function c_array(values) {
+  const lines = [];
+  for (let i = 0; i < values.length; i += 12) {
+    lines.push('  ' + values.slice(i, i + 12).join(', ') + ',');
+  }
+  return lines.join('\n');
+}
+
+function main() {
+  const table = entries();
+  const { bucket_count, slot_count, seeds, slots } = displace(table);
+  const max_length = Math.max(...table.map((entry) => entry.spelling.length));
+  const kinds = { [KIND_FUNCTION]: 'ObjectScript_System_function',
+    [KIND_VARIABLE]: 'ObjectScript_System_variable' };
+
+  const source = `// Generated by scripts/generate-system-names.js from expr/system-names.js, do not edit
+//
+// ${table.length} spellings of ${functions.length} functions and ${variables.length} variables
+#ifndef OBJECTSCRIPT_SYSTEM_NAMES_TABLE_H_
+#define OBJECTSCRIPT_SYSTEM_NAMES_TABLE_H_
+
+#define SYSTEM_NAME_COUNT ${table.length}
+#define SYSTEM_NAME_BUCKET_COUNT ${bucket_count}
+#define SYSTEM_NAME_SLOT_COUNT ${slot_count}
+#define SYSTEM_NAME_MAX_LENGTH ${max_length + 1}
+
+static const struct ObjectScript_System_Name system_names[SYSTEM_NAME_COUNT] = {
+${table.map((entry) => `  {"$${entry.spelling}", "$${entry.name}", ${entry.id}, ` +
+    `${kinds[entry.kind]}, ${entry.spelling.length + 1}},`).join('\n')}
+};
+
+static const uint16_t system_name_seeds[SYSTEM_NAME_BUCKET_COUNT] = {
+${c_array(seeds)}
+};
+
+// Index into system_names + 1, 0 for an empty slot
+static const uint16_t system_name_slots[SYSTEM_NAME_SLOT_COUNT] = {
+${c_array(slots)}
+};
+
+#endif // OBJECTSCRIPT_SYSTEM_NAMES_TABLE_H_
+`;
+
+  const relative = path.relative(ROOT, OUTPUT);
+  if (process.argv.includes('--check')) {
+    const current = fs.existsSync(OUTPUT) ? fs.readFileSync(OUTPUT, 'utf8') : '';
+    if (current !== source) {
+      console.error(`${relative} is out of date, run node scripts/generate-system-names.js`);
+      process.exit(1);
+    }
+    console.log(`${relative} is up to date`);
+    return;
+  }
+  fs.writeFileSync(OUTPUT, source);
+  console.log(`${relative}: ${table.length} spellings, ${bucket_count} buckets, ` +
+    `${slot_count} slots`);
+}
+
+main();
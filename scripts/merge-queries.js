@@ -0,0 +1,173 @@
+#!/usr/bin/env node
+/**
+ * Merge the layered query files into one bundle per grammar and category.
+ *
+ * Editors compile `highlights.scm` etc. at startup, and for udl that means
+ * combining the expr, core and udl layers and compiling three files.  This
+ * combines them once, strips comments, validates the result against the
+ * grammar and writes it to `<grammar>/queries/merged/<category>.scm`, which
+ * is what the node/python/rust bindings hand out.
+ *
+ * A grammar listed in tree-sitter.json gets the files listed there for the
+ * category, in that order, the way the tree-sitter CLI combines them (udl's
+ * injections.scm has no `;; inherits` line, but core's injections apply to
+ * udl method bodies all the same).  The other grammars follow the
+ * `;; inherits:` chain of their query files, as nvim does.
+ *
+ * Usage: node scripts/merge-queries.js [--no-validate] [grammar...]
+ *
+ * Validation needs the `tree-sitter` node package and the grammar bindings
+ * to be built (`npm run build`), run this as part of the release.
+ */
+
+/* eslint-disable camelcase */
+// @ts-check
+
+const fs = require('fs');
+const path = require('path');
+
+const ROOT = path.join(__dirname, '..');
+const GRAMMARS = ['expr', 'core', 'udl'];
+const CATEGORIES = ['highlights', 'injections', 'locals'];
+
+/**
+ * Map a language name used by `;; inherits:` to its directory
+ *
+ * @param {string} name e.g. objectscript_core
+ * @return {string} e.g. core
+ */
+function grammar_dir(name) {
+  const dir = name.replace(/^objectscript_/, '');
+  if (!GRAMMARS.includes(dir)) {
+    throw new Error(`Unknown inherited language '${name}'`);
+  }
+  return dir;
+}
+
+/**
+ * Remove `;` comments (outside of strings) and blank lines
+ *
+ * @param {string} source
+ * @return {string}
+ */
+function strip_comments(source) {
+  const lines = [];
+  for (const line of source.split('\n')) {
+    let out = '';
+    let in_string = false;
+    for (let i = 0; i < line.length; i++) {
+      const ch = line[i];
+      if (in_string) {
+        out += ch;
+        if (ch === '\\') {
+          out += line[++i] ?? '';
+        } else if (ch === '"') {
+          in_string = false;
+        }
+      } else if (ch === ';') {
+        break;
+      } else {
+        out += ch;
+        in_string = ch === '"';
+      }
+    }
+    out = out.trimEnd();
+    if (out.length) {
+      lines.push(out);
+    }
+  }
+  return lines.join('\n');
+}
+
+/**
+ * Resolve the inherits chain of a query file, base grammars first
+ *
+ * @param {string} dir grammar directory
+ * @param {string} category
+ * @param {Set<string>} visited
+ * @return {string[]} the stripped source of each layer
+ */
+function resolve(dir, category, visited = new Set()) {
+  if (visited.has(dir)) {
+    return [];
+  }
+  visited.add(dir);
+
+  const file = path.join(ROOT, dir, 'queries', `${category}.scm`);
+  if (!fs.existsSync(file)) {
+    return [];
+  }
+  const source = fs.readFileSync(file, 'utf8');
+
+  const layers = [];
+  const inherits = source.match(/^;+\s*inherits\s*:?\s*(.*)$/m);
+  if (inherits) {
+    for (const name of inherits[1].split(',')) {
+      // nvim allows `(lang)` for languages that are only inherited explicitly
+      const parent = name.trim().replace(/^\((.*)\)$/, '$1');
+      if (parent) {
+        layers.push(...resolve(grammar_dir(parent), category, visited));
+      }
+    }
+  }
+  layers.push(strip_comments(source));
+  return layers;
+}
+
+/**
+ * The query files tree-sitter.json lists for a grammar and category
+ *
+ * @param {string} dir grammar directory
+ * @param {string} category
+ * @return {string[] | null} paths relative to the repository root, or null
+ *   if tree-sitter.json has no entry for the grammar
+ */
+function configured_files(dir, category) {
+  const config = JSON.parse(fs.readFileSync(path.join(ROOT, 'tree-sitter.json'), 'utf8'));
+  const grammar = config.grammars.find((entry) => path.normalize(entry.path ?? '.') === dir);
+  if (!grammar || grammar[category] === undefined) {
+    return null;
+  }
+  return typeof grammar[category] === 'string' ? [grammar[category]] : grammar[category];
+}
+
+/**
+ * @param {string} dir grammar directory
+ * @param {string} source merged query
+ */
+function validate(dir, source) {
+  const Parser = require('tree-sitter');
+  const language = require(path.join(ROOT, dir));
+  // Throws a QueryError pointing at the offending pattern
+  new Parser.Query(language, source);
+}
+
+function main() {
+  const args = process.argv.slice(2);
+  const validating = !args.includes('--no-validate');
+  const grammars = args.filter((arg) => !arg.startsWith('--'));
+
+  for (const dir of grammars.length ? grammars : GRAMMARS) {
+    const out_dir = path.join(ROOT, dir, 'queries', 'merged');
+    fs.mkdirSync(out_dir, { recursive: true });
+
+    for (const category of CATEGORIES) {
+      const files = configured_files(dir, category);
+      const layers = (
+        files
+          ? files.map((file) => strip_comments(fs.readFileSync(path.join(ROOT, file), 'utf8')))
+          : resolve(dir, category)
+      ).filter((layer) => layer.length);
+      const source = layers.length ? layers.join('\n') + '\n' : '';
+      if (validating && layers.length) {
+        validate(dir, source);
+      }
+      const from = files ? files.join(', ') : `${dir}/queries/${category}.scm`;
+      const header = `; Generated by scripts/merge-queries.js from ${from}, do not edit\n`;
+      fs.writeFileSync(path.join(out_dir, `${category}.scm`), header + source);
+      console.log(`${dir}/queries/merged/${category}.scm: ${layers.length} layer(s), ${source.length} bytes`);
+    }
+  }
+}
+
+main();
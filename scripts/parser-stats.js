@@ -0,0 +1,62 @@
+#!/usr/bin/env node
+/**
+ * Size of each generated parser, for comparing grammar changes.
+ *
+ * Reports the size of `<grammar>/src/parser.c`, its parse state, symbol
+ * and token counts, and the number of lexer states (the cases of `ts_lex`
+ * and, if the grammar has a `word` rule, `ts_lex_keywords`).  Run it
+ * before and after a change that adds or removes tokens, after
+ * `npm run gen`.
+ *
+ * Usage: node scripts/parser-stats.js [grammar...]
+ */
+
+/* eslint-disable camelcase */
+// @ts-check
+
+const fs = require('fs');
+const path = require('path');
+
+const ROOT = path.join(__dirname, '..');
+const GRAMMARS = ['expr', 'core', 'udl'];
+const DEFINES = ['STATE_COUNT', 'LARGE_STATE_COUNT', 'SYMBOL_COUNT', 'TOKEN_COUNT'];
+
+/**
+ * Number of `case N:` labels in a generated lex function
+ *
+ * @param {string} source parser.c
+ * @param {string} name e.g. ts_lex
+ * @return {number}
+ */
+function lex_states(source, name) {
+  const start = source.indexOf(`static bool ${name}(TSLexer *lexer, TSStateId state) {`);
+  if (start < 0) return 0;
+  const end = source.indexOf('\n}\n', start);
+  const body = source.slice(start, end);
+  return (body.match(/^ {4}case \d+:/gm) || []).length;
+}
+
+function main() {
+  const grammars = process.argv.slice(2);
+  const rows = [];
+  for (const dir of grammars.length ? grammars : GRAMMARS) {
+    const file = path.join(ROOT, dir, 'src', 'parser.c');
+    if (!fs.existsSync(file)) {
+      console.error(`${dir}/src/parser.c is missing, run npm run gen first`);
+      continue;
+    }
+    const source = fs.readFileSync(file, 'utf8');
+    /** @type {Record<string, string | number>} */
+    const row = { grammar: dir, 'parser.c bytes': fs.statSync(file).size };
+    for (const define of DEFINES) {
+      const match = source.match(new RegExp(`^#define ${define} (\\d+)$`, 'm'));
+      row[define] = match ? Number(match[1]) : '?';
+    }
+    row['lex states'] = lex_states(source, 'ts_lex');
+    row['keyword lex states'] = lex_states(source, 'ts_lex_keywords');
+    rows.push(row);
+  }
+  console.table(rows);
+}
+
+main();
@@ -0,0 +1,77 @@
+#ifndef OBJECTSCRIPT_BENCH_H_
+#define OBJECTSCRIPT_BENCH_H_
+
+// Shared helpers for the benchmarks, include before anything else
+
+#define _POSIX_C_SOURCE 200809L
+#include <stdarg.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+struct Bench_Buffer {
+  char    *data;
+  uint32_t length;
+  uint32_t capacity;
+};
+
+static inline void Bench_Buffer_reserve(struct Bench_Buffer *buffer, uint32_t extra) {
+  if (buffer->length + extra + 1 <= buffer->capacity) return;
+  uint32_t capacity = buffer->capacity ? buffer->capacity : 4096;
+  while (capacity < buffer->length + extra + 1) capacity *= 2;
+  buffer->data = (char *)realloc(buffer->data, capacity);
+  if (!buffer->data) {
+    fprintf(stderr, "out of memory\n");
+    exit(1);
+  }
+  buffer->capacity = capacity;
+}
+
+static inline void Bench_Buffer_printf(struct Bench_Buffer *buffer, const char *format, ...) {
+  va_list args;
+  va_start(args, format);
+  int n = vsnprintf(NULL, 0, format, args);
+  va_end(args);
+  if (n <= 0) return;
+
+  Bench_Buffer_reserve(buffer, (uint32_t)n);
+  va_start(args, format);
+  vsnprintf(&buffer->data[buffer->length], (size_t)n + 1, format, args);
+  va_end(args);
+  buffer->length += (uint32_t)n;
+}
+
+static inline void Bench_Buffer_free(struct Bench_Buffer *buffer) {
+  free(buffer->data);
+  memset(buffer, 0, sizeof(*buffer));
+}
+
+static inline bool Bench_read_file(const char *path, struct Bench_Buffer *buffer) {
+  FILE *file = fopen(path, "rb");
+  if (!file) {
+    perror(path);
+    return false;
+  }
+  char chunk[65536];
+  size_t n;
+  while ((n = fread(chunk, 1, sizeof(chunk), file)) > 0) {
+    Bench_Buffer_reserve(buffer, (uint32_t)n);
+    memcpy(&buffer->data[buffer->length], chunk, n);
+    buffer->length += (uint32_t)n;
+  }
+  fclose(file);
+  Bench_Buffer_reserve(buffer, 0);
+  buffer->data[buffer->length] = 0;
+  return true;
+}
+
+static inline double Bench_now_ms(void) {
+  struct timespec now;
+  clock_gettime(CLOCK_MONOTONIC, &now);
+  return (double)now.tv_sec * 1e3 + (double)now.tv_nsec / 1e6;
+}
+
+#endif // OBJECTSCRIPT_BENCH_H_
@@ -0,0 +1,100 @@
+#ifndef OBJECTSCRIPT_BENCH_LEXER_H_
+#define OBJECTSCRIPT_BENCH_LEXER_H_
+
+// A TSLexer over a UTF-8 buffer, for calling a grammar's scanner functions
+// without a parser: to test them on their own and to time them apart from
+// the parse.  Like the runtime it hands out one code point at a time, 0 at
+// the end of the input, and a token ends where mark_end() was last called
+// or else where the scan stopped.  Columns are in bytes.
+
+#include "bench.h"
+// api.h first, parser.h leaves out the types the two share once it's seen
+#include <tree_sitter/api.h>
+#include "../../expr/src/tree_sitter/parser.h"
+
+struct Bench_Lexer {
+  TSLexer lexer;   // First, the callbacks cast back to the Bench_Lexer
+  const char *data;
+  uint32_t length;
+  uint32_t position;    // Of the lookahead
+  uint32_t size;        // Of the lookahead in bytes
+  uint32_t token_end;   // Where mark_end() was last called
+  bool marked;
+};
+
+static inline void Bench_Lexer_decode(struct Bench_Lexer *self) {
+  if (self->position >= self->length) {
+    self->lexer.lookahead = 0;
+    self->size = 0;
+    return;
+  }
+  const unsigned char *bytes = (const unsigned char *)self->data + self->position;
+  uint32_t left = self->length - self->position;
+  uint32_t size = bytes[0] < 0x80 ? 1 : bytes[0] < 0xe0 ? 2 : bytes[0] < 0xf0 ? 3 : 4;
+  if (size > left) size = left;
+  int32_t c = size == 1 ? bytes[0] : bytes[0] & (0x3f >> (size - 1));
+  for (uint32_t i = 1; i < size; i++) c = (c << 6) | (bytes[i] & 0x3f);
+  self->lexer.lookahead = c;
+  self->size = size;
+}
+
+static inline void Bench_Lexer_advance(TSLexer *lexer, bool skip) {
+  struct Bench_Lexer *self = (struct Bench_Lexer *)lexer;
+  (void)skip;
+  self->position += self->size;
+  Bench_Lexer_decode(self);
+}
+
+static inline void Bench_Lexer_mark_end(TSLexer *lexer) {
+  struct Bench_Lexer *self = (struct Bench_Lexer *)lexer;
+  self->token_end = self->position;
+  self->marked = true;
+}
+
+static inline uint32_t Bench_Lexer_get_column(TSLexer *lexer) {
+  struct Bench_Lexer *self = (struct Bench_Lexer *)lexer;
+  uint32_t start = self->position;
+  while (start > 0 && self->data[start - 1] != '\n') start--;
+  return self->position - start;
+}
+
+static inline bool Bench_Lexer_is_at_included_range_start(const TSLexer *lexer) {
+  (void)lexer;
+  return false;
+}
+
+static inline bool Bench_Lexer_eof(const TSLexer *lexer) {
+  const struct Bench_Lexer *self = (const struct Bench_Lexer *)lexer;
+  return self->position >= self->length;
+}
+
+static inline void Bench_Lexer_log(const TSLexer *lexer, const char *format, ...) {
+  (void)lexer;
+  (void)format;
+}
+
+// Starts a token at byte `position` of `data`
+static inline void Bench_Lexer_start(struct Bench_Lexer *self, const char *data,
+                                     uint32_t length, uint32_t position) {
+  self->lexer.lookahead = 0;
+  self->lexer.result_symbol = 0;
+  self->lexer.advance = Bench_Lexer_advance;
+  self->lexer.mark_end = Bench_Lexer_mark_end;
+  self->lexer.get_column = Bench_Lexer_get_column;
+  self->lexer.is_at_included_range_start = Bench_Lexer_is_at_included_range_start;
+  self->lexer.eof = Bench_Lexer_eof;
+  self->lexer.log = Bench_Lexer_log;
+  self->data = data;
+  self->length = length;
+  self->position = position;
+  self->token_end = position;
+  self->marked = false;
+  Bench_Lexer_decode(self);
+}
+
+// The end of the token the last scan returned
+static inline uint32_t Bench_Lexer_token_end(const struct Bench_Lexer *self) {
+  return self->marked ? self->token_end : self->position;
+}
+
+#endif // OBJECTSCRIPT_BENCH_LEXER_H_
@@ -0,0 +1,243 @@
+// Building a workspace call graph
+//
+// Usage: call_graph_bench [-n classes] [-r routines] [-m methods] [-t threads]
+//                         [file... | -]
+//
+// Reads, parses and extracts the calls of every file on one thread and
+// then on `threads` (all CPUs by default), and reports files/s, MB/s and
+// call edges/s for each, an impact query (everything that transitively
+// calls a method) and the cost of re-reading one changed file.  `-` reads
+// the file names from stdin, e.g.
+//
+//   find src -name '*.cls' -o -name '*.mac' | build/call_graph_bench -
+//
+// Without input files, a workspace of `classes` classes of `methods`
+// methods and `routines` routines is generated into a temporary directory
+// and removed afterwards.
+#include "bench.h"
+#include "grammars.h"
+#include "call_graph.h"
+#include <sys/stat.h>
+#include <unistd.h>
+
+#define PACKAGES 50
+
+struct Paths {
+  char **data;
+  uint32_t count;
+  uint32_t capacity;
+};
+
+static void paths_push(struct Paths *paths, const char *path) {
+  if (paths->count == paths->capacity) {
+    paths->capacity = paths->capacity ? paths->capacity * 2 : 1024;
+    paths->data = (char **)realloc(paths->data, paths->capacity * sizeof(char *));
+    if (!paths->data) {
+      fprintf(stderr, "out of memory\n");
+      exit(1);
+    }
+  }
+  paths->data[paths->count++] = strdup(path);
+}
+
+static void write_file(const char *path, const struct Bench_Buffer *buffer) {
+  FILE *file = fopen(path, "wb");
+  if (!file || fwrite(buffer->data, 1, buffer->length, file) != buffer->length) {
+    perror(path);
+    exit(1);
+  }
+  fclose(file);
+}
+
+// Calls to other classes and routines, on top of the ones in the shared
+// statements, so the callees are spread over the workspace
+static void generate_class(struct Bench_Buffer *buffer, int i, int classes, int routines,
+                           int methods) {
+  Bench_Buffer_printf(buffer, "Class Pkg%d.C%d Extends Pkg%d.C%d\n{\n\n", i % PACKAGES, i,
+                      (i / 2) % PACKAGES, i / 2);
+  for (int m = 0; m < methods; m++) {
+    int other = (i * 31 + m * 7) % classes;
+    Bench_Buffer_printf(buffer,
+                        "ClassMethod Method%d(pInput As %%String) As %%Status\n{\n"
+                        "    do ##class(Pkg%d.C%d).Method%d(pInput), ..Method%d(pInput)\n"
+                        "    do Tag%d^R%d\n"
+                        "    do ##super(pInput)\n",
+                        m, other % PACKAGES, other, (m + 1) % methods, (m + 1) % methods,
+                        m % 10, (i + m) % routines);
+    Bench_generate_statements(buffer, m, "    ");
+    Bench_Buffer_printf(buffer, "}\n\n");
+  }
+  Bench_Buffer_printf(buffer, "}\n");
+}
+
+static void generate_routine(struct Bench_Buffer *buffer, int i, int routines) {
+  for (int tag = 0; tag < 10; tag++) {
+    Bench_Buffer_printf(buffer, "Tag%d ; entry point\n set x = $$Tag%d^R%d(1)\n do Tag%d\n",
+                        tag, (tag + 1) % 10, (i + 1) % routines, (tag + 1) % 10);
+    Bench_generate_statements(buffer, tag, " ");
+  }
+}
+
+static bool next_path(bool from_stdin, int argc, char **argv, int *arg, char *path,
+                      size_t size) {
+  if (from_stdin) {
+    while (fgets(path, (int)size, stdin)) {
+      path[strcspn(path, "\r\n")] = 0;
+      if (*path) return true;
+    }
+    return false;
+  }
+  if (*arg >= argc) return false;
+  snprintf(path, size, "%s", argv[(*arg)++]);
+  return true;
+}
+
+static void report(const char *label, double ms, uint32_t files, uint64_t bytes,
+                   const struct ObjectScript_Call_Graph_Stats *stats) {
+  printf("  %-12s %9.1f ms  %9.0f files/s  %7.1f MB/s  %10.0f edges/s\n", label, ms,
+         files * 1000.0 / ms, bytes / (1024.0 * 1024.0) / (ms / 1000.0),
+         stats->calls * 1000.0 / ms);
+}
+
+int main(int argc, char **argv) {
+  int classes = 2000;
+  int routines = 500;
+  int methods = 10;
+  uint32_t threads = 0;
+  int arg = 1;
+  for (; arg < argc; arg++) {
+    if (!strcmp(argv[arg], "-n") && arg + 1 < argc) {
+      classes = atoi(argv[++arg]);
+    } else if (!strcmp(argv[arg], "-r") && arg + 1 < argc) {
+      routines = atoi(argv[++arg]);
+    } else if (!strcmp(argv[arg], "-m") && arg + 1 < argc) {
+      methods = atoi(argv[++arg]);
+    } else if (!strcmp(argv[arg], "-t") && arg + 1 < argc) {
+      threads = (uint32_t)atoi(argv[++arg]);
+    } else {
+      break;
+    }
+  }
+  if (classes < 1) classes = 1;
+  if (routines < 1) routines = 1;
+  if (methods < 1) methods = 1;
+  if (threads == 0) {
+    long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+    threads = cpus > 0 ? (uint32_t)cpus : 1;
+  }
+
+  struct Paths paths = {0};
+  uint64_t bytes = 0;
+  char directory[] = "/tmp/call_graph_bench.XXXXXX";
+  bool generated = arg >= argc;
+  char path[4096];
+  if (generated) {
+    if (!mkdtemp(directory)) {
+      perror("mkdtemp");
+      return 1;
+    }
+    struct Bench_Buffer buffer = {0};
+    for (int i = 0; i < classes + routines; i++) {
+      buffer.length = 0;
+      if (i < classes) {
+        generate_class(&buffer, i, classes, routines, methods);
+        snprintf(path, sizeof(path), "%s/Pkg%d.C%d.cls", directory, i % PACKAGES, i);
+      } else {
+        generate_routine(&buffer, i - classes, routines);
+        snprintf(path, sizeof(path), "%s/R%d.mac", directory, i - classes);
+      }
+      write_file(path, &buffer);
+      paths_push(&paths, path);
+      bytes += buffer.length;
+    }
+    Bench_Buffer_free(&buffer);
+  } else {
+    bool from_stdin = !strcmp(argv[arg], "-");
+    while (next_path(from_stdin, argc, argv, &arg, path, sizeof(path))) {
+      struct stat info;
+      if (stat(path, &info) != 0) {
+        perror(path);
+        continue;
+      }
+      paths_push(&paths, path);
+      bytes += (uint64_t)info.st_size;
+    }
+  }
+
+  const TSLanguage *udl = tree_sitter_objectscript_udl();
+  const TSLanguage *core = tree_sitter_objectscript_core();
+  const char *const *files = (const char *const *)paths.data;
+  printf("%u files, %.1f MB\n\n", paths.count, bytes / (1024.0 * 1024.0));
+
+  // One thread, then all of them, each into a new graph
+  struct ObjectScript_Call_Graph *graph = NULL;
+  struct ObjectScript_Call_Graph_Stats stats;
+  uint32_t runs[2] = {1, threads};
+  for (int run = 0; run < (threads > 1 ? 2 : 1); run++) {
+    ObjectScript_Call_Graph_delete(graph);
+    graph = ObjectScript_Call_Graph_new(udl, core);
+    double start = Bench_now_ms();
+    if (!ObjectScript_Call_Graph_add_files(graph, files, paths.count, runs[run])) {
+      fprintf(stderr, "some files could not be read\n");
+    }
+    double ms = Bench_now_ms() - start;
+    ObjectScript_Call_Graph_stats(graph, &stats);
+    char label[32];
+    snprintf(label, sizeof(label), "%u thread%s", runs[run], runs[run] == 1 ? "" : "s");
+    report(label, ms, paths.count, bytes, &stats);
+  }
+  printf("\n%u symbols, %u callers, %llu call sites, %llu distinct edges, %llu unresolved\n\n",
+         stats.symbols, stats.callers, (unsigned long long)stats.calls,
+         (unsigned long long)stats.edges, (unsigned long long)stats.unresolved);
+
+  // Impact of changing a widely used method
+  const char *target = "Bench.Util:Log";
+  uint32_t id = ObjectScript_Call_Graph_lookup(graph, target, (uint32_t)strlen(target));
+  if (id != OBJECTSCRIPT_CALL_NONE) {
+    uint32_t direct, count = 0;
+    ObjectScript_Call_Graph_callers(graph, id, &direct);
+    int iterations = 100;
+    double start = Bench_now_ms();
+    for (int i = 0; i < iterations; i++) {
+      ObjectScript_Call_Graph_closure(graph, id, true, ObjectScript_Call_all, &count);
+    }
+    printf("  callers of %s: %u direct, %u transitive in %.2f us\n", target, direct, count,
+           (Bench_now_ms() - start) * 1e3 / iterations);
+  }
+
+  // Re-read one file, as a watcher would on save
+  if (paths.count) {
+    const char *changed = files[paths.count / 2];
+    struct Bench_Buffer input = {0};
+    if (Bench_read_file(changed, &input)) {
+      size_t length = strlen(changed);
+      bool is_class = length > 4 && !strcmp(changed + length - 4, ".cls");
+      TSParser *parser = ts_parser_new();
+      ts_parser_set_language(parser, is_class ? udl : core);
+      int iterations = 100;
+      double parse_ms = 0, update_ms = 0;
+      for (int i = 0; i < iterations; i++) {
+        double start = Bench_now_ms();
+        TSTree *tree = ts_parser_parse_string(parser, NULL, input.data, input.length);
+        double parsed = Bench_now_ms();
+        ObjectScript_Call_Graph_update(graph, changed, tree, input.data, input.length);
+        update_ms += Bench_now_ms() - parsed;
+        parse_ms += parsed - start;
+        ts_tree_delete(tree);
+      }
+      printf("  one changed file: parse %.2f us, update %.2f us\n", parse_ms * 1e3 / iterations,
+             update_ms * 1e3 / iterations);
+      ts_parser_delete(parser);
+      Bench_Buffer_free(&input);
+    }
+  }
+
+  ObjectScript_Call_Graph_delete(graph);
+  for (uint32_t i = 0; i < paths.count; i++) {
+    if (generated) unlink(paths.data[i]);
+    free(paths.data[i]);
+  }
+  free(paths.data);
+  if (generated) rmdir(directory);
+  return 0;
+}
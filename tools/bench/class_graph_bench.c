@@ -0,0 +1,188 @@
+// Building and querying the class graph of a large code base
+//
+// Usage: class_graph_bench [-n classes] [-m methods] [file.cls...]
+//
+// Without input files, `classes` synthetic classes are generated: a 4-ary
+// inheritance tree under %Persistent, spread over 50 packages, each class
+// with properties, a relationship and a foreign key pointing at others and
+// `methods` method bodies for the extraction pass to skip.
+//
+// Reports the parse time, the targeted extraction pass against a plain walk
+// over every node (what each tool used to do), query latencies in
+// microseconds and the cost of re-reading one changed file.
+#include "bench.h"
+#include "grammars.h"
+#include "class_graph.h"
+
+#define PACKAGES 50
+
+static void class_name(char *buffer, size_t size, int i) {
+  snprintf(buffer, size, "Pkg%d.C%d", i % PACKAGES, i);
+}
+
+static void generate_class(struct Bench_Buffer *buffer, int i, int count, int methods) {
+  char name[64], parent[64], a[64], b[64];
+  class_name(name, sizeof(name), i);
+  class_name(parent, sizeof(parent), (i - 1) / 4);
+  class_name(a, sizeof(a), (i * 7 + 3) % count);
+  class_name(b, sizeof(b), (i * 13 + 5) % count);
+  Bench_Buffer_printf(buffer, "/// Class %d\nClass %s Extends (%s, %%XML.Adaptor)\n{\n\n",
+                      i, name, i ? parent : "%Persistent");
+  Bench_Buffer_printf(buffer,
+                      "Property Name As %%String(MAXLEN = 100) [ Required ];\n\n"
+                      "Property Ref As %s;\n\n"
+                      "Property Items As list Of %s;\n\n"
+                      "Relationship Owner As %s [ Cardinality = one, Inverse = Items ];\n\n"
+                      "ForeignKey OwnerFK(Ref) References %s(IDKEY);\n\n",
+                      a, b, a, b);
+  for (int m = 0; m < methods; m++) {
+    Bench_Buffer_printf(buffer, "Method M%d(pInput As %%String) As %%Status\n{\n", m);
+    Bench_generate_statements(buffer, m, "    ");
+    Bench_Buffer_printf(buffer, "}\n\n");
+  }
+  Bench_Buffer_printf(buffer, "}\n");
+}
+
+static uint64_t walk_tree(const TSTree *tree) {
+  uint64_t nodes = 0;
+  TSTreeCursor cursor = ts_tree_cursor_new(ts_tree_root_node(tree));
+  for (;;) {
+    nodes++;
+    if (ts_tree_cursor_goto_first_child(&cursor)) continue;
+    while (!ts_tree_cursor_goto_next_sibling(&cursor)) {
+      if (!ts_tree_cursor_goto_parent(&cursor)) {
+        ts_tree_cursor_delete(&cursor);
+        return nodes;
+      }
+    }
+  }
+}
+
+// Average microseconds of `iterations` runs of a query
+#define TIME_QUERY(label, iterations, expression)                                  \
+  do {                                                                             \
+    uint32_t found = 0;                                                            \
+    double start = Bench_now_ms();                                                 \
+    for (int q = 0; q < (iterations); q++) found = (expression);                   \
+    printf("  %-34s %9.2f us  (%u)\n", label,                                      \
+           (Bench_now_ms() - start) * 1e3 / (iterations), found);                  \
+  } while (0)
+
+static uint32_t closure_size(struct ObjectScript_Class_Graph *graph, uint32_t id, bool reverse,
+                             uint32_t kinds) {
+  uint32_t count;
+  ObjectScript_Class_Graph_closure(graph, id, reverse, kinds, &count);
+  return count;
+}
+
+int main(int argc, char **argv) {
+  int count = 40000;
+  int methods = 2;
+  const char *files[4096];
+  int file_count = 0;
+  for (int i = 1; i < argc; i++) {
+    if (!strcmp(argv[i], "-n") && i + 1 < argc) {
+      count = atoi(argv[++i]);
+    } else if (!strcmp(argv[i], "-m") && i + 1 < argc) {
+      methods = atoi(argv[++i]);
+    } else if (file_count < 4096) {
+      files[file_count++] = argv[i];
+    }
+  }
+  if (file_count) count = file_count;
+  if (count < 2) count = 2;
+
+  const TSLanguage *language = tree_sitter_objectscript_udl();
+  TSParser *parser = ts_parser_new();
+  ts_parser_set_language(parser, language);
+  struct ObjectScript_Class_Graph *graph = ObjectScript_Class_Graph_new(language);
+
+  double parse_ms = 0, walk_ms = 0, extract_ms = 0;
+  uint64_t bytes = 0, nodes = 0;
+  char path[64];
+  for (int i = 0; i < count; i++) {
+    struct Bench_Buffer input = {0};
+    if (file_count) {
+      if (!Bench_read_file(files[i], &input)) return 1;
+    } else {
+      generate_class(&input, i, count, methods);
+    }
+    snprintf(path, sizeof(path), "file%d.cls", i);
+
+    double start = Bench_now_ms();
+    TSTree *tree = ts_parser_parse_string(parser, NULL, input.data, input.length);
+    double parsed = Bench_now_ms();
+    nodes += walk_tree(tree);
+    double walked = Bench_now_ms();
+    if (!ObjectScript_Class_Graph_update(graph, file_count ? files[i] : path, tree, input.data,
+                                         input.length)) {
+      fprintf(stderr, "out of memory\n");
+      return 1;
+    }
+    extract_ms += Bench_now_ms() - walked;
+    walk_ms += walked - parsed;
+    parse_ms += parsed - start;
+    bytes += input.length;
+    ts_tree_delete(tree);
+    Bench_Buffer_free(&input);
+  }
+
+  struct ObjectScript_Class_Graph_Stats stats;
+  ObjectScript_Class_Graph_stats(graph, &stats);
+  printf("%d files, %.1f MB, %llu nodes: %u classes (%u defined), %llu edges\n\n", count,
+         bytes / (1024.0 * 1024.0), (unsigned long long)nodes, stats.classes, stats.defined,
+         (unsigned long long)stats.edges);
+  printf("  %-34s %9.1f ms\n", "parse", parse_ms);
+  printf("  %-34s %9.1f ms\n", "walk every node", walk_ms);
+  printf("  %-34s %9.1f ms  (%.1fx faster)\n\n", "extract edges", extract_ms,
+         walk_ms / extract_ms);
+
+  uint32_t root = ObjectScript_Class_Graph_lookup(graph, "%Library.Persistent", 19);
+  char name[64];
+  uint32_t name_length;
+
+  // With input files, the first and second defined classes stand in
+  class_name(name, sizeof(name), count - 1);
+  name_length = (uint32_t)strlen(name);
+  uint32_t leaf = file_count ? 0 : ObjectScript_Class_Graph_lookup(graph, name, name_length);
+  class_name(name, sizeof(name), 1);
+  name_length = (uint32_t)strlen(name);
+  uint32_t inner = file_count ? 1 : ObjectScript_Class_Graph_lookup(graph, name, name_length);
+
+  TIME_QUERY("lookup", 100000, ObjectScript_Class_Graph_lookup(graph, name, name_length));
+  TIME_QUERY("superclasses of a leaf", 100000, closure_size(graph, leaf, false,
+                                                            ObjectScript_Class_Edge_extends));
+  TIME_QUERY("is_subclass(leaf, %Persistent)", 100000,
+             ObjectScript_Class_Graph_is_subclass(graph, leaf, root));
+  TIME_QUERY("subclasses of an inner class", 1000, closure_size(graph, inner, true,
+                                                                ObjectScript_Class_Edge_extends));
+  TIME_QUERY("subclasses of %Persistent", 100, closure_size(graph, root, true,
+                                                            ObjectScript_Class_Edge_extends));
+  TIME_QUERY("dependencies of a leaf, all kinds", 1000, closure_size(graph, leaf, false,
+                                                                     ObjectScript_Class_Edge_all));
+
+  // Re-read one file, as a watcher would on save
+  if (!file_count) {
+    struct Bench_Buffer input = {0};
+    generate_class(&input, count / 2, count, methods);
+    snprintf(path, sizeof(path), "file%d.cls", count / 2);
+    int iterations = 200;
+    double reparse = 0, update = 0;
+    for (int i = 0; i < iterations; i++) {
+      double start = Bench_now_ms();
+      TSTree *tree = ts_parser_parse_string(parser, NULL, input.data, input.length);
+      double parsed = Bench_now_ms();
+      ObjectScript_Class_Graph_update(graph, path, tree, input.data, input.length);
+      update += Bench_now_ms() - parsed;
+      reparse += parsed - start;
+      ts_tree_delete(tree);
+    }
+    printf("\n  %-34s %9.2f us\n", "parse one changed file", reparse * 1e3 / iterations);
+    printf("  %-34s %9.2f us\n", "update the graph with it", update * 1e3 / iterations);
+    Bench_Buffer_free(&input);
+  }
+
+  ObjectScript_Class_Graph_delete(graph);
+  ts_parser_delete(parser);
+  return 0;
+}
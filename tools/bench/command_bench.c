@@ -0,0 +1,101 @@
+// Parsing command dense routines
+//
+// Usage: command_bench [-g core|udl] [-n lines] [-i iterations]
+//
+// Parses a generated routine of `lines` lines of short commands, several
+// to a line, in full and abbreviated spellings and mixed case (`s x=1 w x
+// d Tag q:x  k y`), and reports MB/s and commands/s.  Every command starts
+// with a keyword, so this is the input where recognizing them costs the
+// most; compare it with scripts/parser-stats.js before and after changing
+// how they are lexed.
+#include "bench.h"
+#include "grammars.h"
+
+static const char *const lines[] = {
+  " s x=1 w x,! d Tag1 q:x  k y",
+  " SET a=2,b=3 WRITE a+b,! IF a>b { SET c=a } ELSE { SET c=b }",
+  " n t s t=$h h 1 k t",
+  " Do Tag2^Routine(1) Quit:a=1  Set a=a+1",
+  " l +^Lock(1):1 e  w \"locked\",! l -^Lock(1)",
+  " f i=1:1:3 s ^G(i)=i  w i",
+  " m ^Copy=^G zw ^Copy TSTART  s x=1 TCOMMIT  ",
+  " r x:5 u 0 o dev:(\"R\"):1 c dev",
+  " try { s x=1/0 } catch ex { s sc=ex.AsStatus() }",
+  " do { s i=i+1 } while i<10",
+  " x \"s y=1\" j Tag3^Routine:(:4):10 g Tag1",
+  " zt \"Handler\" zb /clear zkill ^G(1) zzdump x",
+  " H 1 ret:x y  TRO  h",
+};
+
+static void generate(const struct Bench_Grammar *grammar, int count,
+                     struct Bench_Buffer *buffer) {
+  size_t line_count = sizeof(lines) / sizeof(lines[0]);
+  bool udl = !strcmp(grammar->name, "udl");
+  if (udl) Bench_Buffer_printf(buffer, "Class Bench.Commands\n{\n\nClassMethod M()\n{\n");
+  for (int i = 0; i < count; i++) {
+    if (!udl && i % 20 == 0) Bench_Buffer_printf(buffer, "Tag%d ; entry point\n", i / 20);
+    Bench_Buffer_printf(buffer, "%s\n", lines[(size_t)i % line_count]);
+  }
+  if (udl) Bench_Buffer_printf(buffer, "}\n\n}\n");
+}
+
+static uint32_t count_commands(TSNode root) {
+  TSTreeCursor cursor = ts_tree_cursor_new(root);
+  uint32_t count = 0;
+  for (;;) {
+    if (!strncmp(ts_node_type(ts_tree_cursor_current_node(&cursor)), "command_", 8)) count++;
+    if (ts_tree_cursor_goto_first_child(&cursor)) continue;
+    while (!ts_tree_cursor_goto_next_sibling(&cursor)) {
+      if (!ts_tree_cursor_goto_parent(&cursor)) {
+        ts_tree_cursor_delete(&cursor);
+        return count;
+      }
+    }
+  }
+}
+
+int main(int argc, char **argv) {
+  const struct Bench_Grammar *grammar = Bench_grammar("core");
+  int count = 50000;
+  int iterations = 10;
+  for (int arg = 1; arg < argc; arg++) {
+    if (!strcmp(argv[arg], "-g") && arg + 1 < argc) {
+      grammar = Bench_grammar(argv[++arg]);
+      if (!grammar || !strcmp(grammar->name, "expr")) {
+        fprintf(stderr, "unknown grammar %s, use core or udl\n", argv[arg]);
+        return 1;
+      }
+    } else if (!strcmp(argv[arg], "-n") && arg + 1 < argc) {
+      count = atoi(argv[++arg]);
+    } else if (!strcmp(argv[arg], "-i") && arg + 1 < argc) {
+      iterations = atoi(argv[++arg]);
+    }
+  }
+  if (count < 1) count = 1;
+  if (iterations < 1) iterations = 1;
+
+  struct Bench_Buffer buffer = {0};
+  generate(grammar, count, &buffer);
+  TSParser *parser = ts_parser_new();
+  ts_parser_set_language(parser, grammar->language());
+
+  double start = Bench_now_ms();
+  TSTree *tree = NULL;
+  for (int i = 0; i < iterations; i++) {
+    ts_tree_delete(tree);
+    tree = ts_parser_parse_string(parser, NULL, buffer.data, buffer.length);
+  }
+  double ms = (Bench_now_ms() - start) / iterations;
+  TSNode root = ts_tree_root_node(tree);
+  uint32_t commands = count_commands(root);
+
+  printf("%s grammar, %d lines, %.1f KB, %u commands%s\n\n", grammar->name, count,
+         buffer.length / 1024.0, commands, ts_node_has_error(root) ? " (has errors)" : "");
+  printf("  parse %9.2f ms  %7.1f MB/s  %10.0f commands/s\n", ms,
+         buffer.length / (1024.0 * 1024.0) / (ms / 1000.0), commands * 1000.0 / ms);
+
+  ts_tree_delete(tree);
+  ts_parser_delete(parser);
+  Bench_Buffer_free(&buffer);
+  return 0;
+}
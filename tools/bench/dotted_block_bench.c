@@ -0,0 +1,167 @@
+// Parsing legacy dotted DO blocks
+//
+// Usage: dotted_block_bench [-g core|udl] [-n lines] [-d depth] [-i iterations]
+//
+// Parses a generated routine of about `lines` lines of dotted code, with
+// argumentless `do` blocks nested `depth` dots deep:
+//
+//   Tag0 ; entry point
+//    do
+//    . set x=1
+//    . do
+//    . . write x,!
+//    . . quit:x>1
+//    . set y=x
+//
+// and reports MB/s, the size of the tree and how deep its dotted_block
+// nodes nest, then times a block scoped query (the quits of every block)
+// over it.  Each block is one node holding its statements, so the query
+// matches once per block instead of once per line.
+#include "bench.h"
+#include "grammars.h"
+
+static const char *const block_query =
+    "(dotted_block (statement (command_quit) @quit)) @block";
+
+static void dots(struct Bench_Buffer *buffer, int level) {
+  Bench_Buffer_printf(buffer, " ");
+  for (int i = 0; i < level; i++) Bench_Buffer_printf(buffer, ". ");
+}
+
+// One block at `level` and everything nested in it, `*lines` is the budget
+static void block(struct Bench_Buffer *buffer, int level, int depth, int *lines) {
+  dots(buffer, level);
+  Bench_Buffer_printf(buffer, "set x%d=%d\n", level, *lines);
+  (*lines)--;
+  if (level < depth && *lines > 0) {
+    dots(buffer, level);
+    Bench_Buffer_printf(buffer, "do\n");
+    (*lines)--;
+    block(buffer, level + 1, depth, lines);
+  }
+  dots(buffer, level);
+  Bench_Buffer_printf(buffer, "write x%d,!\n", level);
+  dots(buffer, level);
+  Bench_Buffer_printf(buffer, "quit:x%d>1\n", level);
+  *lines -= 2;
+}
+
+static void generate(const struct Bench_Grammar *grammar, int count, int depth,
+                     struct Bench_Buffer *buffer) {
+  bool udl = !strcmp(grammar->name, "udl");
+  if (udl) Bench_Buffer_printf(buffer, "Class Bench.Dotted\n{\n\nClassMethod M()\n{\n");
+  for (int tag = 0, lines = count; lines > 0; tag++) {
+    if (!udl) Bench_Buffer_printf(buffer, "Tag%d ; entry point\n", tag);
+    Bench_Buffer_printf(buffer, " do\n");
+    lines--;
+    block(buffer, 1, depth, &lines);
+    Bench_Buffer_printf(buffer, " quit\n");
+    lines--;
+  }
+  if (udl) Bench_Buffer_printf(buffer, "}\n\n}\n");
+}
+
+struct Counts {
+  uint32_t nodes;
+  uint32_t blocks;
+  uint32_t max_nesting;
+};
+
+static void walk(TSNode root, struct Counts *counts) {
+  TSTreeCursor cursor = ts_tree_cursor_new(root);
+  uint32_t nesting = 0;
+  for (;;) {
+    counts->nodes++;
+    if (!strcmp(ts_node_type(ts_tree_cursor_current_node(&cursor)), "dotted_block")) {
+      counts->blocks++;
+      nesting++;
+      if (nesting > counts->max_nesting) counts->max_nesting = nesting;
+    }
+    if (ts_tree_cursor_goto_first_child(&cursor)) continue;
+    for (;;) {
+      if (!strcmp(ts_node_type(ts_tree_cursor_current_node(&cursor)), "dotted_block")) {
+        nesting--;
+      }
+      if (ts_tree_cursor_goto_next_sibling(&cursor)) break;
+      if (!ts_tree_cursor_goto_parent(&cursor)) {
+        ts_tree_cursor_delete(&cursor);
+        return;
+      }
+    }
+  }
+}
+
+int main(int argc, char **argv) {
+  const struct Bench_Grammar *grammar = Bench_grammar("core");
+  int count = 50000;
+  int depth = 8;
+  int iterations = 10;
+  for (int arg = 1; arg < argc; arg++) {
+    if (!strcmp(argv[arg], "-g") && arg + 1 < argc) {
+      grammar = Bench_grammar(argv[++arg]);
+      if (!grammar || !strcmp(grammar->name, "expr")) {
+        fprintf(stderr, "unknown grammar %s, use core or udl\n", argv[arg]);
+        return 1;
+      }
+    } else if (!strcmp(argv[arg], "-n") && arg + 1 < argc) {
+      count = atoi(argv[++arg]);
+    } else if (!strcmp(argv[arg], "-d") && arg + 1 < argc) {
+      depth = atoi(argv[++arg]);
+    } else if (!strcmp(argv[arg], "-i") && arg + 1 < argc) {
+      iterations = atoi(argv[++arg]);
+    }
+  }
+  if (count < 1) count = 1;
+  if (depth < 1) depth = 1;
+  if (iterations < 1) iterations = 1;
+
+  struct Bench_Buffer buffer = {0};
+  generate(grammar, count, depth, &buffer);
+  TSParser *parser = ts_parser_new();
+  ts_parser_set_language(parser, grammar->language());
+
+  double start = Bench_now_ms();
+  TSTree *tree = NULL;
+  for (int i = 0; i < iterations; i++) {
+    ts_tree_delete(tree);
+    tree = ts_parser_parse_string(parser, NULL, buffer.data, buffer.length);
+  }
+  double parse_ms = (Bench_now_ms() - start) / iterations;
+  TSNode root = ts_tree_root_node(tree);
+  struct Counts counts = {0};
+  walk(root, &counts);
+
+  uint32_t error_offset;
+  TSQueryError error_type;
+  TSQuery *query = ts_query_new(grammar->language(), block_query,
+                                (uint32_t)strlen(block_query), &error_offset, &error_type);
+  if (!query) {
+    fprintf(stderr, "query error %d at %u\n", error_type, error_offset);
+    return 1;
+  }
+  TSQueryCursor *cursor = ts_query_cursor_new();
+  uint32_t matches = 0;
+  start = Bench_now_ms();
+  for (int i = 0; i < iterations; i++) {
+    TSQueryMatch match;
+    matches = 0;
+    ts_query_cursor_exec(cursor, query, root);
+    while (ts_query_cursor_next_match(cursor, &match)) matches++;
+  }
+  double query_ms = (Bench_now_ms() - start) / iterations;
+
+  printf("%s grammar, %d lines %d deep, %.1f KB%s\n\n", grammar->name, count, depth,
+         buffer.length / 1024.0, ts_node_has_error(root) ? " (has errors)" : "");
+  printf("  parse %9.2f ms  %7.1f MB/s\n", parse_ms,
+         buffer.length / (1024.0 * 1024.0) / (parse_ms / 1000.0));
+  printf("  tree  %9u nodes  %u dotted blocks nested %u deep\n", counts.nodes, counts.blocks,
+         counts.max_nesting);
+  printf("  query %9.2f ms  %u matches  %s\n", query_ms, matches, block_query);
+
+  ts_query_cursor_delete(cursor);
+  ts_query_delete(query);
+  ts_tree_delete(tree);
+  ts_parser_delete(parser);
+  Bench_Buffer_free(&buffer);
+  return 0;
+}
@@ -0,0 +1,130 @@
+// Tree depth of long operator chains
+//
+// Usage: expression_depth_bench [-g expr|core|udl] [-n iterations] [length...]
+//
+// Parses generated lines such as `set x = a0_a1_..._aN` with chains of
+// `length` operands (10 to 10000 by default) and reports, for each, the
+// depth and node count of the tree, the parse time and the time of a
+// recursive walk over ts_node_child() (what most exporters and visitors
+// do) next to a TSTreeCursor walk.  Expressions are a flat sequence of
+// operands and operators, so the depth should stay the same however long
+// the chain is; a growing depth means some rule nests again.
+#include "bench.h"
+#include "grammars.h"
+
+struct Chain {
+  const char *name;
+  const char *operators;   // Cycled through between the operands
+  const char *prefix;      // Before each operand
+};
+
+static const struct Chain chains[] = {
+  {"concatenation", "_", ""},
+  {"arithmetic", "+-*/\\#", ""},
+  {"comparison", "=<>&!", ""},
+  {"unary operands", "_", "-"},
+};
+
+static void generate_chain(const struct Bench_Grammar *grammar, const struct Chain *chain,
+                           int length, struct Bench_Buffer *buffer) {
+  buffer->length = 0;
+  bool udl = !strcmp(grammar->name, "udl");
+  bool core = !strcmp(grammar->name, "core");
+  if (udl) Bench_Buffer_printf(buffer, "Class Bench.Depth\n{\n\nClassMethod M()\n{\n");
+  if (udl || core) Bench_Buffer_printf(buffer, " set x = ");
+  size_t operator_count = strlen(chain->operators);
+  for (int i = 0; i < length; i++) {
+    if (i) Bench_Buffer_printf(buffer, "%c", chain->operators[(i - 1) % operator_count]);
+    Bench_Buffer_printf(buffer, "%sa%d", chain->prefix, i);
+  }
+  if (udl || core) Bench_Buffer_printf(buffer, "\n");
+  if (udl) Bench_Buffer_printf(buffer, "}\n\n}\n");
+}
+
+static uint32_t recursive_walk(TSNode node, uint32_t depth, uint32_t *max_depth) {
+  if (depth > *max_depth) *max_depth = depth;
+  uint32_t count = 1;
+  uint32_t child_count = ts_node_child_count(node);
+  for (uint32_t i = 0; i < child_count; i++) {
+    count += recursive_walk(ts_node_child(node, i), depth + 1, max_depth);
+  }
+  return count;
+}
+
+static uint32_t cursor_walk(TSNode root) {
+  TSTreeCursor cursor = ts_tree_cursor_new(root);
+  uint32_t count = 0;
+  for (;;) {
+    count++;
+    if (ts_tree_cursor_goto_first_child(&cursor)) continue;
+    while (!ts_tree_cursor_goto_next_sibling(&cursor)) {
+      if (!ts_tree_cursor_goto_parent(&cursor)) {
+        ts_tree_cursor_delete(&cursor);
+        return count;
+      }
+    }
+  }
+}
+
+int main(int argc, char **argv) {
+  const struct Bench_Grammar *grammar = Bench_grammar("core");
+  int iterations = 20;
+  int lengths[32];
+  int length_count = 0;
+  for (int arg = 1; arg < argc; arg++) {
+    if (!strcmp(argv[arg], "-g") && arg + 1 < argc) {
+      grammar = Bench_grammar(argv[++arg]);
+      if (!grammar) {
+        fprintf(stderr, "unknown grammar %s\n", argv[arg]);
+        return 1;
+      }
+    } else if (!strcmp(argv[arg], "-n") && arg + 1 < argc) {
+      iterations = atoi(argv[++arg]);
+    } else if (length_count < 32) {
+      lengths[length_count++] = atoi(argv[arg]);
+    }
+  }
+  if (iterations < 1) iterations = 1;
+  if (!length_count) {
+    int defaults[] = {10, 100, 1000, 10000};
+    for (; length_count < 4; length_count++) lengths[length_count] = defaults[length_count];
+  }
+
+  TSParser *parser = ts_parser_new();
+  ts_parser_set_language(parser, grammar->language());
+  struct Bench_Buffer buffer = {0};
+  printf("%s grammar, %d iterations\n\n", grammar->name, iterations);
+  printf("  %-15s %8s %7s %9s %10s %12s %12s\n", "chain", "operands", "depth", "nodes",
+         "parse ms", "recursive us", "cursor us");
+  for (size_t c = 0; c < sizeof(chains) / sizeof(chains[0]); c++) {
+    for (int l = 0; l < length_count; l++) {
+      generate_chain(grammar, &chains[c], lengths[l], &buffer);
+
+      double start = Bench_now_ms();
+      TSTree *tree = NULL;
+      for (int i = 0; i < iterations; i++) {
+        ts_tree_delete(tree);
+        tree = ts_parser_parse_string(parser, NULL, buffer.data, buffer.length);
+      }
+      double parse_ms = (Bench_now_ms() - start) / iterations;
+      TSNode root = ts_tree_root_node(tree);
+
+      uint32_t depth = 0, nodes = 0;
+      start = Bench_now_ms();
+      for (int i = 0; i < iterations; i++) nodes = recursive_walk(root, 0, &depth);
+      double recursive_us = (Bench_now_ms() - start) * 1e3 / iterations;
+
+      start = Bench_now_ms();
+      for (int i = 0; i < iterations; i++) cursor_walk(root);
+      double cursor_us = (Bench_now_ms() - start) * 1e3 / iterations;
+
+      printf("  %-15s %8d %7u %9u %10.3f %12.1f %12.1f%s\n", chains[c].name, lengths[l], depth,
+             nodes, parse_ms, recursive_us, cursor_us,
+             ts_node_has_error(root) ? "  (has errors)" : "");
+      ts_tree_delete(tree);
+    }
+  }
+  Bench_Buffer_free(&buffer);
+  ts_parser_delete(parser);
+  return 0;
+}
@@ -0,0 +1,85 @@
+#!/usr/bin/env node
+/**
+ * Compare reading a tree in Node from the flat binary format and from a JSON
+ * dump: load time, and counting the nodes of one type.
+ *
+ * Usage: node bench/flat_tree.js <prefix> [type]
+ *
+ * Write the two files first with `build/flat_tree_bench -o <prefix>`.
+ */
+
+/* eslint-disable camelcase */
+// @ts-check
+
+const fs = require('fs');
+const { FlatTree } = require('../flat_tree');
+
+const ITERATIONS = 10;
+
+/**
+ * @param {string} name
+ * @param {() => number} run
+ * @return {number} what run() returned
+ */
+function time(name, run) {
+  let result = 0;
+  const start = process.hrtime.bigint();
+  for (let i = 0; i < ITERATIONS; i++) {
+    result = run();
+  }
+  const ms = Number(process.hrtime.bigint() - start) / 1e6 / ITERATIONS;
+  console.log(`  ${name.padEnd(22)} ${ms.toFixed(3).padStart(9)} ms`);
+  return result;
+}
+
+/**
+ * @param {any} node a node of the JSON dump
+ * @param {string} type
+ * @return {number}
+ */
+function count_json(node, type) {
+  let count = node.type === type && node.named ? 1 : 0;
+  for (const child of node.children || []) {
+    count += count_json(child, type);
+  }
+  return count;
+}
+
+function main() {
+  const [prefix, type = 'identifier'] = process.argv.slice(2);
+  if (!prefix) {
+    console.error('usage: node bench/flat_tree.js <prefix> [type]');
+    process.exit(2);
+  }
+  const json = fs.readFileSync(`${prefix}.json`, 'utf8');
+  const flat = fs.readFileSync(`${prefix}.flat`);
+  console.log(`json ${(json.length / 1048576).toFixed(1)} MB, flat ${(flat.length / 1048576).toFixed(1)} MB\n`);
+
+  time('JSON.parse', () => JSON.parse(json).children.length);
+  time('FlatTree.from', () => FlatTree.from(flat).nodeCount);
+
+  const root = JSON.parse(json);
+  const tree = FlatTree.from(flat);
+  const symbol = tree.symbolForName(type);
+  const in_json = time('walk json', () => count_json(root, type));
+  const in_flat = time('walk flat', () => {
+    let count = 0;
+    for (let i = 0; i < tree.nodeCount; i++) {
+      if (tree.symbol(i) === symbol) count++;
+    }
+    return count;
+  });
+  const total = time('parse + walk json', () => count_json(JSON.parse(json), type));
+  time('open + walk flat', () => {
+    const view = FlatTree.from(flat);
+    const wanted = view.symbolForName(type);
+    let count = 0;
+    for (let i = 0; i < view.nodeCount; i++) {
+      if (view.symbol(i) === wanted) count++;
+    }
+    return count;
+  });
+  console.log(`\n  ${in_flat} ${type} nodes (${in_json === in_flat && total === in_flat ? 'ok' : 'MISMATCH'})`);
+}
+
+main();
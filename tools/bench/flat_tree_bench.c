@@ -0,0 +1,279 @@
+// Flat binary export vs. a JSON dump of the same tree
+//
+// Usage: flat_tree_bench [-g expr|core|udl] [-s size] [-i iterations]
+//                        [-t type] [-o prefix] [file...]
+//
+// Reports, for the whole input:
+//
+//   size    bytes of each format, and relative to the source
+//   export  time to serialize the TSTree into each format
+//   open    time to validate the flat buffer (the whole "load" step)
+//   walk    counting the nodes of `type` on the TSTree and on the flat view
+//
+// With -o the last input's tree is also written to <prefix>.flat and
+// <prefix>.json, for bench/flat_tree.js to compare the readers in Node.
+//
+// Without input files, one synthetic source of `size` members is generated.
+#include "bench.h"
+#include "grammars.h"
+#include "flat_tree.h"
+
+static void json_string(struct Bench_Buffer *buffer, const char *string) {
+  Bench_Buffer_reserve(buffer, (uint32_t)strlen(string) * 6 + 2);
+  char *out = &buffer->data[buffer->length];
+  *out++ = '"';
+  for (const char *c = string; *c; c++) {
+    if (*c == '"' || *c == '\\') {
+      *out++ = '\\';
+      *out++ = *c;
+    } else if ((unsigned char)*c < 0x20) {
+      out += sprintf(out, "\\u%04x", *c);
+    } else {
+      *out++ = *c;
+    }
+  }
+  *out++ = '"';
+  buffer->length = (uint32_t)(out - buffer->data);
+}
+
+// The usual CST dump shape: type, field, byte and point ranges, children
+static void json_export(const TSTree *tree, struct Bench_Buffer *buffer) {
+  TSTreeCursor cursor = ts_tree_cursor_new(ts_tree_root_node(tree));
+  for (;;) {
+    TSNode node = ts_tree_cursor_current_node(&cursor);
+    TSPoint start = ts_node_start_point(node), end = ts_node_end_point(node);
+    Bench_Buffer_printf(buffer, "{\"type\":");
+    json_string(buffer, ts_node_type(node));
+    const char *field = ts_tree_cursor_current_field_name(&cursor);
+    if (field) {
+      Bench_Buffer_printf(buffer, ",\"field\":");
+      json_string(buffer, field);
+    }
+    Bench_Buffer_printf(buffer,
+                        ",\"named\":%s,\"startIndex\":%u,\"endIndex\":%u,"
+                        "\"startPosition\":{\"row\":%u,\"column\":%u},"
+                        "\"endPosition\":{\"row\":%u,\"column\":%u}",
+                        ts_node_is_named(node) ? "true" : "false", ts_node_start_byte(node),
+                        ts_node_end_byte(node), start.row, start.column, end.row, end.column);
+
+    if (ts_tree_cursor_goto_first_child(&cursor)) {
+      Bench_Buffer_printf(buffer, ",\"children\":[");
+      continue;
+    }
+    Bench_Buffer_printf(buffer, "}");
+    for (;;) {
+      if (ts_tree_cursor_goto_next_sibling(&cursor)) {
+        Bench_Buffer_printf(buffer, ",");
+        break;
+      }
+      if (!ts_tree_cursor_goto_parent(&cursor)) {
+        ts_tree_cursor_delete(&cursor);
+        return;
+      }
+      Bench_Buffer_printf(buffer, "]}");
+    }
+  }
+}
+
+static uint64_t count_tree(const TSTree *tree, TSSymbol symbol) {
+  uint64_t count = 0;
+  TSTreeCursor cursor = ts_tree_cursor_new(ts_tree_root_node(tree));
+  for (;;) {
+    if (ts_node_symbol(ts_tree_cursor_current_node(&cursor)) == symbol) count++;
+    if (ts_tree_cursor_goto_first_child(&cursor)) continue;
+    while (!ts_tree_cursor_goto_next_sibling(&cursor)) {
+      if (!ts_tree_cursor_goto_parent(&cursor)) {
+        ts_tree_cursor_delete(&cursor);
+        return count;
+      }
+    }
+  }
+}
+
+static uint64_t count_flat(const struct ObjectScript_Flat_Tree *view, uint16_t symbol) {
+  uint64_t count = 0;
+  for (uint32_t i = 0; i < view->node_count; i++) {
+    if (view->nodes[i].symbol == symbol) count++;
+  }
+  return count;
+}
+
+static void report(const char *name, double ms, int iterations, uint64_t bytes) {
+  double each = ms / iterations;
+  printf("  %-22s %9.3f ms  %8.1f MB/s\n", name, each,
+         bytes / (1024.0 * 1024.0) / (each / 1e3));
+}
+
+static bool write_file(const char *path, const void *data, size_t length) {
+  FILE *file = fopen(path, "wb");
+  if (!file) {
+    perror(path);
+    return false;
+  }
+  bool ok = fwrite(data, 1, length, file) == length;
+  fclose(file);
+  return ok;
+}
+
+int main(int argc, char **argv) {
+  const char *grammar_name = "udl";
+  const char *type = "identifier";
+  const char *prefix = NULL;
+  int size = 2000;
+  int iterations = 10;
+  const char *files[4096];
+  int file_count = 0;
+
+  for (int i = 1; i < argc; i++) {
+    if (!strcmp(argv[i], "-g") && i + 1 < argc) {
+      grammar_name = argv[++i];
+    } else if (!strcmp(argv[i], "-s") && i + 1 < argc) {
+      size = atoi(argv[++i]);
+    } else if (!strcmp(argv[i], "-i") && i + 1 < argc) {
+      iterations = atoi(argv[++i]);
+    } else if (!strcmp(argv[i], "-t") && i + 1 < argc) {
+      type = argv[++i];
+    } else if (!strcmp(argv[i], "-o") && i + 1 < argc) {
+      prefix = argv[++i];
+    } else if (file_count < 4096) {
+      files[file_count++] = argv[i];
+    }
+  }
+  if (iterations < 1) iterations = 1;
+
+  const struct Bench_Grammar *grammar = Bench_grammar(grammar_name);
+  if (!grammar) {
+    fprintf(stderr, "unknown grammar '%s' (expr, core or udl)\n", grammar_name);
+    return 2;
+  }
+  const TSLanguage *language = grammar->language();
+  TSSymbol symbol = ts_language_symbol_for_name(language, type, (uint32_t)strlen(type), true);
+  if (!symbol) {
+    fprintf(stderr, "unknown node type '%s'\n", type);
+    return 2;
+  }
+
+  int count = file_count ? file_count : 1;
+  struct Bench_Buffer *inputs =
+      (struct Bench_Buffer *)calloc(count, sizeof(struct Bench_Buffer));
+  TSTree **trees = (TSTree **)calloc(count, sizeof(TSTree *));
+  TSParser *parser = ts_parser_new();
+  ts_parser_set_language(parser, language);
+  uint64_t source_bytes = 0;
+  for (int i = 0; i < count; i++) {
+    if (file_count) {
+      if (!Bench_read_file(files[i], &inputs[i])) return 1;
+    } else {
+      Bench_generate(grammar, &inputs[i], size);
+    }
+    source_bytes += inputs[i].length;
+    trees[i] = ts_parser_parse_string(parser, NULL, inputs[i].data, inputs[i].length);
+  }
+
+  // Sizes, and the buffers the read side works on
+  uint64_t json_bytes = 0, flat_bytes = 0, named_bytes = 0, node_count = 0;
+  void **flats = (void **)calloc(count, sizeof(void *));
+  size_t *flat_lengths = (size_t *)calloc(count, sizeof(size_t));
+  for (int i = 0; i < count; i++) {
+    struct Bench_Buffer json = {0};
+    json_export(trees[i], &json);
+    json_bytes += json.length;
+    flats[i] = ObjectScript_Flat_Tree_export(trees[i], inputs[i].length, 0, &flat_lengths[i]);
+    if (!flats[i]) {
+      fprintf(stderr, "export failed\n");
+      return 1;
+    }
+    flat_bytes += flat_lengths[i];
+    size_t length;
+    void *named =
+        ObjectScript_Flat_Tree_export(trees[i], inputs[i].length,
+                                      ObjectScript_Flat_Export_named_only, &length);
+    named_bytes += length;
+    free(named);
+
+    struct ObjectScript_Flat_Tree view;
+    ObjectScript_Flat_Tree_open(&view, flats[i], flat_lengths[i]);
+    node_count += view.node_count;
+
+    if (prefix && i == count - 1) {
+      char path[1024];
+      snprintf(path, sizeof(path), "%s.json", prefix);
+      if (!write_file(path, json.data, json.length)) return 1;
+      snprintf(path, sizeof(path), "%s.flat", prefix);
+      if (!write_file(path, flats[i], flat_lengths[i])) return 1;
+      printf("wrote %s.json and %s.flat\n", prefix, prefix);
+    }
+    Bench_Buffer_free(&json);
+  }
+
+  printf("%s: %d input(s), %.1f MB of source, %llu nodes\n\n", grammar->name, count,
+         source_bytes / (1024.0 * 1024.0), (unsigned long long)node_count);
+  printf("  %-22s %9.1f MB  %6.1fx the source\n", "json", json_bytes / (1024.0 * 1024.0),
+         json_bytes / (double)source_bytes);
+  printf("  %-22s %9.1f MB  %6.1fx the source\n", "flat", flat_bytes / (1024.0 * 1024.0),
+         flat_bytes / (double)source_bytes);
+  printf("  %-22s %9.1f MB  %6.1fx the source\n\n", "flat, named only",
+         named_bytes / (1024.0 * 1024.0), named_bytes / (double)source_bytes);
+
+  // Throughput is per MB of source, so the rows compare directly
+  double start = Bench_now_ms();
+  for (int n = 0; n < iterations; n++) {
+    for (int i = 0; i < count; i++) {
+      struct Bench_Buffer json = {0};
+      json_export(trees[i], &json);
+      Bench_Buffer_free(&json);
+    }
+  }
+  report("export json", Bench_now_ms() - start, iterations, source_bytes);
+
+  start = Bench_now_ms();
+  for (int n = 0; n < iterations; n++) {
+    for (int i = 0; i < count; i++) {
+      size_t length;
+      free(ObjectScript_Flat_Tree_export(trees[i], inputs[i].length, 0, &length));
+    }
+  }
+  report("export flat", Bench_now_ms() - start, iterations, source_bytes);
+
+  start = Bench_now_ms();
+  uint32_t opened = 0;
+  for (int n = 0; n < iterations; n++) {
+    for (int i = 0; i < count; i++) {
+      struct ObjectScript_Flat_Tree view;
+      opened += ObjectScript_Flat_Tree_open(&view, flats[i], flat_lengths[i]);
+    }
+  }
+  report("open flat", Bench_now_ms() - start, iterations, source_bytes);
+
+  uint64_t found = 0;
+  start = Bench_now_ms();
+  for (int n = 0; n < iterations; n++) {
+    for (int i = 0; i < count; i++) found += count_tree(trees[i], symbol);
+  }
+  report("walk TSTree", Bench_now_ms() - start, iterations, source_bytes);
+
+  uint64_t flat_found = 0;
+  start = Bench_now_ms();
+  for (int n = 0; n < iterations; n++) {
+    for (int i = 0; i < count; i++) {
+      struct ObjectScript_Flat_Tree view;
+      ObjectScript_Flat_Tree_open(&view, flats[i], flat_lengths[i]);
+      flat_found += count_flat(&view, ObjectScript_Flat_Tree_symbol_for_name(&view, type, true));
+    }
+  }
+  report("open + walk flat", Bench_now_ms() - start, iterations, source_bytes);
+  printf("\n  %llu %s nodes (%s)\n", (unsigned long long)(found / iterations), type,
+         found == flat_found && opened == (uint32_t)(count * iterations) ? "ok" : "MISMATCH");
+
+  ts_parser_delete(parser);
+  for (int i = 0; i < count; i++) {
+    ts_tree_delete(trees[i]);
+    free(flats[i]);
+    Bench_Buffer_free(&inputs[i]);
+  }
+  free(trees);
+  free(flats);
+  free(flat_lengths);
+  free(inputs);
+  return 0;
+}
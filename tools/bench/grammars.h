@@ -0,0 +1,137 @@
+#ifndef OBJECTSCRIPT_BENCH_GRAMMARS_H_
+#define OBJECTSCRIPT_BENCH_GRAMMARS_H_
+
+// The three grammars and how their queries are layered.  This mirrors
+// tree-sitter.json, where each query category is the concatenation of the
+// expr, core and udl files (`;; inherits: ...`).
+
+#include <tree_sitter/api.h>
+#include "bench.h"
+#include "tree-sitter-objectscript_core.h"
+#include "tree-sitter-objectscript_expr.h"
+#include "tree-sitter-objectscript_udl.h"
+
+#define BENCH_MAX_LAYERS 3
+
+struct Bench_Grammar {
+  const char *name;
+  const TSLanguage *(*language)(void);
+  const char *layers[BENCH_MAX_LAYERS];   // Base first
+  int layer_count;
+};
+
+static const struct Bench_Grammar Bench_grammars[] = {
+  {"expr", tree_sitter_objectscript_expr, {"expr"}, 1},
+  {"core", tree_sitter_objectscript_core, {"expr", "core"}, 2},
+  {"udl", tree_sitter_objectscript_udl, {"expr", "core", "udl"}, 3},
+};
+
+static inline const struct Bench_Grammar *Bench_grammar(const char *name) {
+  for (size_t i = 0; i < sizeof(Bench_grammars) / sizeof(Bench_grammars[0]); i++) {
+    if (!strcmp(Bench_grammars[i].name, name)) return &Bench_grammars[i];
+  }
+  return NULL;
+}
+
+// Concatenate <root>/<layer>/queries/<category>.scm for every layer, the
+// same way tree-sitter.json does.  Missing files are skipped.
+static inline void Bench_load_query(const struct Bench_Grammar *grammar,
+                                    const char *root, const char *category,
+                                    struct Bench_Buffer *buffer) {
+  for (int i = 0; i < grammar->layer_count; i++) {
+    char path[1024];
+    snprintf(path, sizeof(path), "%s/%s/queries/%s.scm", root,
+             grammar->layers[i], category);
+    FILE *file = fopen(path, "rb");
+    if (!file) continue;
+    fclose(file);
+    Bench_read_file(path, buffer);
+    Bench_Buffer_printf(buffer, "\n");
+  }
+}
+
+// Read <root>/<grammar>/queries/merged/<category>.scm, the bundle written
+// by scripts/merge-queries.js.  Returns false if it hasn't been generated.
+static inline bool Bench_load_merged_query(const struct Bench_Grammar *grammar,
+                                           const char *root, const char *category,
+                                           struct Bench_Buffer *buffer) {
+  char path[1024];
+  snprintf(path, sizeof(path), "%s/%s/queries/merged/%s.scm", root,
+           grammar->name, category);
+  FILE *file = fopen(path, "rb");
+  if (!file) return false;
+  fclose(file);
+  return Bench_read_file(path, buffer);
+}
+
+// Synthetic inputs, sized by `count` (methods, tags or operands), for when
+// no real sources are given on the command line
+
+static inline void Bench_generate_statements(struct Bench_Buffer *buffer, int i,
+                                             const char *indent) {
+  Bench_Buffer_printf(
+      buffer,
+      "%sset tSC = $$$OK, pOutput = {\"name\": \"item%d\", \"items\": [1, 2, 3]}\n"
+      "%stry {\n"
+      "%s  for i=1:1:$length(pInput, \",\") {\n"
+      "%s    set tPiece = $piece(pInput, \",\", i)\n"
+      "%s    if tPiece = \"\" { continue }\n"
+      "%s    set ^Bench.Data(%d, i) = $listbuild(tPiece, $zconvert(tPiece, \"U\"), i * 2 + 1)\n"
+      "%s    do ..Helper(.tPiece, i), ##class(Bench.Util).Log(\"step\", i)\n"
+      "%s    write !, \"Piece \", i, \": \", tPiece  // trace\n"
+      "%s  }\n"
+      "%s  &sql(SELECT Name INTO :tName FROM Sample.Person WHERE ID = :pId)\n"
+      "%s  set tObj = ##class(%%DynamicObject).%%New(), tObj.Count = tObj.Count + 1\n"
+      "%s  set x = $$Compute^Bench.Routine(i, tPiece) _ $get(^Bench.Cache(i), \"\")\n"
+      "%s} catch ex {\n"
+      "%s  set tSC = ex.AsStatus()\n"
+      "%s}\n"
+      "%squit tSC\n",
+      indent, i, indent, indent, indent, indent, indent, i, indent, indent,
+      indent, indent, indent, indent, indent, indent, indent, indent);
+}
+
+static inline void Bench_generate_class(struct Bench_Buffer *buffer, int methods) {
+  Bench_Buffer_printf(buffer,
+                      "Include Bench\n\n"
+                      "/// Synthetic class for benchmarking\n"
+                      "Class Bench.Large Extends (%%Persistent, Bench.Base) [ ProcedureBlock ]\n{\n\n"
+                      "Parameter VERSION = 3;\n\n");
+  for (int i = 0; i < methods; i++) {
+    Bench_Buffer_printf(buffer,
+                        "Property Prop%d As %%String(MAXLEN = 200) [ Required ];\n\n"
+                        "/// Method %d\n"
+                        "ClassMethod Method%d(pInput As %%String, Output pOutput As %%DynamicObject) As %%Status\n{\n",
+                        i, i, i);
+    Bench_generate_statements(buffer, i, "    ");
+    Bench_Buffer_printf(buffer, "}\n\n");
+  }
+  Bench_Buffer_printf(buffer, "}\n");
+}
+
+static inline void Bench_generate_routine(struct Bench_Buffer *buffer, int tags) {
+  for (int i = 0; i < tags; i++) {
+    Bench_Buffer_printf(buffer, "Tag%d ; entry point %d\n", i, i);
+    Bench_generate_statements(buffer, i, " ");
+  }
+}
+
+static inline void Bench_generate_expression(struct Bench_Buffer *buffer, int operands) {
+  for (int i = 0; i < operands; i++) {
+    Bench_Buffer_printf(buffer, "%s$piece(tList%d, \",\", %d) _ \"x\" + (a%d * 2)",
+                        i ? " _ " : "", i, i % 7 + 1, i);
+  }
+}
+
+static inline void Bench_generate(const struct Bench_Grammar *grammar,
+                                  struct Bench_Buffer *buffer, int count) {
+  if (!strcmp(grammar->name, "udl")) {
+    Bench_generate_class(buffer, count);
+  } else if (!strcmp(grammar->name, "core")) {
+    Bench_generate_routine(buffer, count);
+  } else {
+    Bench_generate_expression(buffer, count);
+  }
+}
+
+#endif // OBJECTSCRIPT_BENCH_GRAMMARS_H_
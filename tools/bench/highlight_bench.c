@@ -0,0 +1,227 @@
+// Highlighting throughput of src/highlighter.h
+//
+// Usage: highlight_bench [-g expr|core|udl] [-n count] [-i iterations]
+//                        [-t threads] [-r repo] [-x] [file...]
+//
+// Highlights the files given (or a generated class, routine or expression
+// of `count` methods, tags or operands) with the layered highlights.scm,
+// the query compiled once, and reports MB/s for:
+//
+//   parse+highlight  what a server does per request
+//   highlight        over a tree it already has
+//   range            a 4 KB window in the middle of each input
+//   threads          parse+highlight from `threads` threads sharing the
+//                    query, each with its own highlighter
+//
+// With -x (udl only), the same inputs are written to .cls files and run
+// through `tree-sitter highlight --quiet` for comparison; that needs the
+// tree-sitter CLI on the PATH with this repo in its grammar search path
+// (`tree-sitter init-config`), and its time includes starting the process
+// and compiling the queries and injections each time, which is the point.
+#include "bench.h"
+#include "grammars.h"
+#include "highlighter.h"
+#include <pthread.h>
+#include <unistd.h>
+
+#define MAX_INPUTS 256
+#define RANGE_BYTES 4096
+
+struct Inputs {
+  struct Bench_Buffer texts[MAX_INPUTS];
+  int count;
+  uint64_t bytes;
+};
+
+struct Worker {
+  const struct ObjectScript_Highlight_Query *query;
+  const struct Inputs *inputs;
+  int iterations;
+  uint64_t spans;
+  pthread_t thread;
+};
+
+static void *worker(void *payload) {
+  struct Worker *work = (struct Worker *)payload;
+  struct ObjectScript_Highlighter *highlighter = ObjectScript_Highlighter_new(work->query);
+  for (int n = 0; n < work->iterations; n++) {
+    for (int i = 0; i < work->inputs->count; i++) {
+      uint32_t count = 0;
+      ObjectScript_Highlighter_highlight(highlighter, work->inputs->texts[i].data,
+                                         work->inputs->texts[i].length, 0, UINT32_MAX, &count);
+      work->spans += count;
+    }
+  }
+  ObjectScript_Highlighter_delete(highlighter);
+  return NULL;
+}
+
+static double mb_per_s(uint64_t bytes, double ms) {
+  return bytes / (1024.0 * 1024.0) / (ms / 1000.0);
+}
+
+// Average ms of `tree-sitter highlight` over every input, -1 if it fails
+static double time_cli(const struct Inputs *inputs, int iterations) {
+  char paths[MAX_INPUTS][64];
+  for (int i = 0; i < inputs->count; i++) {
+    snprintf(paths[i], sizeof(paths[i]), "/tmp/highlight_bench_%d_%d.cls", (int)getpid(), i);
+    FILE *file = fopen(paths[i], "wb");
+    if (!file) return -1;
+    fwrite(inputs->texts[i].data, 1, inputs->texts[i].length, file);
+    fclose(file);
+  }
+  double ms = -1;
+  double start = Bench_now_ms();
+  for (int n = 0; n < iterations; n++) {
+    for (int i = 0; i < inputs->count; i++) {
+      char command[256];
+      snprintf(command, sizeof(command), "tree-sitter highlight --quiet %s >/dev/null 2>&1",
+               paths[i]);
+      if (system(command) != 0) goto done;
+    }
+  }
+  ms = (Bench_now_ms() - start) / iterations;
+done:
+  for (int i = 0; i < inputs->count; i++) remove(paths[i]);
+  return ms;
+}
+
+int main(int argc, char **argv) {
+  const struct Bench_Grammar *grammar = Bench_grammar("udl");
+  const char *root = "..";
+  int count = 500;
+  int iterations = 10;
+  int threads = 8;
+  bool cli = false;
+  static struct Inputs inputs;
+  for (int arg = 1; arg < argc; arg++) {
+    if (!strcmp(argv[arg], "-g") && arg + 1 < argc) {
+      grammar = Bench_grammar(argv[++arg]);
+      if (!grammar) {
+        fprintf(stderr, "unknown grammar %s\n", argv[arg]);
+        return 1;
+      }
+    } else if (!strcmp(argv[arg], "-n") && arg + 1 < argc) {
+      count = atoi(argv[++arg]);
+    } else if (!strcmp(argv[arg], "-i") && arg + 1 < argc) {
+      iterations = atoi(argv[++arg]);
+    } else if (!strcmp(argv[arg], "-t") && arg + 1 < argc) {
+      threads = atoi(argv[++arg]);
+    } else if (!strcmp(argv[arg], "-r") && arg + 1 < argc) {
+      root = argv[++arg];
+    } else if (!strcmp(argv[arg], "-x")) {
+      cli = true;
+    } else if (inputs.count < MAX_INPUTS) {
+      if (!Bench_read_file(argv[arg], &inputs.texts[inputs.count++])) return 1;
+    }
+  }
+  if (count < 1) count = 1;
+  if (iterations < 1) iterations = 1;
+  if (threads < 1) threads = 1;
+  if (!inputs.count) Bench_generate(grammar, &inputs.texts[inputs.count++], count);
+  for (int i = 0; i < inputs.count; i++) inputs.bytes += inputs.texts[i].length;
+
+  struct Bench_Buffer source = {0};
+  if (!Bench_load_merged_query(grammar, root, "highlights", &source)) {
+    Bench_load_query(grammar, root, "highlights", &source);
+  }
+  uint32_t error_offset;
+  TSQueryError error_type;
+  double start = Bench_now_ms();
+  struct ObjectScript_Highlight_Query *query = ObjectScript_Highlight_Query_new(
+      grammar->language(), source.data, source.length, NULL, 0, &error_offset, &error_type);
+  double compile_ms = Bench_now_ms() - start;
+  if (!query) {
+    fprintf(stderr, "%s/highlights: query error %d at offset %u\n", grammar->name, error_type,
+            error_offset);
+    return 1;
+  }
+  struct ObjectScript_Highlighter *highlighter = ObjectScript_Highlighter_new(query);
+
+  // parse+highlight
+  uint64_t spans = 0;
+  start = Bench_now_ms();
+  for (int n = 0; n < iterations; n++) {
+    spans = 0;
+    for (int i = 0; i < inputs.count; i++) {
+      uint32_t span_count = 0;
+      ObjectScript_Highlighter_highlight(highlighter, inputs.texts[i].data,
+                                         inputs.texts[i].length, 0, UINT32_MAX, &span_count);
+      spans += span_count;
+    }
+  }
+  double full_ms = (Bench_now_ms() - start) / iterations;
+
+  // highlight and range, over trees parsed up front
+  TSParser *parser = ts_parser_new();
+  ts_parser_set_language(parser, grammar->language());
+  TSTree *trees[MAX_INPUTS];
+  for (int i = 0; i < inputs.count; i++) {
+    trees[i] = ts_parser_parse_string(parser, NULL, inputs.texts[i].data,
+                                      inputs.texts[i].length);
+  }
+  start = Bench_now_ms();
+  for (int n = 0; n < iterations; n++) {
+    for (int i = 0; i < inputs.count; i++) {
+      uint32_t span_count = 0;
+      ObjectScript_Highlighter_highlight_tree(highlighter, ts_tree_root_node(trees[i]), 0,
+                                              UINT32_MAX, &span_count);
+    }
+  }
+  double tree_ms = (Bench_now_ms() - start) / iterations;
+  uint64_t range_bytes = 0;
+  start = Bench_now_ms();
+  for (int n = 0; n < iterations; n++) {
+    range_bytes = 0;
+    for (int i = 0; i < inputs.count; i++) {
+      uint32_t length = inputs.texts[i].length;
+      uint32_t range_start = length > RANGE_BYTES ? (length - RANGE_BYTES) / 2 : 0;
+      uint32_t range_end = length > RANGE_BYTES ? range_start + RANGE_BYTES : length;
+      uint32_t span_count = 0;
+      ObjectScript_Highlighter_highlight_tree(highlighter, ts_tree_root_node(trees[i]),
+                                              range_start, range_end, &span_count);
+      range_bytes += range_end - range_start;
+    }
+  }
+  double range_ms = (Bench_now_ms() - start) / iterations;
+
+  // threads
+  struct Worker *workers = (struct Worker *)calloc(threads, sizeof(struct Worker));
+  start = Bench_now_ms();
+  for (int t = 0; t < threads; t++) {
+    workers[t] = (struct Worker){.query = query, .inputs = &inputs, .iterations = iterations};
+    pthread_create(&workers[t].thread, NULL, worker, &workers[t]);
+  }
+  for (int t = 0; t < threads; t++) pthread_join(workers[t].thread, NULL);
+  double threads_ms = (Bench_now_ms() - start) / iterations;
+
+  printf("%s grammar, %d input%s, %.1f KB, %llu spans, query compiled in %.2f ms\n\n",
+         grammar->name, inputs.count, inputs.count == 1 ? "" : "s", inputs.bytes / 1024.0,
+         (unsigned long long)spans, compile_ms);
+  printf("  parse+highlight %9.2f ms  %7.1f MB/s\n", full_ms, mb_per_s(inputs.bytes, full_ms));
+  printf("  highlight       %9.2f ms  %7.1f MB/s\n", tree_ms, mb_per_s(inputs.bytes, tree_ms));
+  printf("  range           %9.2f ms  %7.1f MB/s of the range, %.1f KB each\n", range_ms,
+         mb_per_s(range_bytes, range_ms), range_bytes / 1024.0 / inputs.count);
+  printf("  %2d threads      %9.2f ms  %7.1f MB/s\n", threads, threads_ms,
+         mb_per_s(inputs.bytes * threads, threads_ms));
+  if (cli) {
+    double cli_ms = strcmp(grammar->name, "udl") ? -1 : time_cli(&inputs, iterations);
+    if (cli_ms < 0) {
+      printf("  tree-sitter highlight failed (udl only, needs the CLI and its config)\n");
+    } else {
+      printf("  tree-sitter     %9.2f ms  %7.1f MB/s  %.1fx\n", cli_ms,
+             mb_per_s(inputs.bytes, cli_ms), cli_ms / full_ms);
+    }
+  }
+
+  free(workers);
+  for (int i = 0; i < inputs.count; i++) {
+    ts_tree_delete(trees[i]);
+    Bench_Buffer_free(&inputs.texts[i]);
+  }
+  ts_parser_delete(parser);
+  ObjectScript_Highlighter_delete(highlighter);
+  ObjectScript_Highlight_Query_delete(query);
+  Bench_Buffer_free(&source);
+  return 0;
+}
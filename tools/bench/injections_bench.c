@@ -0,0 +1,179 @@
+// Injection query benchmark over XData heavy classes
+//
+// Usage: injections_bench [-n iterations] [-x xdata] [-f file.cls]... query.scm...
+//
+// Each query file is compiled against the udl grammar and run over the
+// classes with the same driver a host would use (query matching plus the
+// #eq?/#set! predicate handling), without parsing the injected bodies.
+// Compare the current udl/queries/injections.scm with an older revision:
+//
+//   git show <rev>:udl/queries/injections.scm > /tmp/injections.old.scm
+//   build/injections_bench /tmp/injections.old.scm ../udl/queries/injections.scm
+//
+// Without -f, a synthetic Ensemble style class is generated with BPL and
+// DTL blocks plus one XData per injectable MimeType.
+#include "bench.h"
+#include "injection_cache.h"
+#include "tree-sitter-objectscript_udl.h"
+
+static void generate_class(struct Bench_Buffer *buffer, int xdata_count) {
+  static const char *mimetypes[] = {
+    "text/markdown", "text/xml", "text/html", "application/json", "text/css",
+    "image/svg+xml", "application/vnd.x+json", "text/html; charset=utf-8",
+    "text/plain",
+  };
+  int n_mimetypes = sizeof(mimetypes) / sizeof(mimetypes[0]);
+
+  Bench_Buffer_printf(buffer, "Class Bench.XData Extends Ens.BusinessProcessBPL\n{\n\n");
+  for (int i = 0; i < xdata_count; i++) {
+    switch (i % 3) {
+    case 0:
+      Bench_Buffer_printf(
+          buffer,
+          "XData BPL%d [ XMLNamespace = \"http://www.intersystems.com/bpl\" ]\n{\n"
+          "<process language='objectscript' request='Ens.Request' response='Ens.Response'>\n"
+          "<sequence>\n"
+          "<assign property='context.Step' value='%d' action='set'/>\n"
+          "<call name='Lookup' target='Lookup.Operation' async='0'>\n"
+          "<request type='Ens.StringRequest'><assign property='callrequest.StringValue' value='request.Key' action='set'/></request>\n"
+          "</call>\n"
+          "</sequence>\n"
+          "</process>\n}\n\n",
+          i, i);
+      break;
+    case 1:
+      Bench_Buffer_printf(
+          buffer,
+          "XData DTL%d [ XMLNamespace = \"http://www.intersystems.com/dtl\" ]\n{\n"
+          "<transform sourceClass='EnsLib.HL7.Message' targetClass='HS.SDA3.Container' create='new' language='objectscript'>\n"
+          "<assign value='source.{PID:PatientName(1).FamilyName}' property='target.Patient.Name.FamilyName' action='set'/>\n"
+          "<assign value='source.{PID:DateTimeofBirth}' property='target.Patient.BirthTime' action='set'/>\n"
+          "</transform>\n}\n\n",
+          i);
+      break;
+    default:
+      Bench_Buffer_printf(
+          buffer,
+          "XData Data%d [ MimeType = \"%s\" ]\n{\n"
+          "{ \"step\": %d, \"items\": [1, 2, 3] }\n}\n\n",
+          i, mimetypes[(i / 3) % n_mimetypes], i);
+      break;
+    }
+  }
+  Bench_Buffer_printf(buffer, "}\n");
+}
+
+static uint64_t resolved;
+
+// Count what the host would have to resolve, without parsing any bodies
+static const TSLanguage *resolve(void *payload, const char *name, uint32_t length) {
+  (void)payload;
+  (void)name;
+  (void)length;
+  resolved++;
+  return NULL;
+}
+
+static void ignore(void *payload, const struct ObjectScript_Injection *injection) {
+  (void)payload;
+  (void)injection;
+}
+
+int main(int argc, char **argv) {
+  int iterations = 100;
+  int xdata_count = 3000;
+  const char *files[256];
+  int file_count = 0;
+  const char *queries[32];
+  int query_count = 0;
+
+  for (int i = 1; i < argc; i++) {
+    if (!strcmp(argv[i], "-n") && i + 1 < argc) {
+      iterations = atoi(argv[++i]);
+    } else if (!strcmp(argv[i], "-x") && i + 1 < argc) {
+      xdata_count = atoi(argv[++i]);
+    } else if (!strcmp(argv[i], "-f") && i + 1 < argc && file_count < 256) {
+      files[file_count++] = argv[++i];
+    } else if (query_count < 32) {
+      queries[query_count++] = argv[i];
+    }
+  }
+  if (iterations < 1) iterations = 1;
+  if (query_count == 0) {
+    fprintf(stderr,
+            "usage: %s [-n iterations] [-x xdata] [-f file.cls]... query.scm...\n",
+            argv[0]);
+    return 2;
+  }
+
+  const TSLanguage *language = tree_sitter_objectscript_udl();
+  TSParser *parser = ts_parser_new();
+  ts_parser_set_language(parser, language);
+
+  // Parse the inputs once up front, we only time the queries
+  int source_count = file_count ? file_count : 1;
+  struct Bench_Buffer *sources =
+      (struct Bench_Buffer *)calloc(source_count, sizeof(struct Bench_Buffer));
+  TSTree **trees = (TSTree **)calloc(source_count, sizeof(TSTree *));
+  uint64_t total_bytes = 0;
+  for (int i = 0; i < source_count; i++) {
+    if (file_count) {
+      if (!Bench_read_file(files[i], &sources[i])) return 1;
+    } else {
+      generate_class(&sources[i], xdata_count);
+    }
+    trees[i] = ts_parser_parse_string(parser, NULL, sources[i].data, sources[i].length);
+    total_bytes += sources[i].length;
+  }
+  printf("inputs: %d, %.1f KB\n", source_count, total_bytes / 1024.0);
+
+  struct ObjectScript_Injection_Cache *cache = ObjectScript_Injection_Cache_new();
+  for (int q = 0; q < query_count; q++) {
+    struct Bench_Buffer text = {0};
+    if (!Bench_read_file(queries[q], &text)) return 1;
+
+    uint32_t error_offset;
+    TSQueryError error_type;
+    double start = Bench_now_ms();
+    TSQuery *query =
+        ts_query_new(language, text.data, text.length, &error_offset, &error_type);
+    double compile_ms = Bench_now_ms() - start;
+    if (!query) {
+      fprintf(stderr, "%s: query error %d at offset %u\n", queries[q], error_type,
+              error_offset);
+      return 1;
+    }
+
+    resolved = 0;
+    start = Bench_now_ms();
+    for (int n = 0; n < iterations; n++) {
+      for (int i = 0; i < source_count; i++) {
+        ObjectScript_Injection_Cache_inject(cache, parser, query,
+                                            ts_tree_root_node(trees[i]),
+                                            sources[i].data, resolve, ignore, NULL);
+      }
+    }
+    double elapsed_ms = Bench_now_ms() - start;
+
+    printf("%s\n", queries[q]);
+    printf("  patterns:        %u\n", ts_query_pattern_count(query));
+    printf("  compile:         %.3f ms\n", compile_ms);
+    printf("  injections/run:  %llu\n", (unsigned long long)(resolved / iterations));
+    printf("  match time/run:  %.3f ms\n", elapsed_ms / iterations);
+    printf("  throughput:      %.1f MB/s\n",
+           (total_bytes * (double)iterations / (1024.0 * 1024.0)) / (elapsed_ms / 1e3));
+
+    ts_query_delete(query);
+    Bench_Buffer_free(&text);
+  }
+
+  ObjectScript_Injection_Cache_delete(cache);
+  for (int i = 0; i < source_count; i++) {
+    ts_tree_delete(trees[i]);
+    Bench_Buffer_free(&sources[i]);
+  }
+  free(trees);
+  free(sources);
+  ts_parser_delete(parser);
+  return 0;
+}
@@ -0,0 +1,231 @@
+// Query execution benchmark for the layered highlights/injections/locals
+//
+// Usage: query_bench [-g expr|core|udl] [-c category] [-n iterations]
+//                    [-s size] [-t top] [-r repo] [file...]
+//
+// Compiles the combined query for a grammar (expr + core + udl files, as
+// tree-sitter.json concatenates them), runs it over the inputs with a
+// TSQueryCursor and reports compile time, matches/s and throughput.  Then
+// every pattern is compiled and run on its own, and the `top` most expensive
+// ones are listed with their source line, so that slow patterns (such as
+// the `(_ keyword: (_) @keyword)` wildcard) stand out.
+//
+// If the merged bundle (scripts/merge-queries.js) exists, the ts_query_new
+// time of the layered and the merged form are compared as well, averaged
+// over `iterations` compiles.
+//
+// Without input files, a synthetic class/routine/expression is generated.
+#include "bench.h"
+#include "grammars.h"
+
+struct Pattern_Cost {
+  uint32_t index;
+  uint32_t line;
+  uint64_t matches;
+  double   ms;
+  const char *text;
+  uint32_t length;
+};
+
+static int by_cost(const void *a, const void *b) {
+  double d = ((const struct Pattern_Cost *)b)->ms - ((const struct Pattern_Cost *)a)->ms;
+  return d > 0 ? 1 : (d < 0 ? -1 : 0);
+}
+
+// Average ts_query_new time in ms over `iterations` compiles
+static double average_compile_ms(const TSLanguage *language, const struct Bench_Buffer *source,
+                                 int iterations) {
+  uint32_t error_offset;
+  TSQueryError error_type;
+  double start = Bench_now_ms();
+  for (int n = 0; n < iterations; n++) {
+    TSQuery *query =
+        ts_query_new(language, source->data, source->length, &error_offset, &error_type);
+    if (!query) return -1;
+    ts_query_delete(query);
+  }
+  return (Bench_now_ms() - start) / iterations;
+}
+
+// Run `query` over every tree `iterations` times, returning the match count
+static uint64_t run_query(TSQueryCursor *cursor, const TSQuery *query,
+                          TSTree **trees, int tree_count, int iterations) {
+  uint64_t matches = 0;
+  TSQueryMatch match;
+  for (int n = 0; n < iterations; n++) {
+    for (int i = 0; i < tree_count; i++) {
+      ts_query_cursor_exec(cursor, query, ts_tree_root_node(trees[i]));
+      while (ts_query_cursor_next_match(cursor, &match)) {
+        matches++;
+      }
+    }
+  }
+  return matches;
+}
+
+int main(int argc, char **argv) {
+  const char *grammar_name = "udl";
+  const char *category = "highlights";
+  const char *root = "..";
+  int iterations = 20;
+  int size = 500;
+  int top = 15;
+  const char *files[256];
+  int file_count = 0;
+
+  for (int i = 1; i < argc; i++) {
+    if (!strcmp(argv[i], "-g") && i + 1 < argc) {
+      grammar_name = argv[++i];
+    } else if (!strcmp(argv[i], "-c") && i + 1 < argc) {
+      category = argv[++i];
+    } else if (!strcmp(argv[i], "-n") && i + 1 < argc) {
+      iterations = atoi(argv[++i]);
+    } else if (!strcmp(argv[i], "-s") && i + 1 < argc) {
+      size = atoi(argv[++i]);
+    } else if (!strcmp(argv[i], "-t") && i + 1 < argc) {
+      top = atoi(argv[++i]);
+    } else if (!strcmp(argv[i], "-r") && i + 1 < argc) {
+      root = argv[++i];
+    } else if (file_count < 256) {
+      files[file_count++] = argv[i];
+    }
+  }
+  if (iterations < 1) iterations = 1;
+
+  const struct Bench_Grammar *grammar = Bench_grammar(grammar_name);
+  if (!grammar) {
+    fprintf(stderr, "unknown grammar '%s' (expr, core or udl)\n", grammar_name);
+    return 2;
+  }
+  const TSLanguage *language = grammar->language();
+
+  struct Bench_Buffer source = {0};
+  Bench_load_query(grammar, root, category, &source);
+  if (!source.length) {
+    fprintf(stderr, "no %s queries found for %s under %s\n", category,
+            grammar->name, root);
+    return 1;
+  }
+
+  uint32_t error_offset;
+  TSQueryError error_type;
+  double start = Bench_now_ms();
+  TSQuery *query =
+      ts_query_new(language, source.data, source.length, &error_offset, &error_type);
+  double compile_ms = Bench_now_ms() - start;
+  if (!query) {
+    fprintf(stderr, "%s/%s: query error %d at offset %u\n", grammar->name,
+            category, error_type, error_offset);
+    return 1;
+  }
+
+  TSParser *parser = ts_parser_new();
+  ts_parser_set_language(parser, language);
+  int tree_count = file_count ? file_count : 1;
+  struct Bench_Buffer *inputs =
+      (struct Bench_Buffer *)calloc(tree_count, sizeof(struct Bench_Buffer));
+  TSTree **trees = (TSTree **)calloc(tree_count, sizeof(TSTree *));
+  uint64_t total_bytes = 0;
+  for (int i = 0; i < tree_count; i++) {
+    if (file_count) {
+      if (!Bench_read_file(files[i], &inputs[i])) return 1;
+    } else {
+      Bench_generate(grammar, &inputs[i], size);
+    }
+    trees[i] = ts_parser_parse_string(parser, NULL, inputs[i].data, inputs[i].length);
+    total_bytes += inputs[i].length;
+  }
+
+  TSQueryCursor *cursor = ts_query_cursor_new();
+  start = Bench_now_ms();
+  uint64_t matches = run_query(cursor, query, trees, tree_count, iterations);
+  double elapsed_ms = Bench_now_ms() - start;
+  double mb = total_bytes * (double)iterations / (1024.0 * 1024.0);
+
+  uint32_t pattern_count = ts_query_pattern_count(query);
+  printf("%s %s: %u patterns, %d input(s), %.1f KB\n", grammar->name, category,
+         pattern_count, tree_count, total_bytes / 1024.0);
+  printf("  compile:       %.3f ms\n", compile_ms);
+  printf("  run:           %.3f ms/iteration\n", elapsed_ms / iterations);
+  printf("  matches:       %llu/iteration, %.0f matches/s\n",
+         (unsigned long long)(matches / iterations), matches / (elapsed_ms / 1e3));
+  printf("  throughput:    %.1f MB/s\n", mb / (elapsed_ms / 1e3));
+
+  struct Bench_Buffer merged = {0};
+  if (Bench_load_merged_query(grammar, root, category, &merged)) {
+    double layered_ms = average_compile_ms(language, &source, iterations);
+    double merged_ms = average_compile_ms(language, &merged, iterations);
+    printf("  compile (avg):  layered %.3f ms (%u bytes), merged %.3f ms (%u bytes)\n",
+           layered_ms, source.length, merged_ms, merged.length);
+    if (merged_ms < 0) {
+      fprintf(stderr, "%s/queries/merged/%s.scm does not compile, regenerate it\n",
+              grammar->name, category);
+    }
+  }
+  Bench_Buffer_free(&merged);
+
+  // Per pattern cost: each pattern spans from its start to the next one's
+  struct Pattern_Cost *costs =
+      (struct Pattern_Cost *)calloc(pattern_count, sizeof(struct Pattern_Cost));
+  for (uint32_t p = 0; p < pattern_count; p++) {
+    uint32_t begin = ts_query_start_byte_for_pattern(query, p);
+    uint32_t end = p + 1 < pattern_count
+                       ? ts_query_start_byte_for_pattern(query, p + 1)
+                       : source.length;
+    struct Pattern_Cost *cost = &costs[p];
+    cost->index = p;
+    cost->text = &source.data[begin];
+    cost->length = end - begin;
+    cost->line = 1;
+    for (uint32_t i = 0; i < begin; i++) {
+      if (source.data[i] == '\n') cost->line++;
+    }
+
+    TSQuery *single =
+        ts_query_new(language, cost->text, cost->length, &error_offset, &error_type);
+    if (!single) {
+      cost->ms = -1;
+      continue;
+    }
+    start = Bench_now_ms();
+    cost->matches = run_query(cursor, single, trees, tree_count, iterations);
+    cost->ms = (Bench_now_ms() - start) / iterations;
+    ts_query_delete(single);
+  }
+
+  qsort(costs, pattern_count, sizeof(struct Pattern_Cost), by_cost);
+  printf("\n  most expensive patterns (line in the combined query):\n");
+  printf("  %8s %10s %10s  %s\n", "line", "ms/iter", "matches", "pattern");
+  for (uint32_t p = 0; p < pattern_count && (int)p < top; p++) {
+    struct Pattern_Cost *cost = &costs[p];
+
+    // Show the first non-comment line of the pattern
+    const char *text = cost->text;
+    const char *end = cost->text + cost->length;
+    while (text < end && (*text == ';' || *text == '\n' || *text == ' ')) {
+      if (*text == ';') {
+        while (text < end && *text != '\n') text++;
+      } else {
+        text++;
+      }
+    }
+    int width = 0;
+    while (text + width < end && text[width] != '\n' && width < 60) width++;
+
+    printf("  %8u %10.3f %10llu  %.*s\n", cost->line, cost->ms,
+           (unsigned long long)(cost->matches / iterations), width, text);
+  }
+
+  free(costs);
+  ts_query_cursor_delete(cursor);
+  ts_query_delete(query);
+  for (int i = 0; i < tree_count; i++) {
+    ts_tree_delete(trees[i]);
+    Bench_Buffer_free(&inputs[i]);
+  }
+  free(trees);
+  free(inputs);
+  ts_parser_delete(parser);
+  Bench_Buffer_free(&source);
+  return 0;
+}
@@ -0,0 +1,212 @@
+// Parsing string heavy code
+//
+// Usage: string_literal_bench [-g expr|core|udl] [-n lines] [-l length]
+//                             [-i iterations] [-s] [file...]
+//
+// Parses a generated input of `lines` assignments of string literals
+// `length` bytes long, with `""` quotes in them, and of JSON objects whose
+// values are strings of the same length with `\` escapes, or the files
+// given, and reports MB/s and strings/s.  Almost every byte is inside a
+// string, so this is the input where lexing string bodies costs the most.
+// Both string tokens are lexed by the scanner, see expr/src/scanner.h; -s
+// times those functions alone over every string of the input, through
+// bench_lexer.h, instead of parsing it.
+#include "bench.h"
+#include "bench_lexer.h"
+#include "grammars.h"
+#include "../../expr/src/scanner.h"
+
+static void body(struct Bench_Buffer *buffer, int length, bool json) {
+  static const char text[] = "<td class=x>Lorem ipsum dolor sit amet</td> ";
+  for (int i = 0; i < length; i++) {
+    if (i % 40 == 39) {
+      Bench_Buffer_printf(buffer, json ? "\\n" : "\"\"");
+      i++;
+    } else {
+      Bench_Buffer_printf(buffer, "%c", text[i % (int)(sizeof(text) - 1)]);
+    }
+  }
+}
+
+static void generate(const struct Bench_Grammar *grammar, int count, int length,
+                     struct Bench_Buffer *buffer) {
+  bool udl = !strcmp(grammar->name, "udl");
+  bool expr = !strcmp(grammar->name, "expr");
+  if (udl) Bench_Buffer_printf(buffer, "Class Bench.Strings\n{\n\nClassMethod M()\n{\n");
+  for (int i = 0; i < count; i++) {
+    bool json = i % 4 == 3;
+    if (expr) {
+      Bench_Buffer_printf(buffer, i ? " _ " : "");
+    } else {
+      Bench_Buffer_printf(buffer, " set x%d = ", i);
+    }
+    if (json) {
+      Bench_Buffer_printf(buffer, "{\"id\": %d, \"text\": \"", i);
+      body(buffer, length, true);
+      Bench_Buffer_printf(buffer, "\"}");
+    } else {
+      Bench_Buffer_printf(buffer, "\"");
+      body(buffer, length, false);
+      Bench_Buffer_printf(buffer, "\"");
+    }
+    if (!expr) Bench_Buffer_printf(buffer, "\n");
+  }
+  if (udl) Bench_Buffer_printf(buffer, "}\n\n}\n");
+}
+
+static uint32_t count_strings(TSNode root) {
+  TSTreeCursor cursor = ts_tree_cursor_new(root);
+  uint32_t count = 0;
+  for (;;) {
+    const char *type = ts_node_type(ts_tree_cursor_current_node(&cursor));
+    if (!strcmp(type, "string_literal") || !strcmp(type, "json_string_literal")) count++;
+    if (ts_tree_cursor_goto_first_child(&cursor)) continue;
+    while (!ts_tree_cursor_goto_next_sibling(&cursor)) {
+      if (!ts_tree_cursor_goto_parent(&cursor)) {
+        ts_tree_cursor_delete(&cursor);
+        return count;
+      }
+    }
+  }
+}
+
+// Whether a `{` or `[` at `position` opens a JSON literal rather than a
+// class, method or block body: it starts the input or follows an operator
+static bool opens_json(const struct Bench_Buffer *input, uint32_t position) {
+  while (position > 0 && input->data[position - 1] == ' ') position--;
+  return position == 0 || strchr("=(,:[_", input->data[position - 1]) != NULL;
+}
+
+// Lexes every string of `input` with the scanner: JSON strings inside JSON
+// literals, ObjectScript strings elsewhere.  A `"` that doesn't start a
+// string is skipped.  Returns the bytes inside strings.
+static uint64_t scan_strings(const struct Bench_Buffer *input, uint32_t *strings) {
+  struct Bench_Lexer lexer;
+  uint64_t bytes = 0;
+  int depth = 0;   // Of JSON literals
+  uint32_t position = 0;
+  while (position < input->length) {
+    char c = input->data[position];
+    if ((c == '{' || c == '[') && (depth > 0 || opens_json(input, position))) depth++;
+    if ((c == '}' || c == ']') && depth > 0) depth--;
+    if (c != '"') {
+      position++;
+      continue;
+    }
+    Bench_Lexer_start(&lexer, input->data, input->length, position);
+    bool found = depth ? ObjectScript_Expr_Scanner_lex_json_string(&lexer.lexer)
+                       : ObjectScript_Expr_Scanner_lex_string(&lexer.lexer);
+    if (!found) {
+      position++;
+      continue;
+    }
+    uint32_t end = Bench_Lexer_token_end(&lexer);
+    bytes += end - position;
+    (*strings)++;
+    position = end;
+  }
+  return bytes;
+}
+
+int main(int argc, char **argv) {
+  const struct Bench_Grammar *grammar = Bench_grammar("core");
+  int count = 20000;
+  int length = 200;
+  int iterations = 10;
+  bool scanner_only = false;
+  const char **files = calloc((size_t)argc, sizeof(char *));
+  int file_count = 0;
+  for (int arg = 1; arg < argc; arg++) {
+    if (!strcmp(argv[arg], "-g") && arg + 1 < argc) {
+      grammar = Bench_grammar(argv[++arg]);
+      if (!grammar) {
+        fprintf(stderr, "unknown grammar %s\n", argv[arg]);
+        return 1;
+      }
+    } else if (!strcmp(argv[arg], "-n") && arg + 1 < argc) {
+      count = atoi(argv[++arg]);
+    } else if (!strcmp(argv[arg], "-l") && arg + 1 < argc) {
+      length = atoi(argv[++arg]);
+    } else if (!strcmp(argv[arg], "-i") && arg + 1 < argc) {
+      iterations = atoi(argv[++arg]);
+    } else if (!strcmp(argv[arg], "-s")) {
+      scanner_only = true;
+    } else {
+      files[file_count++] = argv[arg];
+    }
+  }
+  if (count < 1) count = 1;
+  if (length < 0) length = 0;
+  if (iterations < 1) iterations = 1;
+
+  int input_count = file_count ? file_count : 1;
+  struct Bench_Buffer *inputs = calloc((size_t)input_count, sizeof(struct Bench_Buffer));
+  uint64_t bytes = 0;
+  for (int i = 0; i < input_count; i++) {
+    if (file_count) {
+      if (!Bench_read_file(files[i], &inputs[i])) return 1;
+    } else {
+      generate(grammar, count, length, &inputs[i]);
+    }
+    bytes += inputs[i].length;
+  }
+
+  if (scanner_only) {
+    uint32_t strings = 0;
+    uint64_t string_bytes = 0;
+    double start = Bench_now_ms();
+    for (int i = 0; i < iterations; i++) {
+      for (int j = 0; j < input_count; j++) {
+        uint32_t found = 0;
+        uint64_t found_bytes = scan_strings(&inputs[j], &found);
+        if (i == 0) {
+          strings += found;
+          string_bytes += found_bytes;
+        }
+      }
+    }
+    double ms = (Bench_now_ms() - start) / iterations;
+    printf("%s input, %.1f KB, %u strings, %.1f KB in strings\n\n", grammar->name,
+           bytes / 1024.0, strings, string_bytes / 1024.0);
+    printf("  scan  %9.2f ms  %7.1f MB/s  %10.0f strings/s\n", ms,
+           string_bytes / (1024.0 * 1024.0) / (ms / 1000.0), strings * 1000.0 / ms);
+    for (int i = 0; i < input_count; i++) Bench_Buffer_free(&inputs[i]);
+    free(inputs);
+    free(files);
+    return 0;
+  }
+
+  TSParser *parser = ts_parser_new();
+  ts_parser_set_language(parser, grammar->language());
+  uint32_t strings = 0;
+  bool errors = false;
+  double start = Bench_now_ms();
+  for (int i = 0; i < iterations; i++) {
+    for (int j = 0; j < input_count; j++) {
+      TSTree *tree = ts_parser_parse_string(parser, NULL, inputs[j].data, inputs[j].length);
+      if (i == 0) {
+        TSNode root = ts_tree_root_node(tree);
+        strings += count_strings(root);
+        errors |= ts_node_has_error(root);
+      }
+      ts_tree_delete(tree);
+    }
+  }
+  double ms = (Bench_now_ms() - start) / iterations;
+
+  if (file_count) {
+    printf("%s grammar, %d files, %.1f KB, %u strings%s\n\n", grammar->name, file_count,
+           bytes / 1024.0, strings, errors ? " (has errors)" : "");
+  } else {
+    printf("%s grammar, %d strings of %d bytes, %.1f KB, %u strings%s\n\n", grammar->name, count,
+           length, bytes / 1024.0, strings, errors ? " (has errors)" : "");
+  }
+  printf("  parse %9.2f ms  %7.1f MB/s  %10.0f strings/s\n", ms,
+         bytes / (1024.0 * 1024.0) / (ms / 1000.0), strings * 1000.0 / ms);
+
+  ts_parser_delete(parser);
+  for (int i = 0; i < input_count; i++) Bench_Buffer_free(&inputs[i]);
+  free(inputs);
+  free(files);
+  return 0;
+}
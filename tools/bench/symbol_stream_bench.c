@@ -0,0 +1,127 @@
+// JSONL symbol stream over a corpus
+//
+// Usage: symbol_stream_bench [-g core|udl] [-n files] [-s size] [-o out.jsonl]
+//                            [file... | -]
+//
+// Reads, parses and emits one file at a time, the way a warehouse loader
+// would, and reports the parse and emit time separately, records/s and the
+// peak RSS of the process.  `-` reads the file names from stdin, e.g.
+//
+//   find src -name '*.cls' | build/symbol_stream_bench -
+//
+// Without input files, `files` synthetic sources of `size` members are
+// generated.  The records go to /dev/null unless -o is given.
+#include "bench.h"
+#include "grammars.h"
+#include "symbol_stream.h"
+#include <sys/resource.h>
+
+static bool next_path(int argc, char **argv, int *arg, bool from_stdin, char *path,
+                      size_t size) {
+  if (from_stdin) {
+    while (fgets(path, (int)size, stdin)) {
+      path[strcspn(path, "\r\n")] = 0;
+      if (*path) return true;
+    }
+    return false;
+  }
+  if (*arg >= argc) return false;
+  snprintf(path, size, "%s", argv[(*arg)++]);
+  return true;
+}
+
+int main(int argc, char **argv) {
+  const char *grammar_name = "udl";
+  const char *output = "/dev/null";
+  int count = 1000;
+  int size = 20;
+  int arg = 1;
+  for (; arg < argc; arg++) {
+    if (!strcmp(argv[arg], "-g") && arg + 1 < argc) {
+      grammar_name = argv[++arg];
+    } else if (!strcmp(argv[arg], "-n") && arg + 1 < argc) {
+      count = atoi(argv[++arg]);
+    } else if (!strcmp(argv[arg], "-s") && arg + 1 < argc) {
+      size = atoi(argv[++arg]);
+    } else if (!strcmp(argv[arg], "-o") && arg + 1 < argc) {
+      output = argv[++arg];
+    } else {
+      break;
+    }
+  }
+  bool from_stdin = arg < argc && !strcmp(argv[arg], "-");
+  bool from_files = arg < argc;
+
+  const struct Bench_Grammar *grammar = Bench_grammar(grammar_name);
+  if (!grammar) {
+    fprintf(stderr, "unknown grammar '%s' (core or udl)\n", grammar_name);
+    return 2;
+  }
+  const TSLanguage *language = grammar->language();
+  FILE *file = fopen(output, "wb");
+  if (!file) {
+    perror(output);
+    return 1;
+  }
+  TSParser *parser = ts_parser_new();
+  ts_parser_set_language(parser, language);
+  struct ObjectScript_Symbol_Stream *stream = ObjectScript_Symbol_Stream_new(
+      language, ObjectScript_Symbol_Stream_all, ObjectScript_Symbol_Stream_write_file, file);
+
+  double parse_ms = 0, emit_ms = 0;
+  uint64_t source_bytes = 0;
+  int files = 0;
+  char path[4096];
+  for (;;) {
+    struct Bench_Buffer input = {0};
+    if (from_files) {
+      if (!next_path(argc, argv, &arg, from_stdin, path, sizeof(path))) break;
+      if (!Bench_read_file(path, &input)) continue;
+    } else {
+      if (files == count) break;
+      snprintf(path, sizeof(path), "Bench/Class%d.cls", files);
+      Bench_Buffer_printf(&input, "/// File %d\n", files);
+      Bench_generate(grammar, &input, size);
+    }
+
+    double start = Bench_now_ms();
+    TSTree *tree = ts_parser_parse_string(parser, NULL, input.data, input.length);
+    double parsed = Bench_now_ms();
+    bool ok = ObjectScript_Symbol_Stream_emit(stream, tree, input.data, input.length, path);
+    emit_ms += Bench_now_ms() - parsed;
+    parse_ms += parsed - start;
+
+    source_bytes += input.length;
+    files++;
+    ts_tree_delete(tree);
+    Bench_Buffer_free(&input);
+    if (!ok) {
+      fprintf(stderr, "writing %s failed\n", output);
+      return 1;
+    }
+  }
+
+  double start = Bench_now_ms();
+  ObjectScript_Symbol_Stream_flush(stream);
+  emit_ms += Bench_now_ms() - start;
+
+  struct ObjectScript_Symbol_Stream_Stats stats;
+  ObjectScript_Symbol_Stream_stats(stream, &stats);
+  uint64_t records = stats.members + stats.commands + stats.calls;
+  double mb = source_bytes / (1024.0 * 1024.0);
+  struct rusage usage;
+  getrusage(RUSAGE_SELF, &usage);
+
+  printf("%s: %d files, %.1f MB\n\n", grammar->name, files, mb);
+  printf("  parse  %9.1f ms  %7.1f MB/s\n", parse_ms, mb / (parse_ms / 1e3));
+  printf("  emit   %9.1f ms  %7.1f MB/s  %10.0f records/s\n", emit_ms, mb / (emit_ms / 1e3),
+         records / (emit_ms / 1e3));
+  printf("\n  %llu members, %llu commands, %llu calls, %.1f MB of JSONL\n",
+         (unsigned long long)stats.members, (unsigned long long)stats.commands,
+         (unsigned long long)stats.calls, stats.bytes / (1024.0 * 1024.0));
+  printf("  peak RSS %.1f MB\n", usage.ru_maxrss / 1024.0);
+
+  bool ok = ObjectScript_Symbol_Stream_delete(stream);
+  ts_parser_delete(parser);
+  return fclose(file) == 0 && ok ? 0 : 1;
+}
@@ -0,0 +1,149 @@
+// Parsing and classifying system functions and variables
+//
+// Usage: system_names_bench [-g expr|core|udl] [-n count] [-i iterations]
+//
+// Parses a generated input of `count` lines (expr: operands) made of
+// `$name(...)` calls and `$name` variables, full names and abbreviations
+// in mixed case, and reports parse MB/s, then walks the tree classifying
+// every system_defined_function and system_defined_variable with
+// ObjectScript_System_Name_of_node() and reports the cost per name.  Run
+// it before and after a grammar change together with
+// scripts/parser-stats.js, which reports the lexer states and the size of
+// parser.c.
+#include "bench.h"
+#include "grammars.h"
+#include "system_names.h"
+
+static const char *const operands[] = {
+  "$ZDATETIME($HOROLOG, 3)",
+  "$zdt($h,3)",
+  "$Piece(tList, \",\", 2)",
+  "$length(tValue)",
+  "$L(tValue, \",\")",
+  "$ZV",
+  "$zconvert(tName, \"U\")",
+  "$ListBuild(1, $J, $zts)",
+  "$select(tFlag:$ZCHILD, 1:$increment(^Bench.Counter))",
+  "$get(^Bench.Data(1), $namespace)",
+  "$zstrip(tText, \"<>W\")",
+  "$case(tType, 1:$ESTACK, :$STACK)",
+  "$extract(tText, 1, *-1)",
+  "$lg(tList, 2, $USERNAME)",
+  "$char(65) _ $ascii(\"A\")",
+  "$ZTIMESTAMP",
+};
+
+static void generate(const struct Bench_Grammar *grammar, int count,
+                     struct Bench_Buffer *buffer) {
+  size_t operand_count = sizeof(operands) / sizeof(operands[0]);
+  bool udl = !strcmp(grammar->name, "udl");
+  bool expr = !strcmp(grammar->name, "expr");
+  if (udl) Bench_Buffer_printf(buffer, "Class Bench.SystemNames\n{\n\nClassMethod M()\n{\n");
+  for (int i = 0; i < count; i++) {
+    const char *a = operands[(size_t)i % operand_count];
+    const char *b = operands[(size_t)(i * 7 + 3) % operand_count];
+    if (expr) {
+      Bench_Buffer_printf(buffer, "%s%s _ %s", i ? " _ " : "", a, b);
+    } else {
+      Bench_Buffer_printf(buffer, " set x%d = %s _ %s\n", i, a, b);
+    }
+  }
+  if (udl) Bench_Buffer_printf(buffer, "}\n\n}\n");
+}
+
+struct Counts {
+  uint32_t names;
+  uint32_t unknown;
+};
+
+static void classify(TSNode root, const char *source, struct Counts *counts) {
+  TSTreeCursor cursor = ts_tree_cursor_new(root);
+  for (;;) {
+    TSNode node = ts_tree_cursor_current_node(&cursor);
+    const char *type = ts_node_type(node);
+    if (!strcmp(type, "system_defined_function") || !strcmp(type, "system_defined_variable")) {
+      counts->names++;
+      if (!ObjectScript_System_Name_of_node(node, source)) counts->unknown++;
+    }
+    if (ts_tree_cursor_goto_first_child(&cursor)) continue;
+    while (!ts_tree_cursor_goto_next_sibling(&cursor)) {
+      if (!ts_tree_cursor_goto_parent(&cursor)) {
+        ts_tree_cursor_delete(&cursor);
+        return;
+      }
+    }
+  }
+}
+
+int main(int argc, char **argv) {
+  const struct Bench_Grammar *grammar = Bench_grammar("core");
+  int count = 20000;
+  int iterations = 10;
+  for (int arg = 1; arg < argc; arg++) {
+    if (!strcmp(argv[arg], "-g") && arg + 1 < argc) {
+      grammar = Bench_grammar(argv[++arg]);
+      if (!grammar) {
+        fprintf(stderr, "unknown grammar %s\n", argv[arg]);
+        return 1;
+      }
+    } else if (!strcmp(argv[arg], "-n") && arg + 1 < argc) {
+      count = atoi(argv[++arg]);
+    } else if (!strcmp(argv[arg], "-i") && arg + 1 < argc) {
+      iterations = atoi(argv[++arg]);
+    }
+  }
+  if (count < 1) count = 1;
+  if (iterations < 1) iterations = 1;
+
+  struct Bench_Buffer buffer = {0};
+  generate(grammar, count, &buffer);
+  TSParser *parser = ts_parser_new();
+  ts_parser_set_language(parser, grammar->language());
+
+  double start = Bench_now_ms();
+  TSTree *tree = NULL;
+  for (int i = 0; i < iterations; i++) {
+    ts_tree_delete(tree);
+    tree = ts_parser_parse_string(parser, NULL, buffer.data, buffer.length);
+  }
+  double parse_ms = (Bench_now_ms() - start) / iterations;
+  TSNode root = ts_tree_root_node(tree);
+
+  struct Counts counts = {0};
+  start = Bench_now_ms();
+  for (int i = 0; i < iterations; i++) {
+    counts = (struct Counts){0};
+    classify(root, buffer.data, &counts);
+  }
+  double classify_ms = (Bench_now_ms() - start) / iterations;
+
+  // The lookup on its own, over every spelling
+  uint32_t spelling_count;
+  const struct ObjectScript_System_Name *spellings = ObjectScript_System_Names(&spelling_count);
+  uint32_t found = 0;
+  int rounds = 10000;
+  start = Bench_now_ms();
+  for (int round = 0; round < rounds; round++) {
+    for (uint32_t i = 0; i < spelling_count; i++) {
+      const struct ObjectScript_System_Name *spelling = &spellings[i];
+      enum ObjectScript_System_Name_Kind kind = (enum ObjectScript_System_Name_Kind)spelling->kind;
+      found += ObjectScript_System_Name_lookup(spelling->spelling, spelling->length, kind) != NULL;
+    }
+  }
+  double lookup_ms = Bench_now_ms() - start;
+
+  printf("%s grammar, %d lines, %.1f KB%s\n\n", grammar->name, count, buffer.length / 1024.0,
+         ts_node_has_error(root) ? " (has errors)" : "");
+  printf("  parse      %9.2f ms  %7.1f MB/s\n", parse_ms,
+         buffer.length / (1024.0 * 1024.0) / (parse_ms / 1000.0));
+  printf("  classify   %9.2f ms  %7.1f ns/name  (%u names, %u unknown)\n", classify_ms,
+         counts.names ? classify_ms * 1e6 / counts.names : 0.0, counts.names, counts.unknown);
+  printf("  lookup     %9.2f ns/lookup  (%u spellings, %u found)\n",
+         lookup_ms * 1e6 / ((double)rounds * spelling_count), spelling_count,
+         found / (uint32_t)rounds);
+
+  ts_tree_delete(tree);
+  ts_parser_delete(parser);
+  Bench_Buffer_free(&buffer);
+  return 0;
+}
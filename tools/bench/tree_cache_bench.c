@@ -0,0 +1,164 @@
+// Cold vs. warm runs over the on-disk tree cache
+//
+// Usage: tree_cache_bench [-g expr|core|udl] [-d directory] [-n files]
+//                         [-s size] [-c changed%] [file...]
+//
+// Simulates a CI job that walks the tree of every file on each commit:
+//
+//   parse  parse every file and walk the TSTree, no cache
+//   cold   ObjectScript_Tree_Cache_get() on an empty cache (parse + store)
+//   warm   the same again, every tree is read back from disk
+//   edit   `changed`% of the files modified, the rest read back
+//
+// Each run uses a fresh grammar version string, so the cold pass never hits
+// entries left in `directory` by an earlier run; delete it when done.
+//
+// Without input files, `files` distinct synthetic sources are generated.
+#include "bench.h"
+#include "grammars.h"
+#include "tree_cache.h"
+#include <unistd.h>
+
+// What a lint rule might do: visit every named node
+static uint64_t walk_tree(const TSTree *tree) {
+  uint64_t named = 0;
+  TSTreeCursor cursor = ts_tree_cursor_new(ts_tree_root_node(tree));
+  for (;;) {
+    if (ts_node_is_named(ts_tree_cursor_current_node(&cursor))) named++;
+    if (ts_tree_cursor_goto_first_child(&cursor)) continue;
+    while (!ts_tree_cursor_goto_next_sibling(&cursor)) {
+      if (!ts_tree_cursor_goto_parent(&cursor)) {
+        ts_tree_cursor_delete(&cursor);
+        return named;
+      }
+    }
+  }
+}
+
+static uint64_t walk_cached(const struct ObjectScript_Cached_Tree *tree) {
+  uint64_t named = 0;
+  const struct ObjectScript_Cached_Node *nodes = ObjectScript_Cached_Tree_nodes(tree);
+  for (uint32_t i = 0; i < ObjectScript_Cached_Tree_node_count(tree); i++) {
+    if (nodes[i].flags & ObjectScript_Cached_Node_named) named++;
+  }
+  return named;
+}
+
+static void report(const char *name, double ms, int files, uint64_t bytes,
+                   uint64_t named) {
+  printf("  %-6s %9.1f ms  %9.0f files/s  %7.1f MB/s  (%llu named nodes)\n", name, ms,
+         files / (ms / 1e3), bytes / (1024.0 * 1024.0) / (ms / 1e3),
+         (unsigned long long)named);
+}
+
+static double cache_pass(struct ObjectScript_Tree_Cache *cache, TSParser *parser,
+                         struct Bench_Buffer *inputs, int count, uint64_t *named) {
+  *named = 0;
+  double start = Bench_now_ms();
+  for (int i = 0; i < count; i++) {
+    struct ObjectScript_Cached_Tree *tree =
+        ObjectScript_Tree_Cache_get(cache, parser, inputs[i].data, inputs[i].length);
+    if (!tree) continue;
+    *named += walk_cached(tree);
+    ObjectScript_Cached_Tree_delete(tree);
+  }
+  return Bench_now_ms() - start;
+}
+
+int main(int argc, char **argv) {
+  const char *grammar_name = "udl";
+  const char *directory = "build/tree-cache";
+  int count = 200;
+  int size = 50;
+  int changed_percent = 1;
+  const char *files[4096];
+  int file_count = 0;
+
+  for (int i = 1; i < argc; i++) {
+    if (!strcmp(argv[i], "-g") && i + 1 < argc) {
+      grammar_name = argv[++i];
+    } else if (!strcmp(argv[i], "-d") && i + 1 < argc) {
+      directory = argv[++i];
+    } else if (!strcmp(argv[i], "-n") && i + 1 < argc) {
+      count = atoi(argv[++i]);
+    } else if (!strcmp(argv[i], "-s") && i + 1 < argc) {
+      size = atoi(argv[++i]);
+    } else if (!strcmp(argv[i], "-c") && i + 1 < argc) {
+      changed_percent = atoi(argv[++i]);
+    } else if (file_count < 4096) {
+      files[file_count++] = argv[i];
+    }
+  }
+
+  const struct Bench_Grammar *grammar = Bench_grammar(grammar_name);
+  if (!grammar) {
+    fprintf(stderr, "unknown grammar '%s' (expr, core or udl)\n", grammar_name);
+    return 2;
+  }
+  const TSLanguage *language = grammar->language();
+
+  if (file_count) count = file_count;
+  if (count < 1) count = 1;
+  struct Bench_Buffer *inputs =
+      (struct Bench_Buffer *)calloc(count, sizeof(struct Bench_Buffer));
+  uint64_t total_bytes = 0;
+  for (int i = 0; i < count; i++) {
+    if (file_count) {
+      if (!Bench_read_file(files[i], &inputs[i])) return 1;
+    } else {
+      // Make every file distinct, or they'd share one cache entry
+      Bench_Buffer_printf(&inputs[i], "/// File %d\n", i);
+      Bench_generate(grammar, &inputs[i], size);
+    }
+    total_bytes += inputs[i].length;
+  }
+
+  char version[64];
+  snprintf(version, sizeof(version), "bench-%ld-%.0f", (long)getpid(), Bench_now_ms());
+  struct ObjectScript_Tree_Cache *cache =
+      ObjectScript_Tree_Cache_new(directory, language, version);
+  if (!cache) {
+    fprintf(stderr, "can't create the cache directory %s\n", directory);
+    return 1;
+  }
+  TSParser *parser = ts_parser_new();
+  ts_parser_set_language(parser, language);
+
+  printf("%s: %d files, %.1f MB, cache in %s\n", grammar->name, count,
+         total_bytes / (1024.0 * 1024.0), directory);
+
+  uint64_t named = 0;
+  double start = Bench_now_ms();
+  for (int i = 0; i < count; i++) {
+    TSTree *tree = ts_parser_parse_string(parser, NULL, inputs[i].data, inputs[i].length);
+    named += walk_tree(tree);
+    ts_tree_delete(tree);
+  }
+  report("parse", Bench_now_ms() - start, count, total_bytes, named);
+
+  double ms = cache_pass(cache, parser, inputs, count, &named);
+  report("cold", ms, count, total_bytes, named);
+  ms = cache_pass(cache, parser, inputs, count, &named);
+  report("warm", ms, count, total_bytes, named);
+
+  // Touch a few files, as a typical commit would
+  int changed = count * changed_percent / 100;
+  for (int i = 0; i < changed; i++) {
+    Bench_Buffer_printf(&inputs[i * (count / changed)], "\n");
+  }
+  ms = cache_pass(cache, parser, inputs, count, &named);
+  report("edit", ms, count, total_bytes, named);
+
+  struct ObjectScript_Tree_Cache_Stats stats;
+  ObjectScript_Tree_Cache_stats(cache, &stats);
+  printf("\n  %d changed, %llu hits, %llu misses, %.1f MB on disk (%.2fx the sources)\n",
+         changed, (unsigned long long)stats.hits, (unsigned long long)stats.misses,
+         stats.bytes_written / (1024.0 * 1024.0),
+         stats.bytes_written / (double)total_bytes);
+
+  ts_parser_delete(parser);
+  ObjectScript_Tree_Cache_delete(cache);
+  for (int i = 0; i < count; i++) Bench_Buffer_free(&inputs[i]);
+  free(inputs);
+  return 0;
+}
@@ -0,0 +1,123 @@
+// Highlight files with the layered highlights.scm of a grammar
+//
+// Usage: objectscript-highlight [-g expr|core|udl] [-r repo] [-b start:end]
+//                               [-f text|binary] file...
+//
+// Prints the spans of every file (see src/highlighter.h) in order, one
+// `start_byte end_byte highlight` line each after a `# file` line, or with
+// `-f binary` as the raw span array of each file after its uint32 count,
+// for a server that renders them itself.  `-b` highlights only that byte
+// range.  The query is the merged bundle under `repo` (.. by default) if
+// it has been generated, else the layers concatenated, compiled once for
+// all the files; the grammar defaults to udl for .cls files and core for
+// others.
+#include "bench.h"
+#include "grammars.h"
+#include "highlighter.h"
+#include <strings.h>
+
+static struct ObjectScript_Highlight_Query *load_query(const struct Bench_Grammar *grammar,
+                                                       const char *root) {
+  struct Bench_Buffer source = {0};
+  if (!Bench_load_merged_query(grammar, root, "highlights", &source)) {
+    Bench_load_query(grammar, root, "highlights", &source);
+  }
+  if (!source.length) {
+    fprintf(stderr, "no highlights queries found for %s under %s\n", grammar->name, root);
+    return NULL;
+  }
+  uint32_t error_offset;
+  TSQueryError error_type;
+  struct ObjectScript_Highlight_Query *query = ObjectScript_Highlight_Query_new(
+      grammar->language(), source.data, source.length, NULL, 0, &error_offset, &error_type);
+  if (!query) {
+    fprintf(stderr, "%s/highlights: query error %d at offset %u\n", grammar->name, error_type,
+            error_offset);
+  }
+  Bench_Buffer_free(&source);
+  return query;
+}
+
+static bool is_class_file(const char *path) {
+  size_t length = strlen(path);
+  return length > 4 && !strcasecmp(path + length - 4, ".cls");
+}
+
+int main(int argc, char **argv) {
+  const struct Bench_Grammar *forced = NULL;
+  const char *root = "..";
+  uint32_t start_byte = 0, end_byte = UINT32_MAX;
+  bool binary = false;
+  int first_file = argc;
+  for (int arg = 1; arg < argc; arg++) {
+    if (!strcmp(argv[arg], "-g") && arg + 1 < argc) {
+      forced = Bench_grammar(argv[++arg]);
+      if (!forced) {
+        fprintf(stderr, "unknown grammar %s\n", argv[arg]);
+        return 2;
+      }
+    } else if (!strcmp(argv[arg], "-r") && arg + 1 < argc) {
+      root = argv[++arg];
+    } else if (!strcmp(argv[arg], "-b") && arg + 1 < argc) {
+      if (sscanf(argv[++arg], "%u:%u", &start_byte, &end_byte) != 2 || end_byte < start_byte) {
+        fprintf(stderr, "bad range %s, use start:end\n", argv[arg]);
+        return 2;
+      }
+    } else if (!strcmp(argv[arg], "-f") && arg + 1 < argc) {
+      binary = !strcmp(argv[++arg], "binary");
+    } else {
+      first_file = arg;
+      break;
+    }
+  }
+  if (first_file == argc) {
+    fprintf(stderr, "usage: %s [-g expr|core|udl] [-r repo] [-b start:end] "
+                    "[-f text|binary] file...\n", argv[0]);
+    return 2;
+  }
+
+  // One query and highlighter per grammar, made on first use
+  struct ObjectScript_Highlight_Query *queries[3] = {NULL, NULL, NULL};
+  struct ObjectScript_Highlighter *highlighters[3] = {NULL, NULL, NULL};
+  struct Bench_Buffer text = {0};
+  int status = 0;
+  for (int arg = first_file; arg < argc; arg++) {
+    const struct Bench_Grammar *grammar =
+        forced ? forced : Bench_grammar(is_class_file(argv[arg]) ? "udl" : "core");
+    size_t g = (size_t)(grammar - Bench_grammars);
+    if (!highlighters[g]) {
+      queries[g] = load_query(grammar, root);
+      if (!queries[g]) return 1;
+      highlighters[g] = ObjectScript_Highlighter_new(queries[g]);
+    }
+
+    text.length = 0;
+    uint32_t count = 0;
+    const struct ObjectScript_Highlight_Span *spans = NULL;
+    if (Bench_read_file(argv[arg], &text)) {
+      spans = ObjectScript_Highlighter_highlight(highlighters[g], text.data, text.length,
+                                                 start_byte, end_byte, &count);
+    }
+    if (!spans) {
+      fprintf(stderr, "%s: could not highlight\n", argv[arg]);
+      status = 1;
+    }
+    if (binary) {
+      fwrite(&count, sizeof(count), 1, stdout);
+      fwrite(spans, sizeof(*spans), count, stdout);
+      continue;
+    }
+    printf("# %s\n", argv[arg]);
+    for (uint32_t i = 0; i < count; i++) {
+      printf("%u %u %s\n", spans[i].start_byte, spans[i].end_byte,
+             ObjectScript_Highlight_Query_name(queries[g], spans[i].highlight));
+    }
+  }
+
+  for (int g = 0; g < 3; g++) {
+    ObjectScript_Highlighter_delete(highlighters[g]);
+    ObjectScript_Highlight_Query_delete(queries[g]);
+  }
+  Bench_Buffer_free(&text);
+  return status;
+}
@@ -0,0 +1,166 @@
+/**
+ * Zero-copy reader for the flat binary trees written by
+ * `ObjectScript_Flat_Tree_export()` (see `src/flat_tree.h` for the layout).
+ *
+ * The node records are read straight out of the buffer through typed array
+ * views, nothing is decoded up front apart from the name tables:
+ *
+ *   const tree = FlatTree.from(fs.readFileSync('Sample.Person.flat'));
+ *   const method = tree.symbolForName('method_definition');
+ *   for (let i = 0; i < tree.nodeCount; i++) {
+ *     if (tree.symbol(i) === method) console.log(tree.startIndex(i));
+ *   }
+ */
+
+/* eslint-disable camelcase */
+// @ts-check
+
+const MAGIC = 0x5446534f; // 'OSFT'
+const VERSION = 1;
+const HEADER_SIZE = 40;
+const NODE_SIZE = 32;
+const NONE = 0xffffffff;
+
+const FLAGS = {
+  named: 1 << 0,
+  extra: 1 << 1,
+  missing: 1 << 2,
+  error: 1 << 3,
+};
+
+class FlatTree {
+  /**
+   * @param {ArrayBuffer} buffer
+   * @param {number} byteOffset must be a multiple of 4
+   * @param {number} byteLength
+   */
+  constructor(buffer, byteOffset = 0, byteLength = buffer.byteLength - byteOffset) {
+    if (byteOffset % 4 || byteLength < HEADER_SIZE) {
+      throw new Error('Not a flat tree');
+    }
+    const header = new Uint32Array(buffer, byteOffset, HEADER_SIZE / 4);
+    const [magic, version, nodeCount, symbolCount, fieldCount, nodesOffset, stringsOffset, stringsLength] = header;
+    if (magic !== MAGIC || version !== VERSION) {
+      throw new Error('Not a flat tree, or an unsupported version');
+    }
+    if (
+      nodesOffset % 4 ||
+      nodesOffset + nodeCount * NODE_SIZE > stringsOffset ||
+      stringsOffset + stringsLength > byteLength
+    ) {
+      throw new Error('Truncated flat tree');
+    }
+
+    /** Bytes of the source the tree was parsed from */
+    this.sourceLength = header[8];
+    this.nodeCount = nodeCount;
+
+    const strings = new Uint8Array(buffer, byteOffset + stringsOffset, stringsLength);
+    const decoder = new TextDecoder();
+    /** @param {number} offset @return {string} */
+    const name = (offset) => decoder.decode(strings.subarray(offset, strings.indexOf(0, offset)));
+
+    const tables = new Uint32Array(buffer, byteOffset + HEADER_SIZE, symbolCount + fieldCount);
+    const named = new Uint8Array(buffer, byteOffset + HEADER_SIZE + 4 * (symbolCount + fieldCount), symbolCount);
+    /** @type {string[]} */
+    this.types = Array.from(tables.subarray(0, symbolCount), name);
+    /** @type {boolean[]} */
+    this.namedTypes = Array.from(named, (value) => value !== 0);
+    /** @type {(string | null)[]} */
+    this.fields = Array.from(tables.subarray(symbolCount), (offset, i) => (i ? name(offset) : null));
+
+    // The same records seen as u16, u8 and u32 columns
+    this._u16 = new Uint16Array(buffer, byteOffset + nodesOffset, (nodeCount * NODE_SIZE) / 2);
+    this._u8 = new Uint8Array(buffer, byteOffset + nodesOffset, nodeCount * NODE_SIZE);
+    this._u32 = new Uint32Array(buffer, byteOffset + nodesOffset, (nodeCount * NODE_SIZE) / 4);
+  }
+
+  /**
+   * @param {Uint8Array} bytes e.g. from fs.readFileSync()
+   * @return {FlatTree}
+   */
+  static from(bytes) {
+    if (bytes.byteOffset % 4) {
+      bytes = bytes.slice();
+    }
+    return new FlatTree(/** @type {ArrayBuffer} */ (bytes.buffer), bytes.byteOffset, bytes.byteLength);
+  }
+
+  /**
+   * @param {string} type
+   * @param {boolean} named
+   * @return {number} the symbol, or -1 if the grammar has no such node type
+   */
+  symbolForName(type, named = true) {
+    return this.types.findIndex((name, i) => name === type && this.namedTypes[i] === named);
+  }
+
+  /** @param {number} i @return {number} */
+  symbol(i) {
+    return this._u16[i * 16];
+  }
+
+  /** @param {number} i @return {string} */
+  type(i) {
+    return this.types[this.symbol(i)];
+  }
+
+  /** @param {number} i @return {string | null} the field in the parent */
+  fieldName(i) {
+    return this.fields[this._u16[i * 16 + 1]];
+  }
+
+  /** @param {number} i @return {number} */
+  flags(i) {
+    return this._u8[i * NODE_SIZE + 4];
+  }
+
+  /** @param {number} i @return {boolean} */
+  isNamed(i) {
+    return (this.flags(i) & FLAGS.named) !== 0;
+  }
+
+  /** @param {number} i @return {number} */
+  startIndex(i) {
+    return this._u32[i * 8 + 2];
+  }
+
+  /** @param {number} i @return {number} */
+  endIndex(i) {
+    return this._u32[i * 8 + 3];
+  }
+
+  /** @param {number} i @return {{row: number, column: number}} */
+  startPosition(i) {
+    return { row: this._u32[i * 8 + 4], column: this._u32[i * 8 + 5] };
+  }
+
+  /** @param {number} i @return {number} -1 for the root */
+  parent(i) {
+    const parent = this._u32[i * 8 + 6];
+    return parent === NONE ? -1 : parent;
+  }
+
+  /** @param {number} i @return {number} -1 if it's the last child */
+  nextSibling(i) {
+    const next = this._u32[i * 8 + 7];
+    return next === NONE ? -1 : next;
+  }
+
+  /** @param {number} i @return {number} -1 if it has no children */
+  firstChild(i) {
+    return i + 1 < this.nodeCount && this._u32[(i + 1) * 8 + 6] === i ? i + 1 : -1;
+  }
+
+  /**
+   * @param {number} i
+   * @return {Generator<number>}
+   */
+  *children(i) {
+    for (let child = this.firstChild(i); child !== -1; child = this.nextSibling(child)) {
+      yield child;
+    }
+  }
+}
+
+module.exports = { FlatTree, FLAGS };
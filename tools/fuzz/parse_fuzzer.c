@@ -0,0 +1,118 @@
+// Coverage guided search for inputs that parse in superlinear time
+//
+// Built once per grammar with FUZZ_LANGUAGE set to its language function,
+// and with the grammar's parser.c and scanner.c compiled in (see `make
+// fuzz`), so that libFuzzer sees the coverage of the external scanner too.
+//
+// Each input must parse within a budget linear in its size:
+//
+//   OBJECTSCRIPT_FUZZ_FIXED_US + OBJECTSCRIPT_FUZZ_NS_PER_BYTE * size
+//
+// of thread CPU time (2 ms and 2 us a byte by default, well above the
+// grammars' normal rate of a few hundred ns a byte).  An input over budget
+// is parsed a second time to rule out noise, then reported as a crash, so
+// libFuzzer saves and minimizes it like any other.  Inputs are also parsed
+// again after deleting a byte in the middle, to exercise the scanner's
+// serialize/deserialize on reuse.
+//
+// Without libFuzzer, fuzz/replay.c runs the same checks over files.
+#define _POSIX_C_SOURCE 200809L
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <tree_sitter/api.h>
+
+#ifndef FUZZ_LANGUAGE
+#error "FUZZ_LANGUAGE must name the grammar's language function"
+#endif
+
+const TSLanguage *FUZZ_LANGUAGE(void);
+
+#define FUZZ_STRING_(x) #x
+#define FUZZ_STRING(x) FUZZ_STRING_(x)
+
+static TSParser *parser;
+static uint64_t fixed_ns = 2000000;
+static uint64_t ns_per_byte = 2000;
+
+static uint64_t env_or(const char *name, uint64_t fallback) {
+  const char *value = getenv(name);
+  if (!value || !*value) return fallback;
+  return strtoull(value, NULL, 10);
+}
+
+static uint64_t thread_cpu_ns(void) {
+  struct timespec ts;
+  clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts);
+  return (uint64_t)ts.tv_sec * 1000000000u + (uint64_t)ts.tv_nsec;
+}
+
+static uint64_t parse_ns(const char *data, uint32_t length, TSTree **tree) {
+  uint64_t start = thread_cpu_ns();
+  *tree = ts_parser_parse_string(parser, NULL, data, length);
+  return thread_cpu_ns() - start;
+}
+
+int LLVMFuzzerInitialize(int *argc, char ***argv) {
+  (void)argc;
+  (void)argv;
+  fixed_ns = env_or("OBJECTSCRIPT_FUZZ_FIXED_US", fixed_ns / 1000) * 1000;
+  ns_per_byte = env_or("OBJECTSCRIPT_FUZZ_NS_PER_BYTE", ns_per_byte);
+  parser = ts_parser_new();
+  if (!ts_parser_set_language(parser, FUZZ_LANGUAGE())) {
+    fprintf(stderr, "incompatible language version\n");
+    abort();
+  }
+  return 0;
+}
+
+int LLVMFuzzerTestOneInput(const uint8_t *data, size_t size) {
+  if (size > UINT32_MAX) return -1;
+  const char *text = (const char *)data;
+  uint32_t length = (uint32_t)size;
+  uint64_t budget = fixed_ns + ns_per_byte * size;
+
+  TSTree *tree;
+  uint64_t elapsed = parse_ns(text, length, &tree);
+  if (elapsed > budget) {
+    ts_tree_delete(tree);
+    uint64_t again = parse_ns(text, length, &tree);
+    if (again < elapsed) elapsed = again;
+  }
+  if (elapsed > budget) {
+    fprintf(stderr,
+            "%s: %zu bytes parsed in %.3f ms, over the %.3f ms budget (%.0f ns a byte)\n",
+            FUZZ_STRING(FUZZ_LANGUAGE), size, elapsed / 1e6, budget / 1e6,
+            (double)elapsed / (size ? size : 1));
+    abort();
+  }
+
+  // Reparse with a byte deleted from the middle, reusing the old tree
+  if (tree && length > 1) {
+    uint32_t at = length / 2;
+    char *edited = malloc(length - 1);
+    if (edited) {
+      memcpy(edited, text, at);
+      memcpy(edited + at, text + at + 1, length - at - 1);
+      TSPoint point = {0, 0};
+      for (uint32_t i = 0; i < at; i++) {
+        if (text[i] == '\n') {
+          point.row++;
+          point.column = 0;
+        } else {
+          point.column++;
+        }
+      }
+      TSPoint end = text[at] == '\n' ? (TSPoint){point.row + 1, 0}
+                                     : (TSPoint){point.row, point.column + 1};
+      ts_tree_edit(tree, &(TSInputEdit){at, at + 1, at, point, end, point});
+      TSTree *reparsed = ts_parser_parse_string(parser, tree, edited, length - 1);
+      ts_tree_delete(reparsed);
+      free(edited);
+    }
+  }
+  ts_tree_delete(tree);
+  return 0;
+}
@@ -0,0 +1,74 @@
+// Runs the fuzzer's checks over files, for compilers without libFuzzer
+//
+// Usage: replay_<grammar> file-or-directory...
+//
+// Each file is parsed as one input, within the same per-byte budget as
+// parse_fuzzer.c.  Exits non-zero (via abort) on the first input over it.
+#define _POSIX_C_SOURCE 200809L
+#include <dirent.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+
+int LLVMFuzzerInitialize(int *argc, char ***argv);
+int LLVMFuzzerTestOneInput(const uint8_t *data, size_t size);
+
+static int replay_file(const char *path) {
+  FILE *file = fopen(path, "rb");
+  if (!file) {
+    perror(path);
+    return 1;
+  }
+  size_t capacity = 4096, size = 0;
+  uint8_t *data = malloc(capacity);
+  for (size_t n; data && (n = fread(data + size, 1, capacity - size, file)) > 0;) {
+    size += n;
+    if (size == capacity) {
+      uint8_t *grown = realloc(data, capacity *= 2);
+      if (!grown) free(data);
+      data = grown;
+    }
+  }
+  fclose(file);
+  if (!data) {
+    fprintf(stderr, "%s: out of memory\n", path);
+    return 1;
+  }
+  fprintf(stderr, "%s (%zu bytes)\n", path, size);
+  LLVMFuzzerTestOneInput(data, size);
+  free(data);
+  return 0;
+}
+
+static int replay(const char *path) {
+  struct stat info;
+  if (stat(path, &info) != 0) {
+    perror(path);
+    return 1;
+  }
+  if (!S_ISDIR(info.st_mode)) return replay_file(path);
+
+  DIR *directory = opendir(path);
+  if (!directory) {
+    perror(path);
+    return 1;
+  }
+  int failures = 0;
+  for (struct dirent *entry; (entry = readdir(directory));) {
+    if (entry->d_name[0] == '.') continue;
+    char child[4096];
+    snprintf(child, sizeof(child), "%s/%s", path, entry->d_name);
+    failures += replay(child);
+  }
+  closedir(directory);
+  return failures;
+}
+
+int main(int argc, char **argv) {
+  LLVMFuzzerInitialize(&argc, &argv);
+  int failures = 0;
+  for (int i = 1; i < argc; i++) failures += replay(argv[i]);
+  return failures ? 1 : 0;
+}
@@ -0,0 +1,64 @@
+#!/usr/bin/env node
+/**
+ * Write the inputs of each grammar's test corpus as separate files, to seed
+ * its fuzzer.
+ *
+ * Usage: node fuzz/seed.js <output directory> [grammar...]
+ *
+ * Every `<grammar>/test/corpus/*.txt` case becomes
+ * `<output>/<grammar>/<file>-<n>`, the text between its header and the `---`
+ * line that starts the expected tree.
+ */
+
+/* eslint-disable camelcase */
+// @ts-check
+
+const fs = require('fs');
+const path = require('path');
+
+const ROOT = path.join(__dirname, '..', '..');
+const GRAMMARS = ['expr', 'core', 'udl'];
+
+/**
+ * Split a corpus file into the inputs of its cases
+ *
+ * @param {string} text
+ * @return {string[]}
+ */
+function corpus_inputs(text) {
+  const inputs = [];
+  const lines = text.split('\n');
+  for (let i = 0; i < lines.length; i++) {
+    // ===\nname\n===, possibly with attributes between the two rules
+    if (!/^={3,}/.test(lines[i])) continue;
+    let j = i + 1;
+    while (j < lines.length && !/^={3,}/.test(lines[j])) j++;
+    let end = j + 1;
+    while (end < lines.length && !/^-{3,}\s*$/.test(lines[end])) end++;
+    inputs.push(lines.slice(j + 1, end).join('\n').replace(/^\n+/, '').replace(/\n+$/, '\n'));
+    // Skip the expected tree
+    i = end;
+    while (i + 1 < lines.length && !/^={3,}/.test(lines[i + 1])) i++;
+  }
+  return inputs;
+}
+
+const [output, ...names] = process.argv.slice(2);
+if (!output) {
+  console.error('Usage: node fuzz/seed.js <output directory> [grammar...]');
+  process.exit(1);
+}
+for (const grammar of names.length ? names : GRAMMARS) {
+  const corpus = path.join(ROOT, grammar, 'test', 'corpus');
+  const directory = path.join(output, grammar);
+  fs.mkdirSync(directory, { recursive: true });
+  let count = 0;
+  for (const file of fs.readdirSync(corpus).filter((name) => name.endsWith('.txt'))) {
+    const inputs = corpus_inputs(fs.readFileSync(path.join(corpus, file), 'utf8'));
+    inputs.forEach((input, n) => {
+      fs.writeFileSync(path.join(directory, `${path.basename(file, '.txt')}-${n}`), input);
+    });
+    count += inputs.length;
+  }
+  console.log(`${grammar}: ${count} seeds in ${directory}`);
+}
@@ -0,0 +1,901 @@
+#define _POSIX_C_SOURCE 200809L
+#include "call_graph.h"
+#include "class_graph.h"
+#include "string_table.h"
+#include <pthread.h>
+#include <stdatomic.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+#include <unistd.h>
+
+// Longest label or method name kept, longer ones are cut
+#define CALL_GRAPH_MAX_MEMBER 256
+
+// What a node type means to the extractor, by symbol
+enum {
+  Role_none,
+  Role_skip,                   // Members without code, never entered
+  Role_class_definition,
+  Role_class_extends,
+  Role_identifier,
+  Role_method,                 // method, classmethod: the name is in method_definition
+  Role_method_definition,
+  Role_trigger,
+  Role_tag,
+  Role_class_method_call,
+  Role_class_ref,
+  Role_class_name,
+  Role_method_name,
+  Role_oref_method,
+  Role_relative_dot_method,
+  Role_superclass_method_call,
+  Role_routine_tag_call,
+  Role_line_ref,
+  Role_extrinsic_function,
+};
+
+struct Role_Name {
+  const char *name;
+  uint8_t role;
+};
+
+static const struct Role_Name ROLE_NAMES[] = {
+  {"property", Role_skip},
+  {"parameter", Role_skip},
+  {"relationship", Role_skip},
+  {"foreignkey", Role_skip},
+  {"index", Role_skip},
+  {"projection", Role_skip},
+  {"query", Role_skip},
+  {"xdata", Role_skip},
+  {"storage", Role_skip},
+  {"documatic_line", Role_skip},
+  {"class_definition", Role_class_definition},
+  {"class_extends", Role_class_extends},
+  {"identifier", Role_identifier},
+  {"method", Role_method},
+  {"classmethod", Role_method},
+  {"method_definition", Role_method_definition},
+  {"trigger", Role_trigger},
+  {"tag", Role_tag},
+  {"class_method_call", Role_class_method_call},
+  {"class_ref", Role_class_ref},
+  {"class_name", Role_class_name},
+  {"method_name", Role_method_name},
+  {"oref_method", Role_oref_method},
+  {"relative_dot_method", Role_relative_dot_method},
+  {"superclass_method_call", Role_superclass_method_call},
+  {"routine_tag_call", Role_routine_tag_call},
+  {"line_ref", Role_line_ref},
+  {"extrinsic_function", Role_extrinsic_function},
+};
+
+// Symbols and fields of one of the grammars
+struct Language_Roles {
+  const TSLanguage *language;
+  uint8_t *roles;
+  uint32_t symbol_count;
+  TSFieldId name_field;
+  TSFieldId class_name_field;
+  TSFieldId label_field;
+  TSFieldId routine_field;
+};
+
+struct Span {
+  uint32_t start;
+  uint32_t end;
+};
+
+// A call found in a file, names as offsets into the extractor's arena
+struct Raw_Call {
+  uint32_t caller;
+  uint32_t caller_length;
+  uint32_t callee;
+  uint32_t callee_length;
+  uint32_t kind;
+};
+
+// Per thread extraction state, reused from file to file
+struct Extractor {
+  const struct Language_Roles *roles;
+  char *names;
+  uint32_t names_used;
+  uint32_t names_capacity;
+  struct Raw_Call *calls;
+  uint32_t call_count;
+  uint32_t call_capacity;
+  uint32_t unresolved;
+  bool failed;
+
+  // Current file
+  const char *text;
+  uint32_t length;
+  const char *routine;
+  uint32_t routine_length;
+  struct Span class_name;
+  struct Span superclass;
+  uint32_t class_end;
+  struct Span member;
+  uint32_t member_end;
+  struct Span label;
+  uint32_t caller;          // Arena offset of the current caller, or OBJECTSCRIPT_CALL_NONE
+  uint32_t caller_length;
+};
+
+struct Edge_List {
+  struct ObjectScript_Call_Edge *data;
+  uint32_t count;
+  uint32_t capacity;
+};
+
+struct Id_List {
+  uint32_t *data;
+  uint32_t count;
+  uint32_t capacity;
+};
+
+struct Symbol {
+  uint32_t file;            // Path id the calls are from, or OBJECTSCRIPT_CALL_NONE
+  struct Edge_List out;     // Callees
+  struct Edge_List in;      // Callers
+  uint32_t mark;            // Query epoch
+};
+
+struct File {
+  struct Id_List callers;
+  uint64_t calls;
+  uint64_t unresolved;
+};
+
+struct ObjectScript_Call_Graph {
+  struct ObjectScript_String_Table *names;   // Symbol ids
+  struct ObjectScript_String_Table *paths;   // File ids
+  struct Symbol *symbols;
+  uint32_t symbol_capacity;
+  struct File *files;
+  uint32_t file_capacity;
+  uint32_t callers;
+  uint64_t edges;
+  uint64_t calls;
+  uint64_t unresolved;
+
+  struct Language_Roles udl;
+  struct Language_Roles core;
+
+  // Scratch for update() and queries
+  struct Extractor extractor;
+  struct Id_List result;
+  uint32_t epoch;
+};
+
+static bool init_roles(struct Language_Roles *roles, const TSLanguage *language) {
+  roles->language = language;
+  if (!language) return true;
+
+  // By name, so aliased symbols (the identifier of a trigger) are covered
+  roles->symbol_count = ts_language_symbol_count(language);
+  roles->roles = (uint8_t *)calloc(roles->symbol_count, 1);
+  if (!roles->roles) return false;
+  for (uint32_t symbol = 0; symbol < roles->symbol_count; symbol++) {
+    if (ts_language_symbol_type(language, (TSSymbol)symbol) != TSSymbolTypeRegular) continue;
+    const char *name = ts_language_symbol_name(language, (TSSymbol)symbol);
+    for (size_t i = 0; i < sizeof(ROLE_NAMES) / sizeof(ROLE_NAMES[0]); i++) {
+      if (!strcmp(name, ROLE_NAMES[i].name)) {
+        roles->roles[symbol] = ROLE_NAMES[i].role;
+        break;
+      }
+    }
+  }
+  roles->name_field = ts_language_field_id_for_name(language, "name", 4);
+  roles->class_name_field = ts_language_field_id_for_name(language, "class_name", 10);
+  roles->label_field = ts_language_field_id_for_name(language, "label", 5);
+  roles->routine_field = ts_language_field_id_for_name(language, "routine", 7);
+  return true;
+}
+
+static void extractor_free(struct Extractor *extractor) {
+  free(extractor->names);
+  free(extractor->calls);
+}
+
+struct ObjectScript_Call_Graph *ObjectScript_Call_Graph_new(const TSLanguage *udl,
+                                                            const TSLanguage *core) {
+  struct ObjectScript_Call_Graph *graph =
+      (struct ObjectScript_Call_Graph *)calloc(1, sizeof(*graph));
+  if (!graph) return NULL;
+  graph->names = ObjectScript_String_Table_new();
+  graph->paths = ObjectScript_String_Table_new();
+  if (!graph->names || !graph->paths || !init_roles(&graph->udl, udl) ||
+      !init_roles(&graph->core, core)) {
+    ObjectScript_Call_Graph_delete(graph);
+    return NULL;
+  }
+  return graph;
+}
+
+void ObjectScript_Call_Graph_delete(struct ObjectScript_Call_Graph *graph) {
+  if (!graph) return;
+  for (uint32_t i = 0; i < graph->symbol_capacity; i++) {
+    free(graph->symbols[i].out.data);
+    free(graph->symbols[i].in.data);
+  }
+  for (uint32_t i = 0; i < graph->file_capacity; i++) free(graph->files[i].callers.data);
+  free(graph->symbols);
+  free(graph->files);
+  free(graph->udl.roles);
+  free(graph->core.roles);
+  free(graph->result.data);
+  extractor_free(&graph->extractor);
+  ObjectScript_String_Table_delete(graph->names);
+  ObjectScript_String_Table_delete(graph->paths);
+  free(graph);
+}
+
+void ObjectScript_Call_Graph_stats(const struct ObjectScript_Call_Graph *graph,
+                                   struct ObjectScript_Call_Graph_Stats *stats) {
+  stats->symbols = ObjectScript_String_Table_count(graph->names);
+  stats->callers = graph->callers;
+  stats->files = ObjectScript_String_Table_count(graph->paths);
+  stats->edges = graph->edges;
+  stats->calls = graph->calls;
+  stats->unresolved = graph->unresolved;
+}
+
+// Extraction, on any thread: it only reads the role tables
+
+static uint8_t node_role(const struct Extractor *extractor, TSNode node) {
+  TSSymbol symbol = ts_node_symbol(node);
+  return symbol < extractor->roles->symbol_count ? extractor->roles->roles[symbol] : Role_none;
+}
+
+static struct Span node_span(TSNode node) {
+  if (ts_node_is_null(node)) return (struct Span){0, 0};
+  return (struct Span){ts_node_start_byte(node), ts_node_end_byte(node)};
+}
+
+// The first named child with `role`, or a null node
+static TSNode child_with_role(const struct Extractor *extractor, TSNode node, uint8_t role) {
+  uint32_t count = ts_node_named_child_count(node);
+  for (uint32_t i = 0; i < count; i++) {
+    TSNode child = ts_node_named_child(node, i);
+    if (node_role(extractor, child) == role) return child;
+  }
+  return (TSNode){{0, 0, 0, 0}, NULL, NULL};
+}
+
+static bool is_empty(struct Span span) {
+  return span.end <= span.start;
+}
+
+static void append(struct Extractor *extractor, const char *data, uint32_t length) {
+  if (extractor->failed) return;
+  if (extractor->names_used + length > extractor->names_capacity) {
+    uint32_t capacity = extractor->names_capacity ? extractor->names_capacity : 4096;
+    while (capacity < extractor->names_used + length) capacity *= 2;
+    char *names = (char *)realloc(extractor->names, capacity);
+    if (!names) {
+      extractor->failed = true;
+      return;
+    }
+    extractor->names = names;
+    extractor->names_capacity = capacity;
+  }
+  memcpy(extractor->names + extractor->names_used, data, length);
+  extractor->names_used += length;
+}
+
+// A label or member name from the source, cut to CALL_GRAPH_MAX_MEMBER
+static void append_span(struct Extractor *extractor, struct Span span) {
+  if (is_empty(span) || span.end > extractor->length) return;
+  uint32_t length = span.end - span.start;
+  append(extractor, extractor->text + span.start,
+         length > CALL_GRAPH_MAX_MEMBER ? CALL_GRAPH_MAX_MEMBER : length);
+}
+
+// A class name, qualified relative to the current class
+static void append_class(struct Extractor *extractor, struct Span span) {
+  if (is_empty(span) || span.end > extractor->length) return;
+  const char *class_name = "";
+  uint32_t class_length = 0;
+  if (!is_empty(extractor->class_name) && extractor->class_name.end <= extractor->length) {
+    class_name = extractor->text + extractor->class_name.start;
+    class_length = extractor->class_name.end - extractor->class_name.start;
+    if (class_length > OBJECTSCRIPT_CLASS_GRAPH_MAX_NAME) {
+      class_length = OBJECTSCRIPT_CLASS_GRAPH_MAX_NAME;
+    }
+  }
+  char buffer[OBJECTSCRIPT_CLASS_GRAPH_MAX_NAME];
+  append(extractor, buffer,
+         ObjectScript_Class_Graph_resolve_name(extractor->text + span.start,
+                                               span.end - span.start, class_name,
+                                               class_length, buffer));
+}
+
+// Class:Member in classes, label^routine in routines, or false outside of
+// anything that can call
+static bool current_caller(struct Extractor *extractor) {
+  if (extractor->caller != OBJECTSCRIPT_CALL_NONE) return true;
+  uint32_t start = extractor->names_used;
+  if (extractor->class_end) {
+    if (is_empty(extractor->member)) return false;
+    append_class(extractor, extractor->class_name);
+    append(extractor, ":", 1);
+    append_span(extractor, extractor->member);
+  } else {
+    append_span(extractor, extractor->label);
+    append(extractor, "^", 1);
+    append(extractor, extractor->routine, extractor->routine_length);
+  }
+  if (extractor->failed) return false;
+  extractor->caller = start;
+  extractor->caller_length = extractor->names_used - start;
+  return true;
+}
+
+enum {
+  Callee_resolved,
+  Callee_unresolved,
+  Callee_local,   // A label of the same method
+};
+
+// label^routine, from a line_ref or an extrinsic_function
+static uint8_t append_line_ref(struct Extractor *extractor, TSNode ref) {
+  const struct Language_Roles *roles = extractor->roles;
+  struct Span label = node_span(ts_node_child_by_field_id(ref, roles->label_field));
+  struct Span routine = node_span(ts_node_child_by_field_id(ref, roles->routine_field));
+  if (is_empty(label) && is_empty(routine)) return Callee_unresolved;   // Indirection
+  if (is_empty(routine) && extractor->class_end) return Callee_local;
+
+  append_span(extractor, label);
+  append(extractor, "^", 1);
+  if (is_empty(routine)) {
+    append(extractor, extractor->routine, extractor->routine_length);
+  } else {
+    // The routine_ref includes the caret
+    while (routine.start < routine.end && routine.start < extractor->length &&
+           (extractor->text[routine.start] == '^' || extractor->text[routine.start] == ' ')) {
+      routine.start++;
+    }
+    append_span(extractor, routine);
+  }
+  return Callee_resolved;
+}
+
+static uint8_t append_callee(struct Extractor *extractor, TSNode node, uint8_t role) {
+  switch (role) {
+    case Role_class_method_call: {
+      // ##class(Name).Method(), unless the class is an expression
+      TSNode class_ref = child_with_role(extractor, node, Role_class_ref);
+      if (ts_node_is_null(class_ref)) return Callee_unresolved;
+      struct Span class_name = node_span(child_with_role(extractor, class_ref, Role_class_name));
+      struct Span method = node_span(child_with_role(extractor, node, Role_method_name));
+      if (is_empty(class_name) || is_empty(method)) return Callee_unresolved;
+      append_class(extractor, class_name);
+      append(extractor, ":", 1);
+      append_span(extractor, method);
+      return Callee_resolved;
+    }
+    case Role_relative_dot_method: {
+      TSNode method = child_with_role(extractor, node, Role_oref_method);
+      struct Span name = ts_node_is_null(method)
+                             ? (struct Span){0, 0}
+                             : node_span(child_with_role(extractor, method, Role_method_name));
+      if (!extractor->class_end || is_empty(name)) return Callee_unresolved;
+      append_class(extractor, extractor->class_name);
+      append(extractor, ":", 1);
+      append_span(extractor, name);
+      return Callee_resolved;
+    }
+    case Role_superclass_method_call:
+      // The same method, as the primary superclass has it
+      if (!extractor->class_end || is_empty(extractor->superclass)) return Callee_unresolved;
+      append_class(extractor, extractor->superclass);
+      append(extractor, ":", 1);
+      append_span(extractor, extractor->member);
+      return Callee_resolved;
+    case Role_routine_tag_call: {
+      TSNode ref = child_with_role(extractor, node, Role_line_ref);
+      return ts_node_is_null(ref) ? Callee_unresolved : append_line_ref(extractor, ref);
+    }
+    case Role_extrinsic_function:
+      return append_line_ref(extractor, node);
+  }
+  return Callee_unresolved;
+}
+
+static void add_call(struct Extractor *extractor, TSNode node, uint8_t role, uint32_t kind) {
+  // The caller first, so its name isn't interleaved with the callee's
+  if (!current_caller(extractor)) {
+    if (!extractor->failed) extractor->unresolved++;
+    return;
+  }
+  uint32_t callee = extractor->names_used;
+  uint8_t result = append_callee(extractor, node, role);
+  if (extractor->failed) return;
+  if (result != Callee_resolved) {
+    extractor->names_used = callee;
+    if (result == Callee_unresolved) extractor->unresolved++;
+    return;
+  }
+
+  if (extractor->call_count == extractor->call_capacity) {
+    uint32_t capacity = extractor->call_capacity ? extractor->call_capacity * 2 : 256;
+    struct Raw_Call *calls =
+        (struct Raw_Call *)realloc(extractor->calls, capacity * sizeof(struct Raw_Call));
+    if (!calls) {
+      extractor->failed = true;
+      return;
+    }
+    extractor->calls = calls;
+    extractor->call_capacity = capacity;
+  }
+  extractor->calls[extractor->call_count++] =
+      (struct Raw_Call){extractor->caller, extractor->caller_length, callee,
+                        extractor->names_used - callee, kind};
+}
+
+// The routine name of a file: its name without directories or extension
+static void set_routine(struct Extractor *extractor, const char *path) {
+  const char *name = strrchr(path, '/');
+  name = name ? name + 1 : path;
+  const char *extension = strrchr(name, '.');
+  extractor->routine = name;
+  extractor->routine_length =
+      (uint32_t)(extension && extension != name ? (size_t)(extension - name) : strlen(name));
+}
+
+static bool extract(const struct ObjectScript_Call_Graph *graph, struct Extractor *extractor,
+                    const char *path, const TSTree *tree, const char *text, uint32_t length) {
+  extractor->roles = ts_tree_language(tree) == graph->udl.language ? &graph->udl : &graph->core;
+  extractor->names_used = 0;
+  extractor->call_count = 0;
+  extractor->unresolved = 0;
+  extractor->failed = false;
+  extractor->text = text;
+  extractor->length = length;
+  set_routine(extractor, path);
+  extractor->class_name = extractor->superclass = extractor->member = extractor->label =
+      (struct Span){0, 0};
+  extractor->class_end = extractor->member_end = 0;
+  extractor->caller = OBJECTSCRIPT_CALL_NONE;
+  if (!extractor->roles->roles) return true;
+
+  TSTreeCursor cursor = ts_tree_cursor_new(ts_tree_root_node(tree));
+  for (;;) {
+    TSNode node = ts_tree_cursor_current_node(&cursor);
+    uint32_t start = ts_node_start_byte(node);
+
+    // Pre-order, so the first node at or past the end of the member (or
+    // class) is outside of it.  In routines a label lasts until the next.
+    if (extractor->member_end && start >= extractor->member_end) {
+      extractor->member = extractor->label = (struct Span){0, 0};
+      extractor->member_end = 0;
+      extractor->caller = OBJECTSCRIPT_CALL_NONE;
+    }
+    if (extractor->class_end && start >= extractor->class_end) {
+      extractor->class_name = extractor->superclass = extractor->label = (struct Span){0, 0};
+      extractor->class_end = 0;
+      extractor->caller = OBJECTSCRIPT_CALL_NONE;
+    }
+
+    bool descend = true;
+    uint8_t role = node_role(extractor, node);
+    switch (role) {
+      case Role_skip:
+        descend = false;
+        break;
+      case Role_class_definition: {
+        extractor->class_name =
+            node_span(ts_node_child_by_field_id(node, extractor->roles->class_name_field));
+        TSNode extends = child_with_role(extractor, node, Role_class_extends);
+        extractor->superclass =
+            ts_node_is_null(extends)
+                ? (struct Span){0, 0}
+                : node_span(child_with_role(extractor, extends, Role_identifier));
+        extractor->class_end = ts_node_end_byte(node);
+        extractor->label = (struct Span){0, 0};
+        extractor->caller = OBJECTSCRIPT_CALL_NONE;
+        break;
+      }
+      case Role_method:
+      case Role_trigger: {
+        TSNode named = role == Role_method
+                           ? child_with_role(extractor, node, Role_method_definition)
+                           : node;
+        extractor->member =
+            ts_node_is_null(named)
+                ? (struct Span){0, 0}
+                : node_span(ts_node_child_by_field_id(named, extractor->roles->name_field));
+        extractor->member_end = ts_node_end_byte(node);
+        extractor->label = (struct Span){0, 0};
+        extractor->caller = OBJECTSCRIPT_CALL_NONE;
+        break;
+      }
+      case Role_tag:
+        extractor->label = node_span(node);
+        if (!extractor->class_end) extractor->caller = OBJECTSCRIPT_CALL_NONE;
+        break;
+      case Role_class_method_call:
+        add_call(extractor, node, role, ObjectScript_Call_class_method);
+        break;
+      case Role_relative_dot_method:
+        add_call(extractor, node, role, ObjectScript_Call_relative);
+        break;
+      case Role_superclass_method_call:
+        add_call(extractor, node, role, ObjectScript_Call_superclass);
+        break;
+      case Role_routine_tag_call:
+        add_call(extractor, node, role, ObjectScript_Call_routine_tag);
+        break;
+      case Role_extrinsic_function:
+        add_call(extractor, node, role, ObjectScript_Call_extrinsic);
+        break;
+    }
+    if (extractor->failed) break;
+
+    if (descend && ts_tree_cursor_goto_first_child(&cursor)) continue;
+    bool done = false;
+    while (!ts_tree_cursor_goto_next_sibling(&cursor)) {
+      if (!ts_tree_cursor_goto_parent(&cursor)) {
+        done = true;
+        break;
+      }
+    }
+    if (done) break;
+  }
+  ts_tree_cursor_delete(&cursor);
+
+  extractor->text = NULL;
+  return !extractor->failed;
+}
+
+// Growable arrays
+
+static bool edge_list_push(struct Edge_List *list, struct ObjectScript_Call_Edge edge) {
+  if (list->count == list->capacity) {
+    uint32_t capacity = list->capacity ? list->capacity * 2 : 4;
+    struct ObjectScript_Call_Edge *data = (struct ObjectScript_Call_Edge *)realloc(
+        list->data, capacity * sizeof(struct ObjectScript_Call_Edge));
+    if (!data) return false;
+    list->data = data;
+    list->capacity = capacity;
+  }
+  list->data[list->count++] = edge;
+  return true;
+}
+
+static bool id_list_push(struct Id_List *list, uint32_t id) {
+  if (list->count == list->capacity) {
+    uint32_t capacity = list->capacity ? list->capacity * 2 : 4;
+    uint32_t *data = (uint32_t *)realloc(list->data, capacity * sizeof(uint32_t));
+    if (!data) return false;
+    list->data = data;
+    list->capacity = capacity;
+  }
+  list->data[list->count++] = id;
+  return true;
+}
+
+// Make room for ids up to `id` in a side array, zero filling new entries
+static bool reserve(void **array, uint32_t *capacity, uint32_t id, size_t size) {
+  if (id < *capacity) return true;
+  uint32_t grown = *capacity ? *capacity : 1024;
+  while (grown <= id) grown *= 2;
+  void *data = realloc(*array, grown * size);
+  if (!data) return false;
+  memset((char *)data + *capacity * size, 0, (grown - *capacity) * size);
+  *array = data;
+  *capacity = grown;
+  return true;
+}
+
+static uint32_t intern_symbol(struct ObjectScript_Call_Graph *graph, const char *name,
+                              uint32_t length) {
+  uint32_t id = ObjectScript_String_Table_intern(graph->names, name, length);
+  if (id == OBJECTSCRIPT_STRING_NONE) return OBJECTSCRIPT_CALL_NONE;
+  uint32_t capacity = graph->symbol_capacity;
+  if (!reserve((void **)&graph->symbols, &graph->symbol_capacity, id, sizeof(struct Symbol))) {
+    return OBJECTSCRIPT_CALL_NONE;
+  }
+  for (uint32_t i = capacity; i < graph->symbol_capacity; i++) {
+    graph->symbols[i].file = OBJECTSCRIPT_CALL_NONE;
+  }
+  return id;
+}
+
+// Edges
+
+static void remove_in_edge(struct Symbol *target, uint32_t source, uint32_t kind) {
+  struct Edge_List *in = &target->in;
+  for (uint32_t i = 0; i < in->count; i++) {
+    if (in->data[i].symbol_id == source && in->data[i].kind == kind) {
+      // Keep the order, callers are listed in the order they were added
+      memmove(&in->data[i], &in->data[i + 1], (in->count - i - 1) * sizeof(in->data[0]));
+      in->count--;
+      return;
+    }
+  }
+}
+
+static void clear_out_edges(struct ObjectScript_Call_Graph *graph, uint32_t symbol_id) {
+  struct Symbol *entry = &graph->symbols[symbol_id];
+  for (uint32_t i = 0; i < entry->out.count; i++) {
+    remove_in_edge(&graph->symbols[entry->out.data[i].symbol_id], symbol_id,
+                   entry->out.data[i].kind);
+  }
+  graph->edges -= entry->out.count;
+  entry->out.count = 0;
+}
+
+static bool add_edge(struct ObjectScript_Call_Graph *graph, uint32_t source, uint32_t target,
+                     uint32_t kind) {
+  struct Edge_List *out = &graph->symbols[source].out;
+  for (uint32_t i = 0; i < out->count; i++) {
+    if (out->data[i].symbol_id == target && out->data[i].kind == kind) return true;
+  }
+  if (!edge_list_push(out, (struct ObjectScript_Call_Edge){target, kind})) return false;
+  if (!edge_list_push(&graph->symbols[target].in, (struct ObjectScript_Call_Edge){source, kind})) {
+    out->count--;
+    return false;
+  }
+  graph->edges++;
+  return true;
+}
+
+// Files
+
+static void forget_file(struct ObjectScript_Call_Graph *graph, uint32_t file) {
+  struct File *entry = &graph->files[file];
+  for (uint32_t i = 0; i < entry->callers.count; i++) {
+    uint32_t symbol_id = entry->callers.data[i];
+    // Unless another file has had calls from it since
+    if (graph->symbols[symbol_id].file != file) continue;
+    clear_out_edges(graph, symbol_id);
+    graph->symbols[symbol_id].file = OBJECTSCRIPT_CALL_NONE;
+    graph->callers--;
+  }
+  entry->callers.count = 0;
+  graph->calls -= entry->calls;
+  graph->unresolved -= entry->unresolved;
+  entry->calls = entry->unresolved = 0;
+}
+
+// Replace the calls of `path` with what the extractor found, on one thread
+static bool merge(struct ObjectScript_Call_Graph *graph, const char *path,
+                  const struct Extractor *extractor) {
+  uint32_t file = ObjectScript_String_Table_intern(graph->paths, path, (uint32_t)strlen(path));
+  if (file == OBJECTSCRIPT_STRING_NONE ||
+      !reserve((void **)&graph->files, &graph->file_capacity, file, sizeof(struct File))) {
+    return false;
+  }
+  forget_file(graph, file);
+
+  for (uint32_t i = 0; i < extractor->call_count; i++) {
+    const struct Raw_Call *call = &extractor->calls[i];
+    uint32_t caller =
+        intern_symbol(graph, extractor->names + call->caller, call->caller_length);
+    uint32_t callee =
+        intern_symbol(graph, extractor->names + call->callee, call->callee_length);
+    if (caller == OBJECTSCRIPT_CALL_NONE || callee == OBJECTSCRIPT_CALL_NONE) return false;
+
+    // Its first call in this file.  A method moved between files: the last
+    // update wins.
+    struct Symbol *entry = &graph->symbols[caller];
+    if (entry->file != file) {
+      if (entry->file == OBJECTSCRIPT_CALL_NONE) {
+        graph->callers++;
+      } else {
+        clear_out_edges(graph, caller);
+      }
+      entry->file = file;
+      if (!id_list_push(&graph->files[file].callers, caller)) return false;
+    }
+    if (!add_edge(graph, caller, callee, call->kind)) return false;
+  }
+  graph->files[file].calls = extractor->call_count;
+  graph->files[file].unresolved = extractor->unresolved;
+  graph->calls += extractor->call_count;
+  graph->unresolved += extractor->unresolved;
+  return true;
+}
+
+bool ObjectScript_Call_Graph_update(struct ObjectScript_Call_Graph *graph, const char *path,
+                                    const TSTree *tree, const char *text, uint32_t length) {
+  return extract(graph, &graph->extractor, path, tree, text, length) &&
+         merge(graph, path, &graph->extractor);
+}
+
+void ObjectScript_Call_Graph_remove_file(struct ObjectScript_Call_Graph *graph,
+                                         const char *path) {
+  uint32_t file = ObjectScript_String_Table_lookup(graph->paths, path, (uint32_t)strlen(path));
+  if (file != OBJECTSCRIPT_STRING_NONE && file < graph->file_capacity) forget_file(graph, file);
+}
+
+// Thread pool
+
+struct Pool {
+  struct ObjectScript_Call_Graph *graph;
+  const char *const *paths;
+  uint32_t count;
+  atomic_uint next;
+  atomic_bool failed;
+  pthread_mutex_t merge_lock;
+};
+
+static bool read_file(const char *path, char **data, uint32_t *capacity, uint32_t *length) {
+  FILE *file = fopen(path, "rb");
+  if (!file) return false;
+  bool ok = true;
+  *length = 0;
+  for (;;) {
+    if (*capacity - *length < 65536) {
+      uint32_t grown = *capacity ? *capacity * 2 : 65536;
+      char *buffer = (char *)realloc(*data, grown);
+      if (!buffer) {
+        ok = false;
+        break;
+      }
+      *data = buffer;
+      *capacity = grown;
+    }
+    size_t n = fread(*data + *length, 1, *capacity - *length, file);
+    if (n == 0) break;
+    *length += (uint32_t)n;
+  }
+  if (ferror(file)) ok = false;
+  fclose(file);
+  return ok;
+}
+
+static bool is_class_file(const char *path) {
+  size_t length = strlen(path);
+  return length > 4 && !strcasecmp(path + length - 4, ".cls");
+}
+
+static void *pool_worker(void *payload) {
+  struct Pool *pool = (struct Pool *)payload;
+  struct ObjectScript_Call_Graph *graph = pool->graph;
+  struct Extractor extractor = {0};
+  TSParser *parsers[2] = {NULL, NULL};
+  char *text = NULL;
+  uint32_t capacity = 0;
+
+  for (;;) {
+    uint32_t i = atomic_fetch_add(&pool->next, 1);
+    if (i >= pool->count) break;
+    const char *path = pool->paths[i];
+    uint32_t length;
+    if (!read_file(path, &text, &capacity, &length)) {
+      atomic_store(&pool->failed, true);
+      continue;
+    }
+
+    // Files of a grammar the graph wasn't given are skipped
+    bool udl = is_class_file(path);
+    const TSLanguage *language = udl ? graph->udl.language : graph->core.language;
+    if (!language) continue;
+    TSParser **parser = &parsers[udl ? 0 : 1];
+    if (!*parser) {
+      *parser = ts_parser_new();
+      ts_parser_set_language(*parser, language);
+    }
+
+    TSTree *tree = ts_parser_parse_string(*parser, NULL, text, length);
+    bool ok = tree && extract(graph, &extractor, path, tree, text, length);
+    ts_tree_delete(tree);
+    if (ok) {
+      pthread_mutex_lock(&pool->merge_lock);
+      ok = merge(graph, path, &extractor);
+      pthread_mutex_unlock(&pool->merge_lock);
+    }
+    if (!ok) atomic_store(&pool->failed, true);
+  }
+
+  if (parsers[0]) ts_parser_delete(parsers[0]);
+  if (parsers[1]) ts_parser_delete(parsers[1]);
+  extractor_free(&extractor);
+  free(text);
+  return NULL;
+}
+
+bool ObjectScript_Call_Graph_add_files(struct ObjectScript_Call_Graph *graph,
+                                       const char *const *paths, uint32_t count,
+                                       uint32_t threads) {
+  if (threads == 0) {
+    long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+    threads = cpus > 0 ? (uint32_t)cpus : 1;
+  }
+  if (threads > count) threads = count ? count : 1;
+
+  struct Pool pool = {.graph = graph, .paths = paths, .count = count};
+  atomic_init(&pool.next, 0);
+  atomic_init(&pool.failed, false);
+  pthread_mutex_init(&pool.merge_lock, NULL);
+
+  // The calling thread is one of the workers
+  pthread_t *workers = (pthread_t *)calloc(threads, sizeof(pthread_t));
+  uint32_t started = 0;
+  if (workers) {
+    while (started + 1 < threads &&
+           pthread_create(&workers[started], NULL, pool_worker, &pool) == 0) {
+      started++;
+    }
+  }
+  pool_worker(&pool);
+  for (uint32_t i = 0; i < started; i++) pthread_join(workers[i], NULL);
+  free(workers);
+  pthread_mutex_destroy(&pool.merge_lock);
+  return !atomic_load(&pool.failed);
+}
+
+// Queries
+
+uint32_t ObjectScript_Call_Graph_lookup(const struct ObjectScript_Call_Graph *graph,
+                                        const char *name, uint32_t length) {
+  return ObjectScript_String_Table_lookup(graph->names, name, length);
+}
+
+const char *ObjectScript_Call_Graph_name(const struct ObjectScript_Call_Graph *graph,
+                                         uint32_t symbol_id) {
+  return ObjectScript_String_Table_get(graph->names, symbol_id, NULL);
+}
+
+const char *ObjectScript_Call_Graph_file(const struct ObjectScript_Call_Graph *graph,
+                                         uint32_t symbol_id) {
+  if (symbol_id >= ObjectScript_String_Table_count(graph->names)) return NULL;
+  uint32_t file = graph->symbols[symbol_id].file;
+  return file == OBJECTSCRIPT_CALL_NONE ? NULL
+                                        : ObjectScript_String_Table_get(graph->paths, file, NULL);
+}
+
+const struct ObjectScript_Call_Edge *ObjectScript_Call_Graph_callees(
+    const struct ObjectScript_Call_Graph *graph, uint32_t symbol_id, uint32_t *count) {
+  *count = 0;
+  if (symbol_id >= ObjectScript_String_Table_count(graph->names)) return NULL;
+  *count = graph->symbols[symbol_id].out.count;
+  return graph->symbols[symbol_id].out.data;
+}
+
+const struct ObjectScript_Call_Edge *ObjectScript_Call_Graph_callers(
+    const struct ObjectScript_Call_Graph *graph, uint32_t symbol_id, uint32_t *count) {
+  *count = 0;
+  if (symbol_id >= ObjectScript_String_Table_count(graph->names)) return NULL;
+  *count = graph->symbols[symbol_id].in.count;
+  return graph->symbols[symbol_id].in.data;
+}
+
+const uint32_t *ObjectScript_Call_Graph_closure(struct ObjectScript_Call_Graph *graph,
+                                                uint32_t symbol_id, bool reverse,
+                                                uint32_t kinds, uint32_t *count) {
+  *count = 0;
+  graph->result.count = 0;
+  if (symbol_id >= ObjectScript_String_Table_count(graph->names)) return NULL;
+
+  // Marks are compared against a new epoch per query instead of cleared
+  if (++graph->epoch == 0) {
+    for (uint32_t i = 0; i < graph->symbol_capacity; i++) graph->symbols[i].mark = 0;
+    graph->epoch = 1;
+  }
+  graph->symbols[symbol_id].mark = graph->epoch;
+
+  // The result doubles as the breadth first queue
+  uint32_t next = 0;
+  uint32_t current = symbol_id;
+  for (;;) {
+    const struct Edge_List *edges =
+        reverse ? &graph->symbols[current].in : &graph->symbols[current].out;
+    for (uint32_t i = 0; i < edges->count; i++) {
+      const struct ObjectScript_Call_Edge *edge = &edges->data[i];
+      struct Symbol *other = &graph->symbols[edge->symbol_id];
+      if (!(edge->kind & kinds) || other->mark == graph->epoch) continue;
+      other->mark = graph->epoch;
+      if (!id_list_push(&graph->result, edge->symbol_id)) return NULL;
+    }
+    if (next == graph->result.count) break;
+    current = graph->result.data[next++];
+  }
+  *count = graph->result.count;
+  return graph->result.data;
+}
@@ -0,0 +1,124 @@
+#ifndef OBJECTSCRIPT_CALL_GRAPH_H_
+#define OBJECTSCRIPT_CALL_GRAPH_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stddef.h>
+#include <tree_sitter/api.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Workspace call graph, for impact analysis: who calls a method or a label.
+//
+// Callers and callees are interned symbols named the way they are written
+// in the language:
+//
+//   Pkg.Class:Method      a method or classmethod (callers in .cls files)
+//   label^routine         a label of a routine (callers in routines)
+//   ^routine              a routine's code before its first label
+//
+// Calls come from the node types the grammar already distinguishes:
+//
+//   ##class(X).Y()        class_method_call, to X:Y
+//   ..Y()                 relative_dot_method, to Current.Class:Y
+//   ##super()             superclass_method_call, to FirstSuperclass:Method
+//   DO tag^rtn            routine_tag_call, to tag^rtn
+//   $$tag^rtn()           extrinsic_function, to tag^rtn
+//
+// Class names are resolved as in class_graph.h.  A label without a routine
+// is in the current routine; in a class it is local to the method and not
+// an edge.  Calls through indirection (@x), on an expression (##class(@c))
+// or to a superclass that isn't known are counted as unresolved.
+//
+// Calling ObjectScript_Call_Graph_update() again for a file replaces the
+// calls it made, so a watcher can keep the graph current.
+// ObjectScript_Call_Graph_add_files() reads, parses and extracts many files
+// on a pool of threads; only the merge into the graph is serialized.
+//
+// A graph is otherwise not thread safe: queries share a scratch buffer.
+struct ObjectScript_Call_Graph;
+
+#define OBJECTSCRIPT_CALL_NONE UINT32_MAX
+
+// Call kinds, also used as masks
+enum {
+  ObjectScript_Call_class_method = 1 << 0,   // ##class(X).Y()
+  ObjectScript_Call_relative     = 1 << 1,   // ..Y()
+  ObjectScript_Call_superclass   = 1 << 2,   // ##super()
+  ObjectScript_Call_routine_tag  = 1 << 3,   // DO tag^rtn
+  ObjectScript_Call_extrinsic    = 1 << 4,   // $$tag^rtn()
+  ObjectScript_Call_all          = 0x1f,
+};
+
+struct ObjectScript_Call_Edge {
+  uint32_t symbol_id;   // The other end
+  uint32_t kind;
+};
+
+struct ObjectScript_Call_Graph_Stats {
+  uint32_t symbols;      // Callers and callees
+  uint32_t callers;      // Symbols some file has calls from
+  uint32_t files;
+  uint64_t edges;        // Distinct (caller, callee, kind)
+  uint64_t calls;        // Call sites, including repeated ones
+  uint64_t unresolved;
+};
+
+// `udl` is used for .cls files, `core` for routines (.mac, .int, ...).
+// Either may be NULL if the workspace has no such files.
+struct ObjectScript_Call_Graph *ObjectScript_Call_Graph_new(const TSLanguage *udl,
+                                                            const TSLanguage *core);
+void ObjectScript_Call_Graph_delete(struct ObjectScript_Call_Graph *graph);
+
+void ObjectScript_Call_Graph_stats(const struct ObjectScript_Call_Graph *graph,
+                                   struct ObjectScript_Call_Graph_Stats *stats);
+
+// Replace the calls made from `path` with the ones in `tree`, parsed from
+// `text` by either language.  For routines, the routine name is the file
+// name without its extension.  Returns false if out of memory.
+bool ObjectScript_Call_Graph_update(struct ObjectScript_Call_Graph *graph, const char *path,
+                                    const TSTree *tree, const char *text, uint32_t length);
+
+// Read, parse and update each of `paths` on `threads` threads (0 for one per
+// CPU).  Returns false if any file could not be read or memory ran out; the
+// others are still added.
+bool ObjectScript_Call_Graph_add_files(struct ObjectScript_Call_Graph *graph,
+                                       const char *const *paths, uint32_t count,
+                                       uint32_t threads);
+
+// Forget the calls made from `path`, e.g. when it was deleted
+void ObjectScript_Call_Graph_remove_file(struct ObjectScript_Call_Graph *graph,
+                                         const char *path);
+
+// The id of a symbol named as above, or OBJECTSCRIPT_CALL_NONE
+uint32_t ObjectScript_Call_Graph_lookup(const struct ObjectScript_Call_Graph *graph,
+                                        const char *name, uint32_t length);
+
+const char *ObjectScript_Call_Graph_name(const struct ObjectScript_Call_Graph *graph,
+                                         uint32_t symbol_id);
+
+// The file the symbol's calls were read from, or NULL if it only is called
+const char *ObjectScript_Call_Graph_file(const struct ObjectScript_Call_Graph *graph,
+                                         uint32_t symbol_id);
+
+// Direct edges, in the order of the source.  Valid until the next update.
+const struct ObjectScript_Call_Edge *ObjectScript_Call_Graph_callees(
+    const struct ObjectScript_Call_Graph *graph, uint32_t symbol_id, uint32_t *count);
+const struct ObjectScript_Call_Edge *ObjectScript_Call_Graph_callers(
+    const struct ObjectScript_Call_Graph *graph, uint32_t symbol_id, uint32_t *count);
+
+// Every symbol reachable from `symbol_id` over calls of the `kinds` mask,
+// breadth first and without `symbol_id` itself: what it calls, or with
+// `reverse` everything that calls it, directly or not.  The array is valid
+// until the next query or update.
+const uint32_t *ObjectScript_Call_Graph_closure(struct ObjectScript_Call_Graph *graph,
+                                                uint32_t symbol_id, bool reverse,
+                                                uint32_t kinds, uint32_t *count);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // OBJECTSCRIPT_CALL_GRAPH_H_
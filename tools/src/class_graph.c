@@ -0,0 +1,572 @@
+#include "class_graph.h"
+#include "string_table.h"
+#include <stdlib.h>
+#include <string.h>
+
+// What a node type means to the extraction pass, by symbol
+enum {
+  Role_none,
+  Role_class_definition,
+  Role_class_extends,
+  Role_class_body,
+  Role_class_statement,
+  Role_typed_member,      // property, parameter, projection
+  Role_relationship,
+  Role_foreignkey,
+  Role_property_type,
+  Role_projection_type,
+  Role_typename,
+  Role_identifier,
+  Role_keyword_references,
+};
+
+struct Role_Name {
+  const char *name;
+  uint8_t role;
+};
+
+static const struct Role_Name ROLE_NAMES[] = {
+  {"class_definition", Role_class_definition},
+  {"class_extends", Role_class_extends},
+  {"class_body", Role_class_body},
+  {"class_statement", Role_class_statement},
+  {"property", Role_typed_member},
+  {"parameter", Role_typed_member},
+  {"projection", Role_typed_member},
+  {"relationship", Role_relationship},
+  {"foreignkey", Role_foreignkey},
+  {"property_type", Role_property_type},
+  {"projection_type", Role_projection_type},
+  {"typename", Role_typename},
+  {"identifier", Role_identifier},
+  {"keyword_references", Role_keyword_references},
+};
+
+struct Edge_List {
+  struct ObjectScript_Class_Edge *data;
+  uint32_t count;
+  uint32_t capacity;
+};
+
+struct Id_List {
+  uint32_t *data;
+  uint32_t count;
+  uint32_t capacity;
+};
+
+struct Class {
+  uint32_t file;            // Path id, or OBJECTSCRIPT_CLASS_NONE
+  struct Edge_List out;     // Dependencies
+  struct Edge_List in;      // Dependents
+  uint32_t mark;            // Query epoch
+};
+
+// A reference found in the tree, resolved once the class name is known
+struct Pending_Edge {
+  uint32_t start;
+  uint32_t end;
+  uint32_t kind;
+};
+
+struct ObjectScript_Class_Graph {
+  struct ObjectScript_String_Table *names;   // Class ids
+  struct ObjectScript_String_Table *paths;   // File ids
+  struct Class *classes;
+  uint32_t class_capacity;
+  struct Id_List *files;                     // Classes defined, by file id
+  uint32_t file_capacity;
+  uint32_t defined;
+  uint64_t edges;
+
+  uint8_t *roles;
+  uint32_t symbol_count;
+  TSFieldId class_name_field;
+
+  // Scratch for extraction and queries
+  struct Pending_Edge *pending;
+  uint32_t pending_count;
+  uint32_t pending_capacity;
+  struct Id_List result;
+  uint32_t epoch;
+};
+
+struct ObjectScript_Class_Graph *ObjectScript_Class_Graph_new(const TSLanguage *language) {
+  struct ObjectScript_Class_Graph *graph =
+      (struct ObjectScript_Class_Graph *)calloc(1, sizeof(*graph));
+  if (!graph) return NULL;
+  graph->names = ObjectScript_String_Table_new();
+  graph->paths = ObjectScript_String_Table_new();
+  graph->symbol_count = ts_language_symbol_count(language);
+  graph->roles = (uint8_t *)calloc(graph->symbol_count, 1);
+  if (!graph->names || !graph->paths || !graph->roles) {
+    ObjectScript_Class_Graph_delete(graph);
+    return NULL;
+  }
+
+  // By name, so that aliased symbols (foreignkey's identifiers) are covered
+  for (uint32_t symbol = 0; symbol < graph->symbol_count; symbol++) {
+    if (ts_language_symbol_type(language, (TSSymbol)symbol) != TSSymbolTypeRegular) continue;
+    const char *name = ts_language_symbol_name(language, (TSSymbol)symbol);
+    for (size_t i = 0; i < sizeof(ROLE_NAMES) / sizeof(ROLE_NAMES[0]); i++) {
+      if (!strcmp(name, ROLE_NAMES[i].name)) {
+        graph->roles[symbol] = ROLE_NAMES[i].role;
+        break;
+      }
+    }
+  }
+  graph->class_name_field = ts_language_field_id_for_name(language, "class_name", 10);
+  return graph;
+}
+
+void ObjectScript_Class_Graph_delete(struct ObjectScript_Class_Graph *graph) {
+  if (!graph) return;
+  for (uint32_t i = 0; i < graph->class_capacity; i++) {
+    free(graph->classes[i].out.data);
+    free(graph->classes[i].in.data);
+  }
+  for (uint32_t i = 0; i < graph->file_capacity; i++) free(graph->files[i].data);
+  free(graph->classes);
+  free(graph->files);
+  free(graph->roles);
+  free(graph->pending);
+  free(graph->result.data);
+  ObjectScript_String_Table_delete(graph->names);
+  ObjectScript_String_Table_delete(graph->paths);
+  free(graph);
+}
+
+void ObjectScript_Class_Graph_stats(const struct ObjectScript_Class_Graph *graph,
+                                    struct ObjectScript_Class_Graph_Stats *stats) {
+  stats->classes = ObjectScript_String_Table_count(graph->names);
+  stats->defined = graph->defined;
+  stats->files = ObjectScript_String_Table_count(graph->paths);
+  stats->edges = graph->edges;
+}
+
+// Growable arrays
+
+static bool edge_list_push(struct Edge_List *list, struct ObjectScript_Class_Edge edge) {
+  if (list->count == list->capacity) {
+    uint32_t capacity = list->capacity ? list->capacity * 2 : 4;
+    struct ObjectScript_Class_Edge *data = (struct ObjectScript_Class_Edge *)realloc(
+        list->data, capacity * sizeof(struct ObjectScript_Class_Edge));
+    if (!data) return false;
+    list->data = data;
+    list->capacity = capacity;
+  }
+  list->data[list->count++] = edge;
+  return true;
+}
+
+static bool id_list_push(struct Id_List *list, uint32_t id) {
+  if (list->count == list->capacity) {
+    uint32_t capacity = list->capacity ? list->capacity * 2 : 4;
+    uint32_t *data = (uint32_t *)realloc(list->data, capacity * sizeof(uint32_t));
+    if (!data) return false;
+    list->data = data;
+    list->capacity = capacity;
+  }
+  list->data[list->count++] = id;
+  return true;
+}
+
+// Make room for ids up to `id` in a side array, zero filling new entries
+static bool reserve(void **array, uint32_t *capacity, uint32_t id, size_t size) {
+  if (id < *capacity) return true;
+  uint32_t grown = *capacity ? *capacity : 1024;
+  while (grown <= id) grown *= 2;
+  void *data = realloc(*array, grown * size);
+  if (!data) return false;
+  memset((char *)data + *capacity * size, 0, (grown - *capacity) * size);
+  *array = data;
+  *capacity = grown;
+  return true;
+}
+
+static uint32_t intern_class(struct ObjectScript_Class_Graph *graph, const char *name,
+                             uint32_t length) {
+  uint32_t id = ObjectScript_String_Table_intern(graph->names, name, length);
+  if (id == OBJECTSCRIPT_STRING_NONE) return OBJECTSCRIPT_CLASS_NONE;
+  uint32_t capacity = graph->class_capacity;
+  if (!reserve((void **)&graph->classes, &graph->class_capacity, id, sizeof(struct Class))) {
+    return OBJECTSCRIPT_CLASS_NONE;
+  }
+  for (uint32_t i = capacity; i < graph->class_capacity; i++) {
+    graph->classes[i].file = OBJECTSCRIPT_CLASS_NONE;
+  }
+  return id;
+}
+
+// Edges
+
+static void remove_in_edge(struct Class *target, uint32_t source, uint32_t kind) {
+  struct Edge_List *in = &target->in;
+  for (uint32_t i = 0; i < in->count; i++) {
+    if (in->data[i].class_id == source && in->data[i].kind == kind) {
+      // Keep the order, dependents are listed in the order they were added
+      memmove(&in->data[i], &in->data[i + 1], (in->count - i - 1) * sizeof(in->data[0]));
+      in->count--;
+      return;
+    }
+  }
+}
+
+static void clear_out_edges(struct ObjectScript_Class_Graph *graph, uint32_t class_id) {
+  struct Class *entry = &graph->classes[class_id];
+  for (uint32_t i = 0; i < entry->out.count; i++) {
+    remove_in_edge(&graph->classes[entry->out.data[i].class_id], class_id,
+                   entry->out.data[i].kind);
+  }
+  graph->edges -= entry->out.count;
+  entry->out.count = 0;
+}
+
+static bool add_edge(struct ObjectScript_Class_Graph *graph, uint32_t source, uint32_t target,
+                     uint32_t kind) {
+  struct Edge_List *out = &graph->classes[source].out;
+  for (uint32_t i = 0; i < out->count; i++) {
+    if (out->data[i].class_id == target && out->data[i].kind == kind) return true;
+  }
+  if (!edge_list_push(out, (struct ObjectScript_Class_Edge){target, kind})) return false;
+  if (!edge_list_push(&graph->classes[target].in, (struct ObjectScript_Class_Edge){source, kind})) {
+    out->count--;
+    return false;
+  }
+  graph->edges++;
+  return true;
+}
+
+// Names
+
+uint32_t ObjectScript_Class_Graph_resolve_name(const char *name, uint32_t length,
+                                               const char *class_name, uint32_t class_length,
+                                               char *buffer) {
+  // Quoted identifiers ("My Class") are allowed in a few places
+  if (length >= 2 && name[0] == '"' && name[length - 1] == '"') {
+    name++;
+    length -= 2;
+  }
+  if (length > OBJECTSCRIPT_CLASS_GRAPH_MAX_NAME) length = OBJECTSCRIPT_CLASS_GRAPH_MAX_NAME;
+
+  const char *package = NULL;
+  uint32_t package_length = 0;
+  if (length == 0 || memchr(name, '.', length)) {
+    // Already qualified
+  } else if (name[0] == '%') {
+    package = "%Library";
+    package_length = 8;
+    name++;
+    length--;
+  } else {
+    for (uint32_t i = class_length; i > 0; i--) {
+      if (class_name[i - 1] == '.') {
+        package = class_name;
+        package_length = i - 1;
+        break;
+      }
+    }
+  }
+  if (!package || package_length + 1 >= OBJECTSCRIPT_CLASS_GRAPH_MAX_NAME) {
+    memcpy(buffer, name, length);
+    return length;
+  }
+
+  if (package_length + 1 + length > OBJECTSCRIPT_CLASS_GRAPH_MAX_NAME) {
+    length = OBJECTSCRIPT_CLASS_GRAPH_MAX_NAME - package_length - 1;
+  }
+  memcpy(buffer, package, package_length);
+  buffer[package_length] = '.';
+  memcpy(buffer + package_length + 1, name, length);
+  return package_length + 1 + length;
+}
+
+// Extraction
+
+static uint8_t node_role(const struct ObjectScript_Class_Graph *graph, TSNode node) {
+  TSSymbol symbol = ts_node_symbol(node);
+  return symbol < graph->symbol_count ? graph->roles[symbol] : Role_none;
+}
+
+static bool add_pending(struct ObjectScript_Class_Graph *graph, TSNode node, uint32_t kind) {
+  if (graph->pending_count == graph->pending_capacity) {
+    uint32_t capacity = graph->pending_capacity ? graph->pending_capacity * 2 : 64;
+    struct Pending_Edge *pending = (struct Pending_Edge *)realloc(
+        graph->pending, capacity * sizeof(struct Pending_Edge));
+    if (!pending) return false;
+    graph->pending = pending;
+    graph->pending_capacity = capacity;
+  }
+  graph->pending[graph->pending_count++] =
+      (struct Pending_Edge){ts_node_start_byte(node), ts_node_end_byte(node), kind};
+  return true;
+}
+
+// The class of a typename and those of its `Of` typenames, skipping the
+// parameters: `%ListOfObjects(ELEMENTTYPE="A") Of B`
+static bool collect_typename(struct ObjectScript_Class_Graph *graph, TSTreeCursor *cursor,
+                             uint32_t kind) {
+  bool ok = true;
+  if (!ts_tree_cursor_goto_first_child(cursor)) return true;
+  do {
+    TSNode child = ts_tree_cursor_current_node(cursor);
+    uint8_t role = node_role(graph, child);
+    if (role == Role_identifier) {
+      ok = ok && add_pending(graph, child, kind);
+    } else if (role == Role_typename) {
+      ok = ok && collect_typename(graph, cursor, kind);
+    }
+  } while (ts_tree_cursor_goto_next_sibling(cursor));
+  ts_tree_cursor_goto_parent(cursor);
+  return ok;
+}
+
+// Descend through the member's children looking for the type, at most two
+// levels down (projection > projection_type > property_type > typename)
+static bool collect_member(struct ObjectScript_Class_Graph *graph, TSTreeCursor *cursor,
+                           uint8_t member_role) {
+  bool ok = true;
+  bool references = false;
+  if (!ts_tree_cursor_goto_first_child(cursor)) return true;
+  do {
+    TSNode child = ts_tree_cursor_current_node(cursor);
+    switch (node_role(graph, child)) {
+      case Role_typename:
+        ok = ok && collect_typename(graph, cursor,
+                                    member_role == Role_relationship
+                                        ? ObjectScript_Class_Edge_relationship
+                                        : ObjectScript_Class_Edge_type);
+        break;
+      case Role_property_type:
+      case Role_projection_type:
+        ok = ok && collect_member(graph, cursor, member_role);
+        break;
+      case Role_keyword_references:
+        references = true;
+        break;
+      case Role_identifier:
+        // ForeignKey name(props) References Class(index)
+        if (member_role == Role_foreignkey && references) {
+          ok = ok && add_pending(graph, child, ObjectScript_Class_Edge_foreignkey);
+          references = false;
+        }
+        break;
+    }
+  } while (ts_tree_cursor_goto_next_sibling(cursor));
+  ts_tree_cursor_goto_parent(cursor);
+  return ok;
+}
+
+static bool collect_body(struct ObjectScript_Class_Graph *graph, TSTreeCursor *cursor) {
+  bool ok = true;
+  if (!ts_tree_cursor_goto_first_child(cursor)) return true;
+  do {
+    if (node_role(graph, ts_tree_cursor_current_node(cursor)) != Role_class_statement) continue;
+    if (!ts_tree_cursor_goto_first_child(cursor)) continue;
+    // Only the member itself, methods, queries etc. are never entered
+    uint8_t role = node_role(graph, ts_tree_cursor_current_node(cursor));
+    if (role == Role_typed_member || role == Role_relationship || role == Role_foreignkey) {
+      ok = ok && collect_member(graph, cursor, role);
+    }
+    ts_tree_cursor_goto_parent(cursor);
+  } while (ts_tree_cursor_goto_next_sibling(cursor));
+  ts_tree_cursor_goto_parent(cursor);
+  return ok;
+}
+
+static bool add_class(struct ObjectScript_Class_Graph *graph, TSTreeCursor *cursor,
+                      uint32_t file, const char *text, uint32_t length) {
+  TSNode definition = ts_tree_cursor_current_node(cursor);
+  TSNode name = ts_node_child_by_field_id(definition, graph->class_name_field);
+  if (ts_node_is_null(name) || ts_node_end_byte(name) > length) return true;
+  uint32_t name_start = ts_node_start_byte(name);
+  uint32_t name_length = ts_node_end_byte(name) - name_start;
+
+  graph->pending_count = 0;
+  bool ok = true;
+  if (ts_tree_cursor_goto_first_child(cursor)) {
+    do {
+      TSNode child = ts_tree_cursor_current_node(cursor);
+      switch (node_role(graph, child)) {
+        case Role_class_extends:
+          if (ts_tree_cursor_goto_first_child(cursor)) {
+            do {
+              TSNode superclass = ts_tree_cursor_current_node(cursor);
+              if (node_role(graph, superclass) == Role_identifier) {
+                ok = ok && add_pending(graph, superclass, ObjectScript_Class_Edge_extends);
+              }
+            } while (ts_tree_cursor_goto_next_sibling(cursor));
+            ts_tree_cursor_goto_parent(cursor);
+          }
+          break;
+        case Role_class_body:
+          ok = ok && collect_body(graph, cursor);
+          break;
+      }
+    } while (ts_tree_cursor_goto_next_sibling(cursor));
+    ts_tree_cursor_goto_parent(cursor);
+  }
+  if (!ok) return false;
+
+  if (name_length > OBJECTSCRIPT_CLASS_GRAPH_MAX_NAME) {
+    name_length = OBJECTSCRIPT_CLASS_GRAPH_MAX_NAME;
+  }
+  uint32_t class_id = intern_class(graph, text + name_start, name_length);
+  if (class_id == OBJECTSCRIPT_CLASS_NONE) return false;
+  uint32_t class_length;
+  const char *class_name = ObjectScript_String_Table_get(graph->names, class_id, &class_length);
+
+  // Defined twice (moved between files): the last update wins
+  struct Class *entry = &graph->classes[class_id];
+  if (entry->file == OBJECTSCRIPT_CLASS_NONE) graph->defined++;
+  clear_out_edges(graph, class_id);
+  entry->file = file;
+  if (!id_list_push(&graph->files[file], class_id)) return false;
+
+  char buffer[OBJECTSCRIPT_CLASS_GRAPH_MAX_NAME];
+  for (uint32_t i = 0; i < graph->pending_count; i++) {
+    const struct Pending_Edge *edge = &graph->pending[i];
+    if (edge->end > length) continue;
+    uint32_t target_length = ObjectScript_Class_Graph_resolve_name(
+        text + edge->start, edge->end - edge->start, class_name, class_length, buffer);
+    uint32_t target = intern_class(graph, buffer, target_length);
+    if (target == OBJECTSCRIPT_CLASS_NONE || !add_edge(graph, class_id, target, edge->kind)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+static void forget_file(struct ObjectScript_Class_Graph *graph, uint32_t file) {
+  struct Id_List *classes = &graph->files[file];
+  for (uint32_t i = 0; i < classes->count; i++) {
+    uint32_t class_id = classes->data[i];
+    // Unless another file has defined it since
+    if (graph->classes[class_id].file != file) continue;
+    clear_out_edges(graph, class_id);
+    graph->classes[class_id].file = OBJECTSCRIPT_CLASS_NONE;
+    graph->defined--;
+  }
+  classes->count = 0;
+}
+
+bool ObjectScript_Class_Graph_update(struct ObjectScript_Class_Graph *graph, const char *path,
+                                     const TSTree *tree, const char *text, uint32_t length) {
+  uint32_t file = ObjectScript_String_Table_intern(graph->paths, path, (uint32_t)strlen(path));
+  if (file == OBJECTSCRIPT_STRING_NONE ||
+      !reserve((void **)&graph->files, &graph->file_capacity, file, sizeof(struct Id_List))) {
+    return false;
+  }
+  forget_file(graph, file);
+
+  // source_file > class_definition, nothing else is entered
+  TSTreeCursor cursor = ts_tree_cursor_new(ts_tree_root_node(tree));
+  bool ok = true;
+  if (ts_tree_cursor_goto_first_child(&cursor)) {
+    do {
+      if (node_role(graph, ts_tree_cursor_current_node(&cursor)) == Role_class_definition) {
+        ok = ok && add_class(graph, &cursor, file, text, length);
+      }
+    } while (ok && ts_tree_cursor_goto_next_sibling(&cursor));
+  }
+  ts_tree_cursor_delete(&cursor);
+  return ok;
+}
+
+void ObjectScript_Class_Graph_remove_file(struct ObjectScript_Class_Graph *graph,
+                                          const char *path) {
+  uint32_t file = ObjectScript_String_Table_lookup(graph->paths, path, (uint32_t)strlen(path));
+  if (file != OBJECTSCRIPT_STRING_NONE && file < graph->file_capacity) forget_file(graph, file);
+}
+
+// Queries
+
+uint32_t ObjectScript_Class_Graph_lookup(const struct ObjectScript_Class_Graph *graph,
+                                         const char *name, uint32_t length) {
+  return ObjectScript_String_Table_lookup(graph->names, name, length);
+}
+
+const char *ObjectScript_Class_Graph_name(const struct ObjectScript_Class_Graph *graph,
+                                          uint32_t class_id) {
+  return ObjectScript_String_Table_get(graph->names, class_id, NULL);
+}
+
+const char *ObjectScript_Class_Graph_file(const struct ObjectScript_Class_Graph *graph,
+                                          uint32_t class_id) {
+  if (class_id >= ObjectScript_String_Table_count(graph->names)) return NULL;
+  uint32_t file = graph->classes[class_id].file;
+  return file == OBJECTSCRIPT_CLASS_NONE ? NULL
+                                         : ObjectScript_String_Table_get(graph->paths, file, NULL);
+}
+
+const struct ObjectScript_Class_Edge *ObjectScript_Class_Graph_dependencies(
+    const struct ObjectScript_Class_Graph *graph, uint32_t class_id, uint32_t *count) {
+  *count = 0;
+  if (class_id >= ObjectScript_String_Table_count(graph->names)) return NULL;
+  *count = graph->classes[class_id].out.count;
+  return graph->classes[class_id].out.data;
+}
+
+const struct ObjectScript_Class_Edge *ObjectScript_Class_Graph_dependents(
+    const struct ObjectScript_Class_Graph *graph, uint32_t class_id, uint32_t *count) {
+  *count = 0;
+  if (class_id >= ObjectScript_String_Table_count(graph->names)) return NULL;
+  *count = graph->classes[class_id].in.count;
+  return graph->classes[class_id].in.data;
+}
+
+const uint32_t *ObjectScript_Class_Graph_closure(struct ObjectScript_Class_Graph *graph,
+                                                 uint32_t class_id, bool reverse,
+                                                 uint32_t kinds, uint32_t *count) {
+  *count = 0;
+  graph->result.count = 0;
+  if (class_id >= ObjectScript_String_Table_count(graph->names)) return NULL;
+
+  // Marks are compared against a new epoch per query instead of cleared
+  if (++graph->epoch == 0) {
+    for (uint32_t i = 0; i < graph->class_capacity; i++) graph->classes[i].mark = 0;
+    graph->epoch = 1;
+  }
+  graph->classes[class_id].mark = graph->epoch;
+
+  // The result doubles as the breadth first queue
+  uint32_t next = 0;
+  uint32_t current = class_id;
+  for (;;) {
+    const struct Edge_List *edges =
+        reverse ? &graph->classes[current].in : &graph->classes[current].out;
+    for (uint32_t i = 0; i < edges->count; i++) {
+      const struct ObjectScript_Class_Edge *edge = &edges->data[i];
+      struct Class *other = &graph->classes[edge->class_id];
+      if (!(edge->kind & kinds) || other->mark == graph->epoch) continue;
+      other->mark = graph->epoch;
+      if (!id_list_push(&graph->result, edge->class_id)) return NULL;
+    }
+    if (next == graph->result.count) break;
+    current = graph->result.data[next++];
+  }
+  *count = graph->result.count;
+  return graph->result.data;
+}
+
+const uint32_t *ObjectScript_Class_Graph_superclasses(struct ObjectScript_Class_Graph *graph,
+                                                      uint32_t class_id, uint32_t *count) {
+  return ObjectScript_Class_Graph_closure(graph, class_id, false,
+                                          ObjectScript_Class_Edge_extends, count);
+}
+
+const uint32_t *ObjectScript_Class_Graph_subclasses(struct ObjectScript_Class_Graph *graph,
+                                                    uint32_t class_id, uint32_t *count) {
+  return ObjectScript_Class_Graph_closure(graph, class_id, true,
+                                          ObjectScript_Class_Edge_extends, count);
+}
+
+bool ObjectScript_Class_Graph_is_subclass(struct ObjectScript_Class_Graph *graph,
+                                          uint32_t class_id, uint32_t superclass_id) {
+  // Upwards, hierarchies are shallow and narrow
+  uint32_t count;
+  const uint32_t *superclasses = ObjectScript_Class_Graph_superclasses(graph, class_id, &count);
+  for (uint32_t i = 0; i < count; i++) {
+    if (superclasses[i] == superclass_id) return true;
+  }
+  return false;
+}
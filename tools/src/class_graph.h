@@ -0,0 +1,125 @@
+#ifndef OBJECTSCRIPT_CLASS_GRAPH_H_
+#define OBJECTSCRIPT_CLASS_GRAPH_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stddef.h>
+#include <tree_sitter/api.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// In-memory class hierarchy and dependency graph of a code base.
+//
+// Each file's udl tree is read in one targeted pass: the cursor only enters
+// class_definition, class_extends, class_body and the property, parameter,
+// projection, relationship and foreignkey members, and never a method body,
+// so it touches a small fraction of the tree.  Class names are interned and
+// edges are kept in both directions, so lookups and transitive queries
+// (all subclasses of %Persistent, everything that depends on a class) only
+// follow arrays of ids.
+//
+// Names are resolved the way the class compiler does for the common cases:
+// a name without a package is in %Library if it starts with %, and in the
+// package of the referring class otherwise (`Import` is not considered).
+//
+// Calling ObjectScript_Class_Graph_update() again for a file replaces what
+// it defined, so a watcher can keep the graph current by feeding it every
+// changed file.  Classes that are referenced but not defined by any file
+// (system classes, typos) are in the graph too, as leaves without a file.
+//
+// A graph is not thread safe: queries share a scratch buffer.
+struct ObjectScript_Class_Graph;
+
+#define OBJECTSCRIPT_CLASS_NONE UINT32_MAX
+
+// Longest class name kept, longer ones are cut
+#define OBJECTSCRIPT_CLASS_GRAPH_MAX_NAME 512
+
+// Edge kinds, also used as masks
+enum {
+  ObjectScript_Class_Edge_extends      = 1 << 0,   // Class A Extends B
+  ObjectScript_Class_Edge_type         = 1 << 1,   // Property/Parameter/Projection x As B
+  ObjectScript_Class_Edge_relationship = 1 << 2,   // Relationship x As B
+  ObjectScript_Class_Edge_foreignkey   = 1 << 3,   // ForeignKey x(...) References B
+  ObjectScript_Class_Edge_all          = 0xf,
+};
+
+struct ObjectScript_Class_Edge {
+  uint32_t class_id;   // The other end
+  uint32_t kind;
+};
+
+struct ObjectScript_Class_Graph_Stats {
+  uint32_t classes;   // Names in the graph, defined or only referenced
+  uint32_t defined;   // Classes defined by some file
+  uint32_t files;
+  uint64_t edges;
+};
+
+// `language` must be the udl grammar
+struct ObjectScript_Class_Graph *ObjectScript_Class_Graph_new(const TSLanguage *language);
+void ObjectScript_Class_Graph_delete(struct ObjectScript_Class_Graph *graph);
+
+void ObjectScript_Class_Graph_stats(const struct ObjectScript_Class_Graph *graph,
+                                    struct ObjectScript_Class_Graph_Stats *stats);
+
+// Replace the classes defined by `path` with the ones in `tree`, parsed from
+// `text`.  Returns false if out of memory.
+bool ObjectScript_Class_Graph_update(struct ObjectScript_Class_Graph *graph, const char *path,
+                                     const TSTree *tree, const char *text, uint32_t length);
+
+// Forget the classes defined by `path`, e.g. when it was deleted
+void ObjectScript_Class_Graph_remove_file(struct ObjectScript_Class_Graph *graph,
+                                          const char *path);
+
+// Qualify `name`, referred to from the class `class_name`, into `buffer` as
+// described above.  `buffer` must hold OBJECTSCRIPT_CLASS_GRAPH_MAX_NAME
+// bytes; returns the length, not NUL terminated.
+uint32_t ObjectScript_Class_Graph_resolve_name(const char *name, uint32_t length,
+                                               const char *class_name, uint32_t class_length,
+                                               char *buffer);
+
+// The id of a fully qualified class name, or OBJECTSCRIPT_CLASS_NONE
+uint32_t ObjectScript_Class_Graph_lookup(const struct ObjectScript_Class_Graph *graph,
+                                         const char *name, uint32_t length);
+
+const char *ObjectScript_Class_Graph_name(const struct ObjectScript_Class_Graph *graph,
+                                          uint32_t class_id);
+
+// The file defining the class, or NULL if only referenced
+const char *ObjectScript_Class_Graph_file(const struct ObjectScript_Class_Graph *graph,
+                                          uint32_t class_id);
+
+// Direct edges, in the order of the source.  Valid until the next update.
+//
+// Dependencies are the classes `class_id` refers to (its superclasses,
+// property types, ...), dependents the classes that refer to it.
+const struct ObjectScript_Class_Edge *ObjectScript_Class_Graph_dependencies(
+    const struct ObjectScript_Class_Graph *graph, uint32_t class_id, uint32_t *count);
+const struct ObjectScript_Class_Edge *ObjectScript_Class_Graph_dependents(
+    const struct ObjectScript_Class_Graph *graph, uint32_t class_id, uint32_t *count);
+
+// Every class reachable from `class_id` over edges of the `kinds` mask,
+// breadth first and without `class_id` itself: dependencies, or with
+// `reverse` dependents.  The array is valid until the next query or update.
+const uint32_t *ObjectScript_Class_Graph_closure(struct ObjectScript_Class_Graph *graph,
+                                                 uint32_t class_id, bool reverse,
+                                                 uint32_t kinds, uint32_t *count);
+
+// The closure over extends edges, the common cases
+const uint32_t *ObjectScript_Class_Graph_superclasses(struct ObjectScript_Class_Graph *graph,
+                                                      uint32_t class_id, uint32_t *count);
+const uint32_t *ObjectScript_Class_Graph_subclasses(struct ObjectScript_Class_Graph *graph,
+                                                    uint32_t class_id, uint32_t *count);
+
+// Whether `class_id` inherits from `superclass_id`, directly or not
+bool ObjectScript_Class_Graph_is_subclass(struct ObjectScript_Class_Graph *graph,
+                                          uint32_t class_id, uint32_t superclass_id);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // OBJECTSCRIPT_CLASS_GRAPH_H_
@@ -0,0 +1,298 @@
+#define _POSIX_C_SOURCE 200809L
+#include "flat_tree.h"
+#include <fcntl.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#define FLAT_ALIGN(n) (((n) + 3u) & ~3u)
+
+struct Flat_Nodes {
+  struct ObjectScript_Flat_Node *data;
+  uint32_t count;
+  uint32_t capacity;
+};
+
+// The nearest exported ancestor of the cursor's position
+struct Flat_Frame {
+  uint32_t index;
+  uint32_t depth;
+  uint32_t last_child;
+};
+
+static bool flat_push_node(struct Flat_Nodes *nodes, const struct ObjectScript_Flat_Node *node) {
+  if (nodes->count == nodes->capacity) {
+    uint32_t capacity = nodes->capacity ? nodes->capacity * 2 : 1024;
+    struct ObjectScript_Flat_Node *data = (struct ObjectScript_Flat_Node *)realloc(
+        nodes->data, capacity * sizeof(struct ObjectScript_Flat_Node));
+    if (!data) return false;
+    nodes->data = data;
+    nodes->capacity = capacity;
+  }
+  nodes->data[nodes->count++] = *node;
+  return true;
+}
+
+static bool flat_collect(const TSTree *tree, uint32_t options, TSSymbol error_symbol,
+                         struct Flat_Nodes *nodes) {
+  struct Flat_Frame *stack = NULL;
+  uint32_t depth = 0, stack_size = 0, stack_capacity = 0;
+  bool ok = true;
+
+  TSTreeCursor cursor = ts_tree_cursor_new(ts_tree_root_node(tree));
+  for (;;) {
+    TSNode node = ts_tree_cursor_current_node(&cursor);
+    bool named = ts_node_is_named(node);
+
+    while (stack_size && stack[stack_size - 1].depth >= depth) stack_size--;
+
+    if (named || !(options & ObjectScript_Flat_Export_named_only)) {
+      TSPoint start = ts_node_start_point(node);
+      TSSymbol symbol = ts_node_symbol(node);
+      struct ObjectScript_Flat_Node flat = {
+        .symbol = symbol == (TSSymbol)-1 ? error_symbol : symbol,
+        .field_id = ts_tree_cursor_current_field_id(&cursor),
+        .flags = (named ? ObjectScript_Flat_named : 0) |
+                 (ts_node_is_extra(node) ? ObjectScript_Flat_extra : 0) |
+                 (ts_node_is_missing(node) ? ObjectScript_Flat_missing : 0) |
+                 (ts_node_is_error(node) ? ObjectScript_Flat_error : 0),
+        .start_byte = ts_node_start_byte(node),
+        .end_byte = ts_node_end_byte(node),
+        .start_row = start.row,
+        .start_column = start.column,
+        .parent = OBJECTSCRIPT_FLAT_NONE,
+        .next_sibling = OBJECTSCRIPT_FLAT_NONE,
+      };
+      uint32_t index = nodes->count;
+      if (stack_size) {
+        struct Flat_Frame *parent = &stack[stack_size - 1];
+        flat.parent = parent->index;
+        if (parent->last_child != OBJECTSCRIPT_FLAT_NONE) {
+          nodes->data[parent->last_child].next_sibling = index;
+        }
+        parent->last_child = index;
+      }
+      if (!flat_push_node(nodes, &flat)) {
+        ok = false;
+        break;
+      }
+
+      if (stack_size == stack_capacity) {
+        stack_capacity = stack_capacity ? stack_capacity * 2 : 64;
+        struct Flat_Frame *grown =
+            (struct Flat_Frame *)realloc(stack, stack_capacity * sizeof(struct Flat_Frame));
+        if (!grown) {
+          ok = false;
+          break;
+        }
+        stack = grown;
+      }
+      stack[stack_size++] = (struct Flat_Frame){index, depth, OBJECTSCRIPT_FLAT_NONE};
+    }
+
+    if (ts_tree_cursor_goto_first_child(&cursor)) {
+      depth++;
+      continue;
+    }
+    bool done = false;
+    while (!ts_tree_cursor_goto_next_sibling(&cursor)) {
+      if (!ts_tree_cursor_goto_parent(&cursor)) {
+        done = true;
+        break;
+      }
+      depth--;
+    }
+    if (done) break;
+  }
+
+  ts_tree_cursor_delete(&cursor);
+  free(stack);
+  return ok;
+}
+
+void *ObjectScript_Flat_Tree_export(const TSTree *tree, uint32_t source_length,
+                                    uint32_t options, size_t *length) {
+  const TSLanguage *language = ts_tree_language(tree);
+  // ERROR nodes have the out of range ts_builtin_sym_error, they get an
+  // extra symbol at the end of the table instead
+  uint32_t error_symbol = ts_language_symbol_count(language);
+  uint32_t symbol_count = error_symbol + 1;
+  uint32_t field_count = ts_language_field_count(language) + 1;
+
+  struct Flat_Nodes nodes = {0};
+  if (!flat_collect(tree, options, (TSSymbol)error_symbol, &nodes)) {
+    free(nodes.data);
+    return NULL;
+  }
+
+  size_t strings_length = 0;
+  for (uint32_t i = 0; i < error_symbol; i++) {
+    strings_length += strlen(ts_language_symbol_name(language, (TSSymbol)i)) + 1;
+  }
+  strings_length += sizeof("ERROR");
+  for (uint32_t i = 1; i < field_count; i++) {
+    strings_length += strlen(ts_language_field_name_for_id(language, (TSFieldId)i)) + 1;
+  }
+  strings_length += 1;   // Field 0, ""
+
+  size_t nodes_offset = sizeof(struct ObjectScript_Flat_Header) +
+                        4 * (size_t)(symbol_count + field_count) +
+                        FLAT_ALIGN((size_t)symbol_count);
+  size_t strings_offset =
+      nodes_offset + (size_t)nodes.count * sizeof(struct ObjectScript_Flat_Node);
+  size_t total = strings_offset + FLAT_ALIGN(strings_length);
+  if (total > UINT32_MAX) {
+    free(nodes.data);
+    return NULL;
+  }
+
+  uint8_t *out = (uint8_t *)calloc(1, total);
+  if (!out) {
+    free(nodes.data);
+    return NULL;
+  }
+  struct ObjectScript_Flat_Header *header = (struct ObjectScript_Flat_Header *)out;
+  memcpy(header->magic, OBJECTSCRIPT_FLAT_MAGIC, 4);
+  header->version = OBJECTSCRIPT_FLAT_VERSION;
+  header->node_count = nodes.count;
+  header->symbol_count = symbol_count;
+  header->field_count = field_count;
+  header->nodes_offset = (uint32_t)nodes_offset;
+  header->strings_offset = (uint32_t)strings_offset;
+  header->strings_length = (uint32_t)strings_length;
+  header->source_length = source_length;
+
+  uint32_t *symbols = (uint32_t *)(header + 1);
+  uint32_t *fields = symbols + symbol_count;
+  uint8_t *named = (uint8_t *)(fields + field_count);
+  char *strings = (char *)out + strings_offset;
+  uint32_t offset = 1;   // strings[0] is the empty name of field 0
+  fields[0] = 0;
+  for (uint32_t i = 0; i < symbol_count; i++) {
+    const char *name = i < error_symbol ? ts_language_symbol_name(language, (TSSymbol)i) : "ERROR";
+    size_t size = strlen(name) + 1;
+    memcpy(strings + offset, name, size);
+    symbols[i] = offset;
+    offset += (uint32_t)size;
+    named[i] = i == error_symbol ||
+               ts_language_symbol_type(language, (TSSymbol)i) == TSSymbolTypeRegular;
+  }
+  for (uint32_t i = 1; i < field_count; i++) {
+    const char *name = ts_language_field_name_for_id(language, (TSFieldId)i);
+    size_t size = strlen(name) + 1;
+    memcpy(strings + offset, name, size);
+    fields[i] = offset;
+    offset += (uint32_t)size;
+  }
+  memcpy(out + nodes_offset, nodes.data, nodes.count * sizeof(struct ObjectScript_Flat_Node));
+  free(nodes.data);
+
+  *length = total;
+  return out;
+}
+
+bool ObjectScript_Flat_Tree_write(const TSTree *tree, uint32_t source_length,
+                                  uint32_t options, FILE *file) {
+  size_t length;
+  void *data = ObjectScript_Flat_Tree_export(tree, source_length, options, &length);
+  if (!data) return false;
+  bool ok = fwrite(data, 1, length, file) == length;
+  free(data);
+  return ok;
+}
+
+bool ObjectScript_Flat_Tree_open(struct ObjectScript_Flat_Tree *view,
+                                 const void *data, size_t length) {
+  memset(view, 0, sizeof(*view));
+  const struct ObjectScript_Flat_Header *header = (const struct ObjectScript_Flat_Header *)data;
+  if (((uintptr_t)data & 3) || length < sizeof(*header) ||
+      memcmp(header->magic, OBJECTSCRIPT_FLAT_MAGIC, 4) != 0 ||
+      header->version != OBJECTSCRIPT_FLAT_VERSION || header->field_count == 0) {
+    return false;
+  }
+
+  // 64 bit arithmetic, so that hostile counts can't wrap around
+  uint64_t tables_end = sizeof(*header) +
+                        4 * ((uint64_t)header->symbol_count + header->field_count) +
+                        FLAT_ALIGN((uint64_t)header->symbol_count);
+  uint64_t nodes_end = (uint64_t)header->nodes_offset +
+                       (uint64_t)header->node_count * sizeof(struct ObjectScript_Flat_Node);
+  uint64_t strings_end = (uint64_t)header->strings_offset + header->strings_length;
+  if (header->nodes_offset < tables_end || (header->nodes_offset & 3) ||
+      header->strings_offset < nodes_end || strings_end > length ||
+      header->strings_length == 0) {
+    return false;
+  }
+
+  const uint8_t *bytes = (const uint8_t *)data;
+  const uint32_t *symbols = (const uint32_t *)(header + 1);
+  const uint32_t *fields = symbols + header->symbol_count;
+  const char *strings = (const char *)bytes + header->strings_offset;
+  if (strings[header->strings_length - 1] != '\0') return false;
+  for (uint32_t i = 0; i < header->symbol_count; i++) {
+    if (symbols[i] >= header->strings_length) return false;
+  }
+  for (uint32_t i = 0; i < header->field_count; i++) {
+    if (fields[i] >= header->strings_length) return false;
+  }
+
+  const struct ObjectScript_Flat_Node *nodes =
+      (const struct ObjectScript_Flat_Node *)(bytes + header->nodes_offset);
+  for (uint32_t i = 0; i < header->node_count; i++) {
+    const struct ObjectScript_Flat_Node *node = &nodes[i];
+    // Parents come before their children, siblings after each other
+    if (node->symbol >= header->symbol_count || node->field_id >= header->field_count ||
+        (node->parent != OBJECTSCRIPT_FLAT_NONE && node->parent >= i) ||
+        (node->next_sibling != OBJECTSCRIPT_FLAT_NONE &&
+         (node->next_sibling <= i || node->next_sibling >= header->node_count))) {
+      return false;
+    }
+  }
+
+  view->header = header;
+  view->symbols = symbols;
+  view->fields = fields;
+  view->named = (const uint8_t *)(fields + header->field_count);
+  view->nodes = nodes;
+  view->strings = strings;
+  view->node_count = header->node_count;
+  return true;
+}
+
+bool ObjectScript_Flat_Tree_map(struct ObjectScript_Flat_Tree *view, const char *path) {
+  memset(view, 0, sizeof(*view));
+  int fd = open(path, O_RDONLY);
+  if (fd < 0) return false;
+  struct stat info;
+  void *mapping = MAP_FAILED;
+  if (fstat(fd, &info) == 0 && info.st_size > 0) {
+    mapping = mmap(NULL, (size_t)info.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+  }
+  close(fd);
+  if (mapping == MAP_FAILED) return false;
+
+  if (!ObjectScript_Flat_Tree_open(view, mapping, (size_t)info.st_size)) {
+    munmap(mapping, (size_t)info.st_size);
+    return false;
+  }
+  view->mapping = mapping;
+  view->mapping_length = (size_t)info.st_size;
+  return true;
+}
+
+void ObjectScript_Flat_Tree_unmap(struct ObjectScript_Flat_Tree *view) {
+  if (view->mapping) munmap(view->mapping, view->mapping_length);
+  memset(view, 0, sizeof(*view));
+}
+
+uint16_t ObjectScript_Flat_Tree_symbol_for_name(const struct ObjectScript_Flat_Tree *view,
+                                                const char *name, bool named) {
+  for (uint32_t i = 0; i < view->header->symbol_count; i++) {
+    if (view->named[i] == named && !strcmp(view->strings + view->symbols[i], name)) {
+      return (uint16_t)i;
+    }
+  }
+  return UINT16_MAX;
+}
@@ -0,0 +1,144 @@
+#ifndef OBJECTSCRIPT_FLAT_TREE_H_
+#define OBJECTSCRIPT_FLAT_TREE_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <tree_sitter/api.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Flat, offset based binary export of a parse tree.
+//
+// Meant for handing parse results to other processes (and languages): the
+// file can be mmapped and walked in place, with no deserialization step.
+// Everything is little endian and 4 byte aligned:
+//
+//   header     struct ObjectScript_Flat_Header
+//   symbols    u32[symbol_count]   offsets of the node type names
+//   fields     u32[field_count]    offsets of the field names, [0] unused
+//   named      u8[symbol_count]    1 for named node types, padded to 4
+//   nodes      struct ObjectScript_Flat_Node[node_count], pre-order
+//   strings    NUL terminated names, the offsets above are relative to this
+//
+// Kind and field ids are the grammar's (ts_node_symbol() and the field ids
+// behind node-types.json), except that ERROR nodes get the last symbol.  The
+// name tables travel with the file, so a reader doesn't need the grammar.
+// Nodes link to their parent and next sibling by index; the first child of
+// node i, if any, is node i + 1.
+#define OBJECTSCRIPT_FLAT_MAGIC "OSFT"
+#define OBJECTSCRIPT_FLAT_VERSION 1
+#define OBJECTSCRIPT_FLAT_NONE UINT32_MAX
+
+struct ObjectScript_Flat_Header {
+  char     magic[4];
+  uint32_t version;
+  uint32_t node_count;
+  uint32_t symbol_count;
+  uint32_t field_count;
+  uint32_t nodes_offset;     // From the start of the file
+  uint32_t strings_offset;
+  uint32_t strings_length;
+  uint32_t source_length;    // Bytes of the source the tree was parsed from
+  uint32_t reserved;
+};
+
+enum {
+  ObjectScript_Flat_named   = 1 << 0,
+  ObjectScript_Flat_extra   = 1 << 1,
+  ObjectScript_Flat_missing = 1 << 2,
+  ObjectScript_Flat_error   = 1 << 3,
+};
+
+struct ObjectScript_Flat_Node {
+  uint16_t symbol;
+  uint16_t field_id;       // Field in the parent, 0 if none
+  uint8_t  flags;
+  uint8_t  reserved[3];
+  uint32_t start_byte;
+  uint32_t end_byte;
+  uint32_t start_row;
+  uint32_t start_column;   // In bytes
+  uint32_t parent;         // Node indices, or OBJECTSCRIPT_FLAT_NONE
+  uint32_t next_sibling;
+};
+
+// Export options
+enum {
+  // Leave out anonymous nodes (punctuation, keywords), which are usually
+  // half of the tree and rarely needed by an analysis
+  ObjectScript_Flat_Export_named_only = 1 << 0,
+};
+
+// Serialize `tree` into a malloc'ed buffer of `*length` bytes, or NULL
+void *ObjectScript_Flat_Tree_export(const TSTree *tree, uint32_t source_length,
+                                    uint32_t options, size_t *length);
+
+// Same, written to `file`
+bool ObjectScript_Flat_Tree_write(const TSTree *tree, uint32_t source_length,
+                                  uint32_t options, FILE *file);
+
+// Zero-copy reader.  The view points into the caller's buffer, which must
+// outlive it and be 4 byte aligned (malloc and mmap both are).
+struct ObjectScript_Flat_Tree {
+  const struct ObjectScript_Flat_Header *header;
+  const uint32_t *symbols;
+  const uint32_t *fields;
+  const uint8_t *named;
+  const struct ObjectScript_Flat_Node *nodes;
+  const char *strings;
+  uint32_t node_count;
+
+  // Set by ObjectScript_Flat_Tree_map()
+  void *mapping;
+  size_t mapping_length;
+};
+
+// Check the header and that every offset is in bounds.  After this the
+// accessors below need no further checks.
+bool ObjectScript_Flat_Tree_open(struct ObjectScript_Flat_Tree *view,
+                                 const void *data, size_t length);
+
+// mmap `path` read only and open it
+bool ObjectScript_Flat_Tree_map(struct ObjectScript_Flat_Tree *view, const char *path);
+void ObjectScript_Flat_Tree_unmap(struct ObjectScript_Flat_Tree *view);
+
+static inline const struct ObjectScript_Flat_Node *ObjectScript_Flat_Tree_node(
+    const struct ObjectScript_Flat_Tree *view, uint32_t index) {
+  return index < view->node_count ? &view->nodes[index] : NULL;
+}
+
+static inline uint32_t ObjectScript_Flat_Tree_first_child(
+    const struct ObjectScript_Flat_Tree *view, uint32_t index) {
+  return index + 1 < view->node_count && view->nodes[index + 1].parent == index
+             ? index + 1
+             : OBJECTSCRIPT_FLAT_NONE;
+}
+
+static inline const char *ObjectScript_Flat_Tree_type(
+    const struct ObjectScript_Flat_Tree *view, const struct ObjectScript_Flat_Node *node) {
+  return node->symbol < view->header->symbol_count
+             ? view->strings + view->symbols[node->symbol]
+             : NULL;
+}
+
+static inline const char *ObjectScript_Flat_Tree_field_name(
+    const struct ObjectScript_Flat_Tree *view, const struct ObjectScript_Flat_Node *node) {
+  return node->field_id && node->field_id < view->header->field_count
+             ? view->strings + view->fields[node->field_id]
+             : NULL;
+}
+
+// The symbol with the given type name, to compare against node->symbol
+// instead of comparing strings in a loop.  Returns UINT16_MAX if unknown.
+uint16_t ObjectScript_Flat_Tree_symbol_for_name(const struct ObjectScript_Flat_Tree *view,
+                                                const char *name, bool named);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // OBJECTSCRIPT_FLAT_TREE_H_
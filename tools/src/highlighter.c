@@ -0,0 +1,278 @@
+#include "highlighter.h"
+#include <stdlib.h>
+#include <string.h>
+
+struct ObjectScript_Highlight_Query {
+  TSQuery            *query;
+  const TSLanguage   *language;
+  uint16_t           *capture_highlights;   // By capture id, or OBJECTSCRIPT_HIGHLIGHT_NONE
+  const char *const  *names;
+  uint16_t            name_count;
+  char               *owned_names;          // Without `names`, the capture names
+  const char        **owned_name_list;
+};
+
+// A capture that is still open while the ones inside it are read
+struct Highlight_Scope {
+  TSNode   node;
+  uint32_t start_byte;   // Clipped to the range
+  uint32_t end_byte;
+  uint16_t highlight;
+};
+
+struct ObjectScript_Highlighter {
+  const struct ObjectScript_Highlight_Query *query;
+  TSParser      *parser;
+  TSQueryCursor *cursor;
+  struct ObjectScript_Highlight_Span *spans;
+  uint32_t span_count;
+  uint32_t span_capacity;
+  struct Highlight_Scope *scopes;
+  uint32_t scope_count;
+  uint32_t scope_capacity;
+  uint32_t position;   // Everything before it has been emitted
+  bool     failed;
+};
+
+// `name` is `prefix` or starts with `prefix.`
+static bool is_dotted_prefix(const char *prefix, const char *name, uint32_t length) {
+  size_t prefix_length = strlen(prefix);
+  return prefix_length <= length && !memcmp(prefix, name, prefix_length) &&
+         (prefix_length == length || name[prefix_length] == '.');
+}
+
+static bool map_captures(struct ObjectScript_Highlight_Query *query) {
+  uint32_t count = ts_query_capture_count(query->query);
+  query->capture_highlights = (uint16_t *)malloc((count ? count : 1) * sizeof(uint16_t));
+  if (!query->capture_highlights) return false;
+
+  if (!query->names) {
+    // Every capture is a highlight, under a NUL terminated copy of its name
+    if (count >= OBJECTSCRIPT_HIGHLIGHT_NONE) return false;
+    size_t size = 0;
+    for (uint32_t id = 0; id < count; id++) {
+      uint32_t length;
+      ts_query_capture_name_for_id(query->query, id, &length);
+      size += length + 1;
+    }
+    query->owned_names = (char *)malloc(size ? size : 1);
+    query->owned_name_list = (const char **)malloc((count ? count : 1) * sizeof(char *));
+    if (!query->owned_names || !query->owned_name_list) return false;
+    char *next = query->owned_names;
+    for (uint32_t id = 0; id < count; id++) {
+      uint32_t length;
+      const char *name = ts_query_capture_name_for_id(query->query, id, &length);
+      memcpy(next, name, length);
+      next[length] = 0;
+      query->owned_name_list[id] = next;
+      query->capture_highlights[id] = name[0] == '_' ? OBJECTSCRIPT_HIGHLIGHT_NONE
+                                                     : (uint16_t)id;
+      next += length + 1;
+    }
+    query->names = query->owned_name_list;
+    query->name_count = (uint16_t)count;
+    return true;
+  }
+
+  for (uint32_t id = 0; id < count; id++) {
+    uint32_t length;
+    const char *name = ts_query_capture_name_for_id(query->query, id, &length);
+    uint16_t best = OBJECTSCRIPT_HIGHLIGHT_NONE;
+    size_t best_length = 0;
+    for (uint16_t i = 0; i < query->name_count; i++) {
+      size_t name_length = strlen(query->names[i]);
+      if (name_length > best_length && is_dotted_prefix(query->names[i], name, length)) {
+        best = i;
+        best_length = name_length;
+      }
+    }
+    query->capture_highlights[id] = best;
+  }
+  return true;
+}
+
+struct ObjectScript_Highlight_Query *ObjectScript_Highlight_Query_new(
+    const TSLanguage *language, const char *source, uint32_t length,
+    const char *const *names, uint16_t name_count, uint32_t *error_offset,
+    TSQueryError *error_type) {
+  struct ObjectScript_Highlight_Query *query = (struct ObjectScript_Highlight_Query *)calloc(
+      1, sizeof(struct ObjectScript_Highlight_Query));
+  *error_offset = 0;
+  *error_type = TSQueryErrorNone;
+  if (!query) return NULL;
+  query->language = language;
+  query->names = names;
+  query->name_count = names ? name_count : 0;
+  query->query = ts_query_new(language, source, length, error_offset, error_type);
+  if (!query->query || !map_captures(query)) {
+    ObjectScript_Highlight_Query_delete(query);
+    return NULL;
+  }
+  return query;
+}
+
+void ObjectScript_Highlight_Query_delete(struct ObjectScript_Highlight_Query *query) {
+  if (!query) return;
+  if (query->query) ts_query_delete(query->query);
+  free(query->capture_highlights);
+  free(query->owned_names);
+  free(query->owned_name_list);
+  free(query);
+}
+
+uint16_t ObjectScript_Highlight_Query_name_count(
+    const struct ObjectScript_Highlight_Query *query) {
+  return query->name_count;
+}
+
+const char *ObjectScript_Highlight_Query_name(const struct ObjectScript_Highlight_Query *query,
+                                              uint16_t highlight) {
+  return highlight < query->name_count ? query->names[highlight] : NULL;
+}
+
+struct ObjectScript_Highlighter *ObjectScript_Highlighter_new(
+    const struct ObjectScript_Highlight_Query *query) {
+  struct ObjectScript_Highlighter *highlighter = (struct ObjectScript_Highlighter *)calloc(
+      1, sizeof(struct ObjectScript_Highlighter));
+  if (!highlighter) return NULL;
+  highlighter->query = query;
+  highlighter->parser = ts_parser_new();
+  highlighter->cursor = ts_query_cursor_new();
+  highlighter->span_capacity = 256;
+  highlighter->spans = (struct ObjectScript_Highlight_Span *)malloc(
+      highlighter->span_capacity * sizeof(struct ObjectScript_Highlight_Span));
+  if (!highlighter->spans || !ts_parser_set_language(highlighter->parser, query->language)) {
+    ObjectScript_Highlighter_delete(highlighter);
+    return NULL;
+  }
+  return highlighter;
+}
+
+void ObjectScript_Highlighter_delete(struct ObjectScript_Highlighter *highlighter) {
+  if (!highlighter) return;
+  ts_parser_delete(highlighter->parser);
+  ts_query_cursor_delete(highlighter->cursor);
+  free(highlighter->spans);
+  free(highlighter->scopes);
+  free(highlighter);
+}
+
+// Append [start, end) unless empty, extending the last span if it is the
+// same highlight and ends where this one starts
+static void emit(struct ObjectScript_Highlighter *highlighter, uint32_t start, uint32_t end,
+                 uint16_t highlight) {
+  if (end <= start) return;
+  if (highlighter->span_count) {
+    struct ObjectScript_Highlight_Span *last =
+        &highlighter->spans[highlighter->span_count - 1];
+    if (last->end_byte == start && last->highlight == highlight) {
+      last->end_byte = end;
+      return;
+    }
+  }
+  if (highlighter->span_count == highlighter->span_capacity) {
+    uint32_t capacity = highlighter->span_capacity * 2;
+    struct ObjectScript_Highlight_Span *spans = (struct ObjectScript_Highlight_Span *)realloc(
+        highlighter->spans, capacity * sizeof(struct ObjectScript_Highlight_Span));
+    if (!spans) {
+      highlighter->failed = true;
+      return;
+    }
+    highlighter->spans = spans;
+    highlighter->span_capacity = capacity;
+  }
+  highlighter->spans[highlighter->span_count++] =
+      (struct ObjectScript_Highlight_Span){start, end, highlight, 0};
+}
+
+// Close the innermost scope, emitting what is left of it
+static void pop_scope(struct ObjectScript_Highlighter *highlighter) {
+  struct Highlight_Scope *scope = &highlighter->scopes[--highlighter->scope_count];
+  emit(highlighter, highlighter->position, scope->end_byte, scope->highlight);
+  if (scope->end_byte > highlighter->position) highlighter->position = scope->end_byte;
+}
+
+static void add_capture(struct ObjectScript_Highlighter *highlighter, TSNode node,
+                        uint32_t start, uint32_t end, uint16_t highlight) {
+  while (highlighter->scope_count &&
+         highlighter->scopes[highlighter->scope_count - 1].end_byte <= start) {
+    pop_scope(highlighter);
+  }
+
+  // Captures are read in order of start byte, but at the same start an
+  // ancestor may come after its descendants: it goes under them
+  uint32_t index = highlighter->scope_count;
+  for (uint32_t i = highlighter->scope_count; i > 0; i--) {
+    struct Highlight_Scope *scope = &highlighter->scopes[i - 1];
+    if (scope->start_byte != start) break;
+    if (ts_node_eq(scope->node, node)) return;   // An earlier pattern has it
+    if (scope->end_byte < end) index = i - 1;
+  }
+  if (index > 0 && end > highlighter->scopes[index - 1].end_byte) {
+    end = highlighter->scopes[index - 1].end_byte;
+  }
+  if (index == highlighter->scope_count && index > 0) {
+    emit(highlighter, highlighter->position, start,
+         highlighter->scopes[index - 1].highlight);
+  }
+  if (start > highlighter->position) highlighter->position = start;
+
+  if (highlighter->scope_count == highlighter->scope_capacity) {
+    uint32_t capacity = highlighter->scope_capacity ? highlighter->scope_capacity * 2 : 32;
+    struct Highlight_Scope *scopes = (struct Highlight_Scope *)realloc(
+        highlighter->scopes, capacity * sizeof(struct Highlight_Scope));
+    if (!scopes) {
+      highlighter->failed = true;
+      return;
+    }
+    highlighter->scopes = scopes;
+    highlighter->scope_capacity = capacity;
+  }
+  memmove(&highlighter->scopes[index + 1], &highlighter->scopes[index],
+          (highlighter->scope_count - index) * sizeof(struct Highlight_Scope));
+  highlighter->scopes[index] = (struct Highlight_Scope){node, start, end, highlight};
+  highlighter->scope_count++;
+}
+
+const struct ObjectScript_Highlight_Span *ObjectScript_Highlighter_highlight_tree(
+    struct ObjectScript_Highlighter *highlighter, TSNode root, uint32_t start_byte,
+    uint32_t end_byte, uint32_t *count) {
+  const struct ObjectScript_Highlight_Query *query = highlighter->query;
+  highlighter->span_count = 0;
+  highlighter->scope_count = 0;
+  highlighter->position = start_byte;
+  highlighter->failed = false;
+
+  ts_query_cursor_set_byte_range(highlighter->cursor, start_byte, end_byte);
+  ts_query_cursor_exec(highlighter->cursor, query->query, root);
+  TSQueryMatch match;
+  uint32_t capture_index;
+  while (!highlighter->failed &&
+         ts_query_cursor_next_capture(highlighter->cursor, &match, &capture_index)) {
+    TSQueryCapture capture = match.captures[capture_index];
+    uint16_t highlight = query->capture_highlights[capture.index];
+    if (highlight == OBJECTSCRIPT_HIGHLIGHT_NONE) continue;
+    uint32_t start = ts_node_start_byte(capture.node);
+    uint32_t end = ts_node_end_byte(capture.node);
+    if (start < start_byte) start = start_byte;
+    if (end > end_byte) end = end_byte;
+    if (start >= end) continue;
+    add_capture(highlighter, capture.node, start, end, highlight);
+  }
+  while (highlighter->scope_count) pop_scope(highlighter);
+
+  *count = highlighter->failed ? 0 : highlighter->span_count;
+  return highlighter->failed ? NULL : highlighter->spans;
+}
+
+const struct ObjectScript_Highlight_Span *ObjectScript_Highlighter_highlight(
+    struct ObjectScript_Highlighter *highlighter, const char *source, uint32_t length,
+    uint32_t start_byte, uint32_t end_byte, uint32_t *count) {
+  *count = 0;
+  TSTree *tree = ts_parser_parse_string(highlighter->parser, NULL, source, length);
+  if (!tree) return NULL;
+  const struct ObjectScript_Highlight_Span *spans = ObjectScript_Highlighter_highlight_tree(
+      highlighter, ts_tree_root_node(tree), start_byte, end_byte, count);
+  ts_tree_delete(tree);
+  return spans;
+}
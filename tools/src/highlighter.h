@@ -0,0 +1,86 @@
+#ifndef OBJECTSCRIPT_HIGHLIGHTER_H_
+#define OBJECTSCRIPT_HIGHLIGHTER_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <tree_sitter/api.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Syntax highlighting without a generic highlighter in the way, for servers
+// that highlight many documents (e.g. every class of a code review diff).
+//
+// A highlight query is the layered highlights.scm of a grammar (the merged
+// bundle, or the expr, core and udl files concatenated as tree-sitter.json
+// does), compiled once and shared by every thread: a TSQuery is read only
+// once built.  Each thread keeps its own highlighter, which holds a parser,
+// a query cursor and the span buffer, and reuses all three from one
+// document to the next.
+//
+// The result is a flat array of spans sorted by start byte that don't
+// overlap: where captures nest, the innermost one wins, and where two
+// patterns capture the same node, the first one in the query wins (as with
+// `tree-sitter highlight`).  Text no capture covers has no span, adjacent
+// spans of the same highlight are merged.  Predicates (`#eq?`, `#match?`)
+// aren't evaluated; the highlights of these grammars don't use any.
+struct ObjectScript_Highlight_Query;
+struct ObjectScript_Highlighter;
+
+#define OBJECTSCRIPT_HIGHLIGHT_NONE UINT16_MAX
+
+struct ObjectScript_Highlight_Span {
+  uint32_t start_byte;
+  uint32_t end_byte;
+  uint16_t highlight;   // Index into the query's highlight names
+  uint16_t reserved;
+};
+
+// Compile `source` for `language`.  `names` are the highlights the host
+// renders, e.g. {"keyword", "function", "function.builtin"}: a capture gets
+// the longest name that is the capture's name or a dotted prefix of it
+// (@function.method is "function" above) and captures matching no name are
+// dropped.  With no names, every capture name is a highlight of its own.
+// The names aren't copied and must outlive the query.
+//
+// Returns NULL and sets `error_offset` / `error_type` if the query doesn't
+// compile, or on running out of memory (TSQueryErrorNone).
+struct ObjectScript_Highlight_Query *ObjectScript_Highlight_Query_new(
+    const TSLanguage *language, const char *source, uint32_t length,
+    const char *const *names, uint16_t name_count, uint32_t *error_offset,
+    TSQueryError *error_type);
+void ObjectScript_Highlight_Query_delete(struct ObjectScript_Highlight_Query *query);
+
+uint16_t ObjectScript_Highlight_Query_name_count(
+    const struct ObjectScript_Highlight_Query *query);
+
+// The name of a span's highlight, NUL terminated
+const char *ObjectScript_Highlight_Query_name(const struct ObjectScript_Highlight_Query *query,
+                                              uint16_t highlight);
+
+// One per thread
+struct ObjectScript_Highlighter *ObjectScript_Highlighter_new(
+    const struct ObjectScript_Highlight_Query *query);
+void ObjectScript_Highlighter_delete(struct ObjectScript_Highlighter *highlighter);
+
+// Parse `source` and highlight [start_byte, end_byte) of it (0 and
+// UINT32_MAX for all of it).  The spans are clipped to the range and owned
+// by the highlighter, valid until its next call.  NULL on running out of
+// memory or if the parse fails.
+const struct ObjectScript_Highlight_Span *ObjectScript_Highlighter_highlight(
+    struct ObjectScript_Highlighter *highlighter, const char *source, uint32_t length,
+    uint32_t start_byte, uint32_t end_byte, uint32_t *count);
+
+// The same over a tree the host already has, which must be of the query's
+// language.  This is the one to call again for another range of the same
+// document: only the range is queried, not the whole tree.
+const struct ObjectScript_Highlight_Span *ObjectScript_Highlighter_highlight_tree(
+    struct ObjectScript_Highlighter *highlighter, TSNode root, uint32_t start_byte,
+    uint32_t end_byte, uint32_t *count);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // OBJECTSCRIPT_HIGHLIGHTER_H_
@@ -0,0 +1,394 @@
+#include "injection_cache.h"
+#include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define INJECTION_CACHE_INITIAL_CAPACITY 64
+
+struct ObjectScript_Injection_Entry {
+  uint64_t          hash;
+  const TSLanguage *language;
+  char             *text;
+  uint32_t          length;
+  TSTree           *tree;
+};
+
+struct ObjectScript_Injection_Cache {
+  struct ObjectScript_Injection_Entry *entries;   // Open addressing, NULL tree == empty
+  uint32_t capacity;                              // Always a power of two
+  uint32_t count;
+  uint64_t hits;
+  uint64_t misses;
+  size_t   bytes;
+};
+
+// FNV-1a, seeded with the language so the same text injected as two
+// different languages lands in two different slots
+static uint64_t hash_region(const TSLanguage *language, const char *text,
+                            uint32_t length) {
+  uint64_t hash = 0xcbf29ce484222325ULL ^ (uint64_t)(uintptr_t)language;
+  for (uint32_t i = 0; i < length; i++) {
+    hash ^= (unsigned char)text[i];
+    hash *= 0x100000001b3ULL;
+  }
+  return hash;
+}
+
+struct ObjectScript_Injection_Cache *ObjectScript_Injection_Cache_new(void) {
+  struct ObjectScript_Injection_Cache *cache =
+      (struct ObjectScript_Injection_Cache *)calloc(
+          1, sizeof(struct ObjectScript_Injection_Cache));
+  if (!cache) return NULL;
+
+  cache->capacity = INJECTION_CACHE_INITIAL_CAPACITY;
+  cache->entries = (struct ObjectScript_Injection_Entry *)calloc(
+      cache->capacity, sizeof(struct ObjectScript_Injection_Entry));
+  if (!cache->entries) {
+    free(cache);
+    return NULL;
+  }
+  return cache;
+}
+
+void ObjectScript_Injection_Cache_clear(struct ObjectScript_Injection_Cache *cache) {
+  for (uint32_t i = 0; i < cache->capacity; i++) {
+    struct ObjectScript_Injection_Entry *entry = &cache->entries[i];
+    if (entry->tree) {
+      ts_tree_delete(entry->tree);
+      free(entry->text);
+    }
+  }
+  memset(cache->entries, 0,
+         cache->capacity * sizeof(struct ObjectScript_Injection_Entry));
+  cache->count = 0;
+  cache->bytes = 0;
+}
+
+void ObjectScript_Injection_Cache_delete(struct ObjectScript_Injection_Cache *cache) {
+  if (!cache) return;
+  ObjectScript_Injection_Cache_clear(cache);
+  free(cache->entries);
+  free(cache);
+}
+
+void ObjectScript_Injection_Cache_stats(
+    const struct ObjectScript_Injection_Cache *cache,
+    struct ObjectScript_Injection_Cache_Stats *stats) {
+  stats->entries = cache->count;
+  stats->hits    = cache->hits;
+  stats->misses  = cache->misses;
+  stats->bytes   = cache->bytes;
+}
+
+static bool grow(struct ObjectScript_Injection_Cache *cache) {
+  uint32_t capacity = cache->capacity * 2;
+  struct ObjectScript_Injection_Entry *entries =
+      (struct ObjectScript_Injection_Entry *)calloc(
+          capacity, sizeof(struct ObjectScript_Injection_Entry));
+  if (!entries) return false;
+
+  for (uint32_t i = 0; i < cache->capacity; i++) {
+    struct ObjectScript_Injection_Entry *entry = &cache->entries[i];
+    if (!entry->tree) continue;
+    uint32_t slot = (uint32_t)entry->hash & (capacity - 1);
+    while (entries[slot].tree) {
+      slot = (slot + 1) & (capacity - 1);
+    }
+    entries[slot] = *entry;
+  }
+
+  free(cache->entries);
+  cache->entries = entries;
+  cache->capacity = capacity;
+  return true;
+}
+
+const TSTree *ObjectScript_Injection_Cache_parse(
+    struct ObjectScript_Injection_Cache *cache, TSParser *parser,
+    const TSLanguage *language, const char *text, uint32_t length) {
+  uint64_t hash = hash_region(language, text, length);
+  uint32_t slot = (uint32_t)hash & (cache->capacity - 1);
+
+  // Probe until we find the region or an empty slot
+  while (cache->entries[slot].tree) {
+    struct ObjectScript_Injection_Entry *entry = &cache->entries[slot];
+    if (entry->hash == hash && entry->language == language &&
+        entry->length == length && memcmp(entry->text, text, length) == 0) {
+      cache->hits++;
+      return entry->tree;
+    }
+    slot = (slot + 1) & (cache->capacity - 1);
+  }
+
+  // Keep the load factor under 3/4, re-probing if the table moved.  A
+  // table that can't grow takes no more entries, so the probes above
+  // always end at an empty slot.
+  if ((cache->count + 1) * 4 > cache->capacity * 3) {
+    if (!grow(cache)) return NULL;
+    slot = (uint32_t)hash & (cache->capacity - 1);
+    while (cache->entries[slot].tree) {
+      slot = (slot + 1) & (cache->capacity - 1);
+    }
+  }
+
+  if (!ts_parser_set_language(parser, language)) {
+    return NULL;
+  }
+  TSTree *tree = ts_parser_parse_string(parser, NULL, text, length);
+  if (!tree) {
+    return NULL;
+  }
+  cache->misses++;
+
+  char *copy = (char *)malloc(length ? length : 1);
+  if (!copy) {
+    ts_tree_delete(tree);
+    return NULL;
+  }
+  memcpy(copy, text, length);
+
+  struct ObjectScript_Injection_Entry *entry = &cache->entries[slot];
+  entry->hash     = hash;
+  entry->language = language;
+  entry->text     = copy;
+  entry->length   = length;
+  entry->tree     = tree;
+  cache->count++;
+  cache->bytes += length;
+  return tree;
+}
+
+static bool name_equals(const char *name, uint32_t length, const char *expected) {
+  return strlen(expected) == length && memcmp(name, expected, length) == 0;
+}
+
+static bool node_text_equals(TSNode node, const char *source,
+                             const char *text, uint32_t length) {
+  uint32_t start = ts_node_start_byte(node);
+  uint32_t end = ts_node_end_byte(node);
+  return (end - start) == length && memcmp(&source[start], text, length) == 0;
+}
+
+static bool node_texts_equal(TSNode a, TSNode b, const char *source) {
+  uint32_t start = ts_node_start_byte(b);
+  return node_text_equals(a, source, &source[start],
+                          ts_node_end_byte(b) - start);
+}
+
+static const TSNode *capture_node(const TSQueryMatch *match, uint32_t capture_id) {
+  for (uint16_t i = 0; i < match->capture_count; i++) {
+    if (match->captures[i].index == capture_id) {
+      return &match->captures[i].node;
+    }
+  }
+  return NULL;
+}
+
+// Walk the predicates of a match, checking #eq?/#not-eq?/#any-of? and
+// picking up `#set! injection.language "..."`.  Returns false if the match
+// is rejected.
+static bool apply_predicates(const TSQuery *query, const TSQueryMatch *match,
+                             const char *source, const char **language,
+                             uint32_t *language_length) {
+  uint32_t step_count;
+  const TSQueryPredicateStep *steps =
+      ts_query_predicates_for_pattern(query, match->pattern_index, &step_count);
+
+  uint32_t i = 0;
+  while (i < step_count) {
+    // Each predicate is [operator, args..., Done]
+    uint32_t end = i;
+    while (end < step_count && steps[end].type != TSQueryPredicateStepTypeDone) {
+      end++;
+    }
+    uint32_t argc = end - i;
+
+    if (argc >= 1 && steps[i].type == TSQueryPredicateStepTypeString) {
+      uint32_t op_length;
+      const char *op =
+          ts_query_string_value_for_id(query, steps[i].value_id, &op_length);
+
+      if (argc == 3 && (name_equals(op, op_length, "eq?") ||
+                        name_equals(op, op_length, "not-eq?"))) {
+        bool negate = op[0] == 'n';
+        bool equal = false;
+        const TSNode *lhs = steps[i + 1].type == TSQueryPredicateStepTypeCapture
+                                ? capture_node(match, steps[i + 1].value_id)
+                                : NULL;
+        if (lhs && steps[i + 2].type == TSQueryPredicateStepTypeCapture) {
+          const TSNode *rhs = capture_node(match, steps[i + 2].value_id);
+          equal = rhs && node_texts_equal(*lhs, *rhs, source);
+        } else if (lhs) {
+          uint32_t length;
+          const char *text =
+              ts_query_string_value_for_id(query, steps[i + 2].value_id, &length);
+          equal = node_text_equals(*lhs, source, text, length);
+        }
+        if (equal == negate) {
+          return false;
+        }
+      } else if (argc >= 2 && name_equals(op, op_length, "any-of?") &&
+                 steps[i + 1].type == TSQueryPredicateStepTypeCapture) {
+        const TSNode *node = capture_node(match, steps[i + 1].value_id);
+        bool found = false;
+        for (uint32_t arg = i + 2; node && !found && arg < end; arg++) {
+          uint32_t length;
+          const char *text =
+              ts_query_string_value_for_id(query, steps[arg].value_id, &length);
+          found = node_text_equals(*node, source, text, length);
+        }
+        if (node && !found) {
+          return false;
+        }
+      } else if (argc == 3 && name_equals(op, op_length, "set!") &&
+                 steps[i + 1].type == TSQueryPredicateStepTypeString &&
+                 steps[i + 2].type == TSQueryPredicateStepTypeString) {
+        uint32_t key_length;
+        const char *key =
+            ts_query_string_value_for_id(query, steps[i + 1].value_id, &key_length);
+        if (name_equals(key, key_length, "injection.language")) {
+          *language = ts_query_string_value_for_id(query, steps[i + 2].value_id,
+                                                   language_length);
+        }
+      }
+    }
+    i = end + 1;
+  }
+  return true;
+}
+
+static bool find_capture_id(const TSQuery *query, const char *name, uint32_t *id) {
+  uint32_t count = ts_query_capture_count(query);
+  for (uint32_t i = 0; i < count; i++) {
+    uint32_t length;
+    const char *capture = ts_query_capture_name_for_id(query, i, &length);
+    if (name_equals(capture, length, name)) {
+      *id = i;
+      return true;
+    }
+  }
+  return false;
+}
+
+// A match that survived its predicates, before its region is parsed
+struct Injection_Candidate {
+  TSNode            content;
+  uint32_t          pattern_index;
+  const char       *language;
+  uint32_t          language_length;
+  const TSLanguage *ts_language;
+};
+
+// Document order, and for the same range the earliest pattern first
+static int compare_candidates(const void *a, const void *b) {
+  const struct Injection_Candidate *x = (const struct Injection_Candidate *)a;
+  const struct Injection_Candidate *y = (const struct Injection_Candidate *)b;
+  uint32_t x_start = ts_node_start_byte(x->content), y_start = ts_node_start_byte(y->content);
+  if (x_start != y_start) return x_start < y_start ? -1 : 1;
+  uint32_t x_end = ts_node_end_byte(x->content), y_end = ts_node_end_byte(y->content);
+  if (x_end != y_end) return x_end > y_end ? -1 : 1;
+  if (x->pattern_index != y->pattern_index) {
+    return x->pattern_index < y->pattern_index ? -1 : 1;
+  }
+  return 0;
+}
+
+uint32_t ObjectScript_Injection_Cache_inject(
+    struct ObjectScript_Injection_Cache *cache, TSParser *parser,
+    const TSQuery *query, TSNode root, const char *source,
+    ObjectScript_Injection_Resolver resolve,
+    ObjectScript_Injection_Callback callback, void *payload) {
+  uint32_t content_id, language_id;
+  if (!find_capture_id(query, "injection.content", &content_id)) {
+    return 0;
+  }
+  bool has_language_capture =
+      find_capture_id(query, "injection.language", &language_id);
+
+  struct Injection_Candidate *candidates = NULL;
+  uint32_t count = 0, capacity = 0;
+  TSQueryCursor *cursor = ts_query_cursor_new();
+  ts_query_cursor_exec(cursor, query, root);
+
+  TSQueryMatch match;
+  while (ts_query_cursor_next_match(cursor, &match)) {
+    const char *language = NULL;
+    uint32_t language_length = 0;
+    if (!apply_predicates(query, &match, source, &language, &language_length)) {
+      continue;
+    }
+
+    // A captured language name wins over a #set! default
+    const TSNode *language_node =
+        has_language_capture ? capture_node(&match, language_id) : NULL;
+    if (language_node) {
+      uint32_t start = ts_node_start_byte(*language_node);
+      language = &source[start];
+      language_length = ts_node_end_byte(*language_node) - start;
+    }
+    if (!language) continue;
+
+    const TSLanguage *ts_language = resolve(payload, language, language_length);
+    if (!ts_language) continue;
+
+    for (uint16_t i = 0; i < match.capture_count; i++) {
+      if (match.captures[i].index != content_id) continue;
+
+      if (count == capacity) {
+        uint32_t grown = capacity ? capacity * 2 : 16;
+        struct Injection_Candidate *resized = (struct Injection_Candidate *)realloc(
+            candidates, grown * sizeof(struct Injection_Candidate));
+        if (!resized) break;
+        candidates = resized;
+        capacity = grown;
+      }
+      candidates[count++] = (struct Injection_Candidate){
+        .content         = match.captures[i].node,
+        .pattern_index   = match.pattern_index,
+        .language        = language,
+        .language_length = language_length,
+        .ts_language     = ts_language,
+      };
+    }
+  }
+  ts_query_cursor_delete(cursor);
+
+  // A node gets the injection of the first pattern that matched it, the
+  // way the tree-sitter highlighter picks one, so an xdata body that a
+  // MimeType pattern claimed isn't injected again by the catch-all xml one.
+  // Candidates with the same range sort next to each other.
+  if (count) qsort(candidates, count, sizeof(struct Injection_Candidate), compare_candidates);
+
+  uint32_t reported = 0;
+  for (uint32_t i = 0; i < count; i++) {
+    const struct Injection_Candidate *candidate = &candidates[i];
+    bool claimed = false;
+    for (uint32_t j = i; j > 0 && !claimed; j--) {
+      const struct Injection_Candidate *earlier = &candidates[j - 1];
+      if (ts_node_start_byte(earlier->content) != ts_node_start_byte(candidate->content) ||
+          ts_node_end_byte(earlier->content) != ts_node_end_byte(candidate->content)) {
+        break;
+      }
+      claimed = ts_node_eq(earlier->content, candidate->content);
+    }
+    if (claimed) continue;
+
+    uint32_t start = ts_node_start_byte(candidate->content);
+    const TSTree *tree = ObjectScript_Injection_Cache_parse(
+        cache, parser, candidate->ts_language, &source[start],
+        ts_node_end_byte(candidate->content) - start);
+    if (!tree) continue;
+
+    struct ObjectScript_Injection injection = {
+      .content         = candidate->content,
+      .language        = candidate->language,
+      .language_length = candidate->language_length,
+      .tree            = tree,
+    };
+    callback(payload, &injection);
+    reported++;
+  }
+
+  free(candidates);
+  return reported;
+}
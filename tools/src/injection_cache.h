@@ -0,0 +1,84 @@
+#ifndef OBJECTSCRIPT_INJECTION_CACHE_H_
+#define OBJECTSCRIPT_INJECTION_CACHE_H_
+
+#include <stdint.h>
+#include <stddef.h>
+#include <tree_sitter/api.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Content-hash keyed cache of parsed injected regions (%SQLQuery bodies,
+// XData, Storage, &sql<>, &html<> ...).
+//
+// Generated classes tend to carry identical bodies, so a host that routes
+// every injection through the cache parses each distinct (language, text)
+// pair once per session instead of once per occurrence.
+//
+// NOTE: Regions are parsed from their own text, so the byte offsets and
+//       points of a cached tree are relative to the start of the region,
+//       not to the enclosing document.
+struct ObjectScript_Injection_Cache;
+
+struct ObjectScript_Injection_Cache_Stats {
+  uint32_t entries;   // Distinct (language, text) pairs held
+  uint64_t hits;      // Lookups answered from the cache
+  uint64_t misses;    // Lookups that had to parse, and got a tree
+  size_t   bytes;     // Bytes of region text retained for key comparison
+};
+
+struct ObjectScript_Injection_Cache *ObjectScript_Injection_Cache_new(void);
+void ObjectScript_Injection_Cache_delete(struct ObjectScript_Injection_Cache *cache);
+
+// Drop every cached tree, e.g. when the session ends
+void ObjectScript_Injection_Cache_clear(struct ObjectScript_Injection_Cache *cache);
+
+void ObjectScript_Injection_Cache_stats(
+    const struct ObjectScript_Injection_Cache *cache,
+    struct ObjectScript_Injection_Cache_Stats *stats);
+
+// Return the tree for `text` parsed as `language`, parsing it with `parser`
+// only if an identical region hasn't been seen before.  The tree is owned
+// by the cache; use ts_tree_copy() to keep it past the next clear/delete.
+//
+// Returns NULL if the parser could not produce a tree, or on running out of
+// memory for a new entry.
+const TSTree *ObjectScript_Injection_Cache_parse(
+    struct ObjectScript_Injection_Cache *cache, TSParser *parser,
+    const TSLanguage *language, const char *text, uint32_t length);
+
+// Injection driver for hosts built on this repo: runs an injections query
+// (e.g. udl/queries/injections.scm) over `root`, works out the language of
+// each match from `@injection.language` or `#set! injection.language`, and
+// parses the `@injection.content` region through the cache.
+//
+// `#eq?` / `#not-eq?` / `#any-of?` predicates are honoured, anything else is
+// ignored.  A node matched by several patterns is injected once, by the
+// first of them in the query, and injections are reported in document order.
+
+typedef const TSLanguage *(*ObjectScript_Injection_Resolver)(
+    void *payload, const char *name, uint32_t length);
+
+struct ObjectScript_Injection {
+  TSNode        content;          // The @injection.content node
+  const char   *language;         // Not NUL terminated
+  uint32_t      language_length;
+  const TSTree *tree;             // Owned by the cache, region relative
+};
+
+typedef void (*ObjectScript_Injection_Callback)(
+    void *payload, const struct ObjectScript_Injection *injection);
+
+// Returns the number of injections reported to `callback`
+uint32_t ObjectScript_Injection_Cache_inject(
+    struct ObjectScript_Injection_Cache *cache, TSParser *parser,
+    const TSQuery *query, TSNode root, const char *source,
+    ObjectScript_Injection_Resolver resolve,
+    ObjectScript_Injection_Callback callback, void *payload);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // OBJECTSCRIPT_INJECTION_CACHE_H_
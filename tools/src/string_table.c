@@ -0,0 +1,164 @@
+#include "string_table.h"
+#include <stdlib.h>
+#include <string.h>
+
+#define STRING_TABLE_BLOCK_SIZE (64 * 1024)
+#define STRING_TABLE_INITIAL_CAPACITY 1024
+
+struct String_Block {
+  struct String_Block *next;
+  uint32_t used;
+  uint32_t size;
+  char data[];
+};
+
+struct String_Entry {
+  const char *string;
+  uint32_t length;
+  uint32_t hash;
+};
+
+struct ObjectScript_String_Table {
+  struct String_Entry *entries;   // By id
+  uint32_t count;
+  uint32_t entry_capacity;
+  uint32_t *slots;                // Open addressing, id + 1, 0 == empty
+  uint32_t slot_capacity;         // Always a power of two
+  struct String_Block *blocks;    // Newest first
+  size_t bytes;
+};
+
+// FNV-1a
+static uint32_t hash_string(const char *string, uint32_t length) {
+  uint32_t hash = 0x811c9dc5u;
+  for (uint32_t i = 0; i < length; i++) {
+    hash ^= (unsigned char)string[i];
+    hash *= 0x01000193u;
+  }
+  return hash;
+}
+
+struct ObjectScript_String_Table *ObjectScript_String_Table_new(void) {
+  struct ObjectScript_String_Table *table =
+      (struct ObjectScript_String_Table *)calloc(1, sizeof(*table));
+  if (!table) return NULL;
+  table->slot_capacity = STRING_TABLE_INITIAL_CAPACITY;
+  table->slots = (uint32_t *)calloc(table->slot_capacity, sizeof(uint32_t));
+  if (!table->slots) {
+    free(table);
+    return NULL;
+  }
+  return table;
+}
+
+void ObjectScript_String_Table_delete(struct ObjectScript_String_Table *table) {
+  if (!table) return;
+  struct String_Block *block = table->blocks;
+  while (block) {
+    struct String_Block *next = block->next;
+    free(block);
+    block = next;
+  }
+  free(table->entries);
+  free(table->slots);
+  free(table);
+}
+
+static uint32_t find_slot(const struct ObjectScript_String_Table *table, const char *string,
+                          uint32_t length, uint32_t hash) {
+  uint32_t slot = hash & (table->slot_capacity - 1);
+  while (table->slots[slot]) {
+    const struct String_Entry *entry = &table->entries[table->slots[slot] - 1];
+    if (entry->hash == hash && entry->length == length &&
+        memcmp(entry->string, string, length) == 0) {
+      break;
+    }
+    slot = (slot + 1) & (table->slot_capacity - 1);
+  }
+  return slot;
+}
+
+uint32_t ObjectScript_String_Table_lookup(const struct ObjectScript_String_Table *table,
+                                          const char *string, uint32_t length) {
+  uint32_t slot = find_slot(table, string, length, hash_string(string, length));
+  return table->slots[slot] ? table->slots[slot] - 1 : OBJECTSCRIPT_STRING_NONE;
+}
+
+static bool grow_slots(struct ObjectScript_String_Table *table) {
+  uint32_t capacity = table->slot_capacity * 2;
+  uint32_t *slots = (uint32_t *)calloc(capacity, sizeof(uint32_t));
+  if (!slots) return false;
+  for (uint32_t id = 0; id < table->count; id++) {
+    uint32_t slot = table->entries[id].hash & (capacity - 1);
+    while (slots[slot]) slot = (slot + 1) & (capacity - 1);
+    slots[slot] = id + 1;
+  }
+  free(table->slots);
+  table->slots = slots;
+  table->slot_capacity = capacity;
+  return true;
+}
+
+static char *copy_string(struct ObjectScript_String_Table *table, const char *string,
+                         uint32_t length) {
+  struct String_Block *block = table->blocks;
+  if (!block || block->size - block->used < length + 1) {
+    uint32_t size = length + 1 > STRING_TABLE_BLOCK_SIZE ? length + 1 : STRING_TABLE_BLOCK_SIZE;
+    block = (struct String_Block *)malloc(sizeof(struct String_Block) + size);
+    if (!block) return NULL;
+    block->next = table->blocks;
+    block->used = 0;
+    block->size = size;
+    table->blocks = block;
+    table->bytes += sizeof(struct String_Block) + size;
+  }
+  char *copy = block->data + block->used;
+  memcpy(copy, string, length);
+  copy[length] = '\0';
+  block->used += length + 1;
+  return copy;
+}
+
+uint32_t ObjectScript_String_Table_intern(struct ObjectScript_String_Table *table,
+                                          const char *string, uint32_t length) {
+  uint32_t hash = hash_string(string, length);
+  uint32_t slot = find_slot(table, string, length, hash);
+  if (table->slots[slot]) return table->slots[slot] - 1;
+
+  // Keep the load factor under 3/4, re-probing if the table moved
+  if ((table->count + 1) * 4 > table->slot_capacity * 3) {
+    if (!grow_slots(table)) return OBJECTSCRIPT_STRING_NONE;
+    slot = find_slot(table, string, length, hash);
+  }
+  if (table->count == table->entry_capacity) {
+    uint32_t capacity = table->entry_capacity ? table->entry_capacity * 2 : 1024;
+    struct String_Entry *entries =
+        (struct String_Entry *)realloc(table->entries, capacity * sizeof(struct String_Entry));
+    if (!entries) return OBJECTSCRIPT_STRING_NONE;
+    table->entries = entries;
+    table->entry_capacity = capacity;
+  }
+  char *copy = copy_string(table, string, length);
+  if (!copy) return OBJECTSCRIPT_STRING_NONE;
+
+  uint32_t id = table->count++;
+  table->entries[id] = (struct String_Entry){copy, length, hash};
+  table->slots[slot] = id + 1;
+  return id;
+}
+
+const char *ObjectScript_String_Table_get(const struct ObjectScript_String_Table *table,
+                                          uint32_t id, uint32_t *length) {
+  if (id >= table->count) return NULL;
+  if (length) *length = table->entries[id].length;
+  return table->entries[id].string;
+}
+
+uint32_t ObjectScript_String_Table_count(const struct ObjectScript_String_Table *table) {
+  return table->count;
+}
+
+size_t ObjectScript_String_Table_bytes(const struct ObjectScript_String_Table *table) {
+  return table->bytes + table->entry_capacity * sizeof(struct String_Entry) +
+         table->slot_capacity * sizeof(uint32_t);
+}
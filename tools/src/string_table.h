@@ -0,0 +1,46 @@
+#ifndef OBJECTSCRIPT_STRING_TABLE_H_
+#define OBJECTSCRIPT_STRING_TABLE_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Interned strings with dense ids, for the graph builders.
+//
+// Strings are copied into blocks that never move, so the pointer returned
+// for an id stays valid for the life of the table, and ids count up from 0
+// so they can index side arrays.
+struct ObjectScript_String_Table;
+
+#define OBJECTSCRIPT_STRING_NONE UINT32_MAX
+
+struct ObjectScript_String_Table *ObjectScript_String_Table_new(void);
+void ObjectScript_String_Table_delete(struct ObjectScript_String_Table *table);
+
+// The id of the string, adding it if needed.  Returns
+// OBJECTSCRIPT_STRING_NONE if out of memory.
+uint32_t ObjectScript_String_Table_intern(struct ObjectScript_String_Table *table,
+                                          const char *string, uint32_t length);
+
+// The id of the string, or OBJECTSCRIPT_STRING_NONE if it was never interned
+uint32_t ObjectScript_String_Table_lookup(const struct ObjectScript_String_Table *table,
+                                          const char *string, uint32_t length);
+
+// NUL terminated
+const char *ObjectScript_String_Table_get(const struct ObjectScript_String_Table *table,
+                                          uint32_t id, uint32_t *length);
+
+uint32_t ObjectScript_String_Table_count(const struct ObjectScript_String_Table *table);
+
+// Bytes held, for reporting
+size_t ObjectScript_String_Table_bytes(const struct ObjectScript_String_Table *table);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // OBJECTSCRIPT_STRING_TABLE_H_
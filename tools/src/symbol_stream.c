@@ -0,0 +1,441 @@
+#include "symbol_stream.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define SYMBOL_STREAM_BUFFER_SIZE (64 * 1024)
+
+// Room for the longest record: every text field at its maximum, escaped
+// (at most 6 bytes per byte), plus the fixed parts
+#define SYMBOL_STREAM_RECORD_MAX (10 * (6 * OBJECTSCRIPT_SYMBOL_STREAM_MAX_TEXT + 32) + 256)
+
+// What a node type means to the emitter, by symbol
+enum {
+  Role_none,
+  Role_class,                  // class_definition
+  Role_member,                 // method, property, ...
+  Role_method,                 // method, classmethod: the name is in method_definition
+  Role_method_definition,
+  Role_command,                // command_*, if it has a command_name
+  Role_tag,
+  Role_class_method_call,
+  Role_instance_method_call,
+  Role_routine_tag_call,
+  Role_extrinsic_function,
+  Role_class_ref,
+  Role_class_name,
+  Role_method_name,
+  Role_oref_method,
+  Role_relative_dot_method,
+  Role_line_ref,
+};
+
+struct Role_Name {
+  const char *name;
+  uint8_t role;
+};
+
+static const struct Role_Name ROLE_NAMES[] = {
+  {"class_definition", Role_class},
+  {"method", Role_method},
+  {"classmethod", Role_method},
+  {"property", Role_member},
+  {"parameter", Role_member},
+  {"relationship", Role_member},
+  {"foreignkey", Role_member},
+  {"index", Role_member},
+  {"query", Role_member},
+  {"trigger", Role_member},
+  {"xdata", Role_member},
+  {"storage", Role_member},
+  {"projection", Role_member},
+  {"method_definition", Role_method_definition},
+  {"tag", Role_tag},
+  {"class_method_call", Role_class_method_call},
+  {"instance_method_call", Role_instance_method_call},
+  {"routine_tag_call", Role_routine_tag_call},
+  {"extrinsic_function", Role_extrinsic_function},
+  {"class_ref", Role_class_ref},
+  {"class_name", Role_class_name},
+  {"method_name", Role_method_name},
+  {"oref_method", Role_oref_method},
+  {"relative_dot_method", Role_relative_dot_method},
+  {"line_ref", Role_line_ref},
+};
+
+// A slice of the source
+struct Span {
+  uint32_t start;
+  uint32_t end;
+};
+
+struct ObjectScript_Symbol_Stream {
+  uint32_t kinds;
+  ObjectScript_Symbol_Stream_Writer write;
+  void *payload;
+  bool failed;
+
+  uint8_t *roles;   // By symbol
+  uint32_t symbol_count;
+  TSFieldId name_field;
+  TSFieldId class_name_field;
+  TSFieldId command_name_field;
+  TSFieldId label_field;
+  TSFieldId routine_field;
+
+  // Current file
+  const char *text;
+  uint32_t length;
+  const char *path;
+  struct Span class_name;
+  uint32_t class_end;
+  struct Span member;
+  uint32_t member_end;
+  struct Span label;
+
+  struct ObjectScript_Symbol_Stream_Stats stats;
+  uint32_t used;
+  char buffer[SYMBOL_STREAM_BUFFER_SIZE];
+};
+
+bool ObjectScript_Symbol_Stream_write_file(void *payload, const char *data, size_t length) {
+  return fwrite(data, 1, length, (FILE *)payload) == length;
+}
+
+struct ObjectScript_Symbol_Stream *ObjectScript_Symbol_Stream_new(
+    const TSLanguage *language, uint32_t kinds,
+    ObjectScript_Symbol_Stream_Writer write, void *payload) {
+  struct ObjectScript_Symbol_Stream *stream =
+      (struct ObjectScript_Symbol_Stream *)calloc(1, sizeof(*stream));
+  if (!stream) return NULL;
+  stream->kinds = kinds;
+  stream->write = write;
+  stream->payload = payload;
+
+  // Classify every symbol by name up front, so aliases of the same node
+  // type are covered too and the walk only does table lookups
+  stream->symbol_count = ts_language_symbol_count(language);
+  stream->roles = (uint8_t *)calloc(stream->symbol_count, 1);
+  if (!stream->roles) {
+    free(stream);
+    return NULL;
+  }
+  for (uint32_t symbol = 0; symbol < stream->symbol_count; symbol++) {
+    if (ts_language_symbol_type(language, (TSSymbol)symbol) != TSSymbolTypeRegular) continue;
+    const char *name = ts_language_symbol_name(language, (TSSymbol)symbol);
+    if (!strncmp(name, "command_", 8)) {
+      stream->roles[symbol] = Role_command;
+      continue;
+    }
+    for (size_t i = 0; i < sizeof(ROLE_NAMES) / sizeof(ROLE_NAMES[0]); i++) {
+      if (!strcmp(name, ROLE_NAMES[i].name)) {
+        stream->roles[symbol] = ROLE_NAMES[i].role;
+        break;
+      }
+    }
+  }
+  stream->name_field = ts_language_field_id_for_name(language, "name", 4);
+  stream->class_name_field = ts_language_field_id_for_name(language, "class_name", 10);
+  stream->command_name_field = ts_language_field_id_for_name(language, "command_name", 12);
+  stream->label_field = ts_language_field_id_for_name(language, "label", 5);
+  stream->routine_field = ts_language_field_id_for_name(language, "routine", 7);
+  return stream;
+}
+
+bool ObjectScript_Symbol_Stream_flush(struct ObjectScript_Symbol_Stream *stream) {
+  if (stream->failed) return false;
+  if (stream->used) {
+    if (!stream->write(stream->payload, stream->buffer, stream->used)) stream->failed = true;
+    stream->stats.bytes += stream->used;
+    stream->used = 0;
+  }
+  return !stream->failed;
+}
+
+bool ObjectScript_Symbol_Stream_delete(struct ObjectScript_Symbol_Stream *stream) {
+  if (!stream) return true;
+  bool ok = ObjectScript_Symbol_Stream_flush(stream);
+  free(stream->roles);
+  free(stream);
+  return ok;
+}
+
+void ObjectScript_Symbol_Stream_stats(const struct ObjectScript_Symbol_Stream *stream,
+                                      struct ObjectScript_Symbol_Stream_Stats *stats) {
+  *stats = stream->stats;
+}
+
+// Output. Records are only started with SYMBOL_STREAM_RECORD_MAX bytes of
+// room, so none of these check for space.
+
+static void put(struct ObjectScript_Symbol_Stream *stream, const char *data, size_t length) {
+  memcpy(stream->buffer + stream->used, data, length);
+  stream->used += (uint32_t)length;
+}
+
+#define PUT_LITERAL(stream, literal) put(stream, literal, sizeof(literal) - 1)
+
+static void put_number(struct ObjectScript_Symbol_Stream *stream, const char *key, uint32_t value) {
+  stream->used += (uint32_t)sprintf(stream->buffer + stream->used, ",\"%s\":%u", key, value);
+}
+
+static void put_string(struct ObjectScript_Symbol_Stream *stream, const char *data, size_t length) {
+  static const char HEX[] = "0123456789abcdef";
+  char *out = stream->buffer + stream->used;
+  *out++ = '"';
+  for (size_t i = 0; i < length; i++) {
+    unsigned char c = (unsigned char)data[i];
+    if (c == '"' || c == '\\') {
+      *out++ = '\\';
+      *out++ = (char)c;
+    } else if (c < 0x20) {
+      memcpy(out, "\\u00", 4);
+      out[4] = HEX[c >> 4];
+      out[5] = HEX[c & 0xf];
+      out += 6;
+    } else {
+      *out++ = (char)c;
+    }
+  }
+  *out++ = '"';
+  stream->used = (uint32_t)(out - stream->buffer);
+}
+
+static void put_field(struct ObjectScript_Symbol_Stream *stream, const char *key,
+                      const char *data, size_t length) {
+  stream->buffer[stream->used++] = ',';
+  put_string(stream, key, strlen(key));
+  stream->buffer[stream->used++] = ':';
+  put_string(stream, data, length);
+}
+
+// A source slice, cut to the maximum length on a UTF-8 character boundary
+static void put_span(struct ObjectScript_Symbol_Stream *stream, const char *key, struct Span span) {
+  if (span.end <= span.start || span.end > stream->length) return;
+  uint32_t length = span.end - span.start;
+  const char *data = stream->text + span.start;
+  if (length > OBJECTSCRIPT_SYMBOL_STREAM_MAX_TEXT) {
+    length = OBJECTSCRIPT_SYMBOL_STREAM_MAX_TEXT;
+    while (length && ((unsigned char)data[length] & 0xc0) == 0x80) length--;
+  }
+  put_field(stream, key, data, length);
+}
+
+static struct Span node_span(TSNode node) {
+  if (ts_node_is_null(node)) return (struct Span){0, 0};
+  return (struct Span){ts_node_start_byte(node), ts_node_end_byte(node)};
+}
+
+static uint8_t node_role(const struct ObjectScript_Symbol_Stream *stream, TSNode node) {
+  TSSymbol symbol = ts_node_symbol(node);
+  return symbol < stream->symbol_count ? stream->roles[symbol] : Role_none;
+}
+
+// The first named child with `role`, or a null node
+static TSNode child_with_role(const struct ObjectScript_Symbol_Stream *stream, TSNode node,
+                              uint8_t role) {
+  uint32_t count = ts_node_named_child_count(node);
+  for (uint32_t i = 0; i < count; i++) {
+    TSNode child = ts_node_named_child(node, i);
+    if (node_role(stream, child) == role) return child;
+  }
+  return (TSNode){{0, 0, 0, 0}, NULL, NULL};
+}
+
+// Starts a record, returning false if the writer has failed
+static bool begin_record(struct ObjectScript_Symbol_Stream *stream, const char *kind,
+                         TSNode node) {
+  if (stream->used + SYMBOL_STREAM_RECORD_MAX > SYMBOL_STREAM_BUFFER_SIZE &&
+      !ObjectScript_Symbol_Stream_flush(stream)) {
+    return false;
+  }
+  PUT_LITERAL(stream, "{\"file\":");
+  if (stream->path) {
+    size_t length = strlen(stream->path);
+    put_string(stream, stream->path,
+               length < OBJECTSCRIPT_SYMBOL_STREAM_MAX_TEXT ? length
+                                                            : OBJECTSCRIPT_SYMBOL_STREAM_MAX_TEXT);
+  } else {
+    PUT_LITERAL(stream, "null");
+  }
+  put_field(stream, "kind", kind, strlen(kind));
+  const char *type = ts_node_type(node);
+  put_field(stream, "type", type, strlen(type));
+  put_span(stream, "class", stream->class_name);
+  put_span(stream, "member", stream->member);
+  put_span(stream, "label", stream->label);
+  return true;
+}
+
+static void end_record(struct ObjectScript_Symbol_Stream *stream, TSNode node) {
+  TSPoint start = ts_node_start_point(node);
+  put_number(stream, "start", ts_node_start_byte(node));
+  put_number(stream, "end", ts_node_end_byte(node));
+  put_number(stream, "line", start.row + 1);
+  put_number(stream, "column", start.column + 1);
+  PUT_LITERAL(stream, "}\n");
+}
+
+static void emit_member(struct ObjectScript_Symbol_Stream *stream, TSNode node, uint8_t role) {
+  TSNode named = role == Role_method ? child_with_role(stream, node, Role_method_definition) : node;
+  struct Span name = ts_node_is_null(named)
+                         ? (struct Span){0, 0}
+                         : node_span(ts_node_child_by_field_id(named, stream->name_field));
+
+  if ((stream->kinds & ObjectScript_Symbol_Stream_members) &&
+      begin_record(stream, "member", node)) {
+    put_span(stream, "name", name);
+    end_record(stream, node);
+    stream->stats.members++;
+  }
+
+  // The context of everything inside it
+  stream->member = name;
+  stream->member_end = ts_node_end_byte(node);
+  stream->label = (struct Span){0, 0};
+}
+
+static void emit_command(struct ObjectScript_Symbol_Stream *stream, TSNode node) {
+  TSNode keyword = ts_node_child_by_field_id(node, stream->command_name_field);
+  if (ts_node_is_null(keyword)) return;   // Not a command, e.g. command_lock_argument
+  if (!(stream->kinds & ObjectScript_Symbol_Stream_commands)) return;
+  if (!begin_record(stream, "command", node)) return;
+  put_span(stream, "name", node_span(keyword));
+  end_record(stream, node);
+  stream->stats.commands++;
+}
+
+static void emit_call(struct ObjectScript_Symbol_Stream *stream, TSNode node, uint8_t role) {
+  if (!(stream->kinds & ObjectScript_Symbol_Stream_calls)) return;
+  if (!begin_record(stream, "call", node)) return;
+
+  switch (role) {
+    case Role_class_method_call: {
+      // ##class(Name).Method(): fall back to the whole class_ref when the
+      // class is an expression
+      TSNode class_ref = child_with_role(stream, node, Role_class_ref);
+      TSNode class_name = ts_node_is_null(class_ref)
+                              ? class_ref
+                              : child_with_role(stream, class_ref, Role_class_name);
+      put_span(stream, "target_class",
+               node_span(ts_node_is_null(class_name) ? class_ref : class_name));
+      put_span(stream, "name", node_span(child_with_role(stream, node, Role_method_name)));
+      break;
+    }
+    case Role_instance_method_call: {
+      // receiver.a.b.Method(): the method is the last one in the chain
+      TSNode method = {{0, 0, 0, 0}, NULL, NULL};
+      uint32_t count = ts_node_named_child_count(node);
+      for (uint32_t i = 0; i < count; i++) {
+        TSNode child = ts_node_named_child(node, i);
+        uint8_t child_role = node_role(stream, child);
+        if (child_role == Role_relative_dot_method) {
+          child = child_with_role(stream, child, Role_oref_method);
+          child_role = Role_oref_method;
+        }
+        if (child_role == Role_oref_method) method = child;
+      }
+      if (count) {
+        TSNode receiver = ts_node_named_child(node, 0);
+        uint8_t receiver_role = node_role(stream, receiver);
+        if (receiver_role != Role_oref_method && receiver_role != Role_relative_dot_method) {
+          put_span(stream, "receiver", node_span(receiver));
+        }
+      }
+      if (!ts_node_is_null(method)) {
+        put_span(stream, "name", node_span(child_with_role(stream, method, Role_method_name)));
+      }
+      break;
+    }
+    case Role_routine_tag_call:
+    case Role_extrinsic_function: {
+      // DO label^routine() has them on its line_ref, $$label^routine() on
+      // the node itself
+      TSNode ref = role == Role_routine_tag_call ? child_with_role(stream, node, Role_line_ref)
+                                                 : node;
+      if (ts_node_is_null(ref)) break;
+      TSNode label = ts_node_child_by_field_id(ref, stream->label_field);
+      TSNode routine = ts_node_child_by_field_id(ref, stream->routine_field);
+      if (ts_node_is_null(label) && ts_node_is_null(routine)) {
+        put_span(stream, "name", node_span(ref));   // Indirection
+      } else {
+        put_span(stream, "name", node_span(label));
+        put_span(stream, "routine", node_span(routine));
+      }
+      break;
+    }
+  }
+  end_record(stream, node);
+  stream->stats.calls++;
+}
+
+bool ObjectScript_Symbol_Stream_emit(struct ObjectScript_Symbol_Stream *stream,
+                                     const TSTree *tree, const char *text,
+                                     uint32_t length, const char *path) {
+  if (stream->failed) return false;
+  stream->text = text;
+  stream->length = length;
+  stream->path = path;
+  stream->class_name = stream->member = stream->label = (struct Span){0, 0};
+  stream->class_end = stream->member_end = 0;
+
+  TSTreeCursor cursor = ts_tree_cursor_new(ts_tree_root_node(tree));
+  for (;;) {
+    TSNode node = ts_tree_cursor_current_node(&cursor);
+    uint32_t start = ts_node_start_byte(node);
+
+    // Pre-order, so the first node at or past the end of the member (or
+    // class) is outside of it.  Labels are scoped to the member, in
+    // routines they last until the next one.
+    if (stream->member_end && start >= stream->member_end) {
+      stream->member = stream->label = (struct Span){0, 0};
+      stream->member_end = 0;
+    }
+    if (stream->class_end && start >= stream->class_end) {
+      stream->class_name = stream->label = (struct Span){0, 0};
+      stream->class_end = 0;
+    }
+
+    uint8_t role = node_role(stream, node);
+    switch (role) {
+      case Role_class:
+        stream->class_name =
+            node_span(ts_node_child_by_field_id(node, stream->class_name_field));
+        stream->class_end = ts_node_end_byte(node);
+        stream->label = (struct Span){0, 0};
+        break;
+      case Role_member:
+      case Role_method:
+        emit_member(stream, node, role);
+        break;
+      case Role_tag:
+        stream->label = node_span(node);
+        break;
+      case Role_command:
+        emit_command(stream, node);
+        break;
+      case Role_class_method_call:
+      case Role_instance_method_call:
+      case Role_routine_tag_call:
+      case Role_extrinsic_function:
+        emit_call(stream, node, role);
+        break;
+    }
+    if (stream->failed) break;
+
+    if (ts_tree_cursor_goto_first_child(&cursor)) continue;
+    bool done = false;
+    while (!ts_tree_cursor_goto_next_sibling(&cursor)) {
+      if (!ts_tree_cursor_goto_parent(&cursor)) {
+        done = true;
+        break;
+      }
+    }
+    if (done) break;
+  }
+  ts_tree_cursor_delete(&cursor);
+
+  stream->text = NULL;
+  stream->path = NULL;
+  return !stream->failed;
+}
@@ -0,0 +1,94 @@
+#ifndef OBJECTSCRIPT_SYMBOL_STREAM_H_
+#define OBJECTSCRIPT_SYMBOL_STREAM_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stddef.h>
+#include <tree_sitter/api.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Streaming JSONL emitter for data pipelines.
+//
+// Walks a tree with a single TSTreeCursor and writes one JSON object per
+// line for every class member, command and call it passes, e.g.
+//
+//   {"file":"Sample.Person.cls","kind":"call","type":"class_method_call",
+//    "class":"Sample.Person","member":"Save","target_class":"%Library.File",
+//    "name":"Exists","start":1534,"end":1561,"line":48,"column":10}
+//
+// (one line in the output).  Records are built in a fixed size buffer and
+// handed to the write callback as it fills, and the only other state is the
+// enclosing class, member and label, so memory use doesn't depend on the
+// size of the file or of the output.
+//
+//   kind     type                      name                  also
+//   member   method, classmethod,      the member name
+//            property, parameter, ...
+//   command  command_set, command_do,  the command keyword   (as written)
+//            ...
+//   call     class_method_call         the method            target_class
+//            instance_method_call      the method            receiver
+//            routine_tag_call          the label             routine
+//            extrinsic_function        the label             routine
+//
+// "class", "member" and "label" (the last tag seen, in routines and method
+// bodies) give the context of the record; they, and "receiver" for
+// ..Method(), are left out when there is none.  Byte offsets are into the
+// source, "line" and "column" are 1 based.  Source text in a record is cut
+// at OBJECTSCRIPT_SYMBOL_STREAM_MAX_TEXT bytes.
+struct ObjectScript_Symbol_Stream;
+
+#define OBJECTSCRIPT_SYMBOL_STREAM_MAX_TEXT 256
+
+// Which records to write
+enum {
+  ObjectScript_Symbol_Stream_members  = 1 << 0,
+  ObjectScript_Symbol_Stream_commands = 1 << 1,
+  ObjectScript_Symbol_Stream_calls    = 1 << 2,
+  ObjectScript_Symbol_Stream_all      = 0x7,
+};
+
+struct ObjectScript_Symbol_Stream_Stats {
+  uint64_t members;
+  uint64_t commands;
+  uint64_t calls;
+  uint64_t bytes;   // JSONL bytes handed to the write callback
+};
+
+// Receives the output in chunks that always end at a record boundary.
+// Return false to stop; the stream then fails every later call.
+typedef bool (*ObjectScript_Symbol_Stream_Writer)(
+    void *payload, const char *data, size_t length);
+
+// A writer for `payload` being a FILE *
+bool ObjectScript_Symbol_Stream_write_file(void *payload, const char *data, size_t length);
+
+// `language` is the grammar the trees come from (core or udl, expr has no
+// members or commands)
+struct ObjectScript_Symbol_Stream *ObjectScript_Symbol_Stream_new(
+    const TSLanguage *language, uint32_t kinds,
+    ObjectScript_Symbol_Stream_Writer write, void *payload);
+
+// Flushes, then frees the stream
+bool ObjectScript_Symbol_Stream_delete(struct ObjectScript_Symbol_Stream *stream);
+
+// Write the records of `tree`, parsed from `text`.  `path` goes into the
+// "file" field and may be NULL.  Returns false once the writer has failed.
+bool ObjectScript_Symbol_Stream_emit(struct ObjectScript_Symbol_Stream *stream,
+                                     const TSTree *tree, const char *text,
+                                     uint32_t length, const char *path);
+
+// Hand everything buffered so far to the writer
+bool ObjectScript_Symbol_Stream_flush(struct ObjectScript_Symbol_Stream *stream);
+
+void ObjectScript_Symbol_Stream_stats(const struct ObjectScript_Symbol_Stream *stream,
+                                      struct ObjectScript_Symbol_Stream_Stats *stats);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // OBJECTSCRIPT_SYMBOL_STREAM_H_
@@ -0,0 +1,78 @@
+#include "system_names.h"
+#include <string.h>
+
+#include "system_names_table.h"
+
+// FNV-1a over the kind and the upper case name, then the murmur3
+// finalizer.  Must stay the same as hash_name() in
+// scripts/generate-system-names.js.
+static uint32_t hash_name(uint32_t seed, uint8_t kind, const char *name, uint32_t length) {
+  uint32_t hash = 0x811c9dc5u ^ seed;
+  hash = (hash ^ kind) * 0x01000193u;
+  for (uint32_t i = 0; i < length; i++) {
+    unsigned char c = (unsigned char)name[i];
+    if (c >= 'a' && c <= 'z') c -= 'a' - 'A';
+    hash = (hash ^ c) * 0x01000193u;
+  }
+  hash ^= hash >> 16;
+  hash *= 0x85ebca6bu;
+  hash ^= hash >> 13;
+  hash *= 0xc2b2ae35u;
+  hash ^= hash >> 16;
+  return hash;
+}
+
+const struct ObjectScript_System_Name *ObjectScript_System_Name_lookup(
+    const char *text, uint32_t length, enum ObjectScript_System_Name_Kind kind) {
+  if (length < 2 || length > SYSTEM_NAME_MAX_LENGTH || text[0] != '$') return NULL;
+  const char *name = text + 1;
+  uint32_t name_length = length - 1;
+  uint32_t bucket = hash_name(0, (uint8_t)kind, name, name_length) % SYSTEM_NAME_BUCKET_COUNT;
+  uint32_t slot = hash_name(system_name_seeds[bucket], (uint8_t)kind, name, name_length) &
+                  (SYSTEM_NAME_SLOT_COUNT - 1);
+  if (!system_name_slots[slot]) return NULL;
+
+  const struct ObjectScript_System_Name *entry = &system_names[system_name_slots[slot] - 1];
+  if (entry->kind != kind || entry->length != length) return NULL;
+  for (uint32_t i = 1; i < length; i++) {
+    unsigned char c = (unsigned char)text[i];
+    if (c >= 'a' && c <= 'z') c -= 'a' - 'A';
+    if (c != (unsigned char)entry->spelling[i]) return NULL;
+  }
+  return entry;
+}
+
+const struct ObjectScript_System_Name *ObjectScript_System_Name_of_node(TSNode node,
+                                                                       const char *source) {
+  const char *type = ts_node_type(node);
+  enum ObjectScript_System_Name_Kind kind;
+  if (!strcmp(type, "system_defined_variable")) {
+    kind = ObjectScript_System_variable;
+  } else if (!strcmp(type, "system_defined_function") ||
+             !strcmp(type, "doable_dollar_functions")) {
+    kind = ObjectScript_System_function;
+  } else {
+    return NULL;
+  }
+
+  // The `$name` the node starts with, a function's must be followed by `(`
+  // ($SYSTEM.Class.Method() is a doable_dollar_functions too)
+  uint32_t start = ts_node_start_byte(node);
+  uint32_t end = ts_node_end_byte(node);
+  const char *text = source + start;
+  uint32_t length = 1;
+  while (start + length < end) {
+    unsigned char c = (unsigned char)text[length];
+    if (!((c >= 'A' && c <= 'Z') || (c >= 'a' && c <= 'z') || (c >= '0' && c <= '9'))) break;
+    length++;
+  }
+  if (kind == ObjectScript_System_function && (start + length >= end || text[length] != '(')) {
+    return NULL;
+  }
+  return ObjectScript_System_Name_lookup(text, length, kind);
+}
+
+const struct ObjectScript_System_Name *ObjectScript_System_Names(uint32_t *count) {
+  *count = SYSTEM_NAME_COUNT;
+  return system_names;
+}
@@ -0,0 +1,51 @@
+#ifndef OBJECTSCRIPT_SYSTEM_NAMES_H_
+#define OBJECTSCRIPT_SYSTEM_NAMES_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <tree_sitter/api.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Which system function or special variable a `$name` is.
+//
+// The grammars accept any `$name` as a system_defined_variable and any
+// `$name(` as a system_defined_function; this tells them apart, resolves
+// abbreviations (`$ZDT` is `$ZDATETIME`) and says whether the name exists
+// at all.  The names are listed in expr/system-names.js and compiled into
+// a perfect hash table by scripts/generate-system-names.js, so a lookup
+// is two hashes and one compare, without allocating.
+enum ObjectScript_System_Name_Kind {
+  ObjectScript_System_function = 1,
+  ObjectScript_System_variable = 2,
+};
+
+struct ObjectScript_System_Name {
+  const char *spelling;   // Upper case with the `$`, e.g. "$ZDT"
+  const char *name;       // The full name, e.g. "$ZDATETIME"
+  uint16_t id;            // Shared by a name and its abbreviations
+  uint8_t kind;           // ObjectScript_System_Name_Kind
+  uint8_t length;         // Of the spelling
+};
+
+// `text` is the name with its `$`, in any case.  Returns NULL if it isn't
+// a system name of that kind.
+const struct ObjectScript_System_Name *ObjectScript_System_Name_lookup(
+    const char *text, uint32_t length, enum ObjectScript_System_Name_Kind kind);
+
+// The name of a system_defined_variable node, or of the function called by
+// a system_defined_function or doable_dollar_functions node.  NULL for any
+// other node and for unknown names.
+const struct ObjectScript_System_Name *ObjectScript_System_Name_of_node(TSNode node,
+                                                                       const char *source);
+
+// Every spelling, full names before their abbreviations
+const struct ObjectScript_System_Name *ObjectScript_System_Names(uint32_t *count);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // OBJECTSCRIPT_SYSTEM_NAMES_H_
@@ -0,0 +1,358 @@
+// Generated by scripts/generate-system-names.js from expr/system-names.js, do not edit
+//
+// 287 spellings of 142 functions and 45 variables
+#ifndef OBJECTSCRIPT_SYSTEM_NAMES_TABLE_H_
+#define OBJECTSCRIPT_SYSTEM_NAMES_TABLE_H_
+
+#define SYSTEM_NAME_COUNT 287
+#define SYSTEM_NAME_BUCKET_COUNT 72
+#define SYSTEM_NAME_SLOT_COUNT 512
+#define SYSTEM_NAME_MAX_LENGTH 16
+
+static const struct ObjectScript_System_Name system_names[SYSTEM_NAME_COUNT] = {
+  {"$ASCII", "$ASCII", 0, ObjectScript_System_function, 6},
+  {"$A", "$ASCII", 0, ObjectScript_System_function, 2},
+  {"$BIT", "$BIT", 1, ObjectScript_System_function, 4},
+  {"$BITCOUNT", "$BITCOUNT", 2, ObjectScript_System_function, 9},
+  {"$BITFIND", "$BITFIND", 3, ObjectScript_System_function, 8},
+  {"$BITLOGIC", "$BITLOGIC", 4, ObjectScript_System_function, 9},
+  {"$CASE", "$CASE", 5, ObjectScript_System_function, 5},
+  {"$CHAR", "$CHAR", 6, ObjectScript_System_function, 5},
+  {"$C", "$CHAR", 6, ObjectScript_System_function, 2},
+  {"$CLASSMETHOD", "$CLASSMETHOD", 7, ObjectScript_System_function, 12},
+  {"$CLASSNAME", "$CLASSNAME", 8, ObjectScript_System_function, 10},
+  {"$COMPILE", "$COMPILE", 9, ObjectScript_System_function, 8},
+  {"$DATA", "$DATA", 10, ObjectScript_System_function, 5},
+  {"$D", "$DATA", 10, ObjectScript_System_function, 2},
+  {"$DECIMAL", "$DECIMAL", 11, ObjectScript_System_function, 8},
+  {"$DOUBLE", "$DOUBLE", 12, ObjectScript_System_function, 7},
+  {"$EXTRACT", "$EXTRACT", 13, ObjectScript_System_function, 8},
+  {"$E", "$EXTRACT", 13, ObjectScript_System_function, 2},
+  {"$FACTOR", "$FACTOR", 14, ObjectScript_System_function, 7},
+  {"$FIND", "$FIND", 15, ObjectScript_System_function, 5},
+  {"$F", "$FIND", 15, ObjectScript_System_function, 2},
+  {"$FNUMBER", "$FNUMBER", 16, ObjectScript_System_function, 8},
+  {"$FN", "$FNUMBER", 16, ObjectScript_System_function, 3},
+  {"$GET", "$GET", 17, ObjectScript_System_function, 4},
+  {"$G", "$GET", 17, ObjectScript_System_function, 2},
+  {"$INCREMENT", "$INCREMENT", 18, ObjectScript_System_function, 10},
+  {"$I", "$INCREMENT", 18, ObjectScript_System_function, 2},
+  {"$INUMBER", "$INUMBER", 19, ObjectScript_System_function, 8},
+  {"$IN", "$INUMBER", 19, ObjectScript_System_function, 3},
+  {"$ISOBJECT", "$ISOBJECT", 20, ObjectScript_System_function, 9},
+  {"$ISVALIDDOUBLE", "$ISVALIDDOUBLE", 21, ObjectScript_System_function, 14},
+  {"$ISVALIDNUM", "$ISVALIDNUM", 22, ObjectScript_System_function, 11},
+  {"$ISVECTOR", "$ISVECTOR", 23, ObjectScript_System_function, 9},
+  {"$JUSTIFY", "$JUSTIFY", 24, ObjectScript_System_function, 8},
+  {"$J", "$JUSTIFY", 24, ObjectScript_System_function, 2},
+  {"$LENGTH", "$LENGTH", 25, ObjectScript_System_function, 7},
+  {"$L", "$LENGTH", 25, ObjectScript_System_function, 2},
+  {"$LIST", "$LIST", 26, ObjectScript_System_function, 5},
+  {"$LI", "$LIST", 26, ObjectScript_System_function, 3},
+  {"$LISTBUILD", "$LISTBUILD", 27, ObjectScript_System_function, 10},
+  {"$LB", "$LISTBUILD", 27, ObjectScript_System_function, 3},
+  {"$LISTDATA", "$LISTDATA", 28, ObjectScript_System_function, 9},
+  {"$LD", "$LISTDATA", 28, ObjectScript_System_function, 3},
+  {"$LISTFIND", "$LISTFIND", 29, ObjectScript_System_function, 9},
+  {"$LF", "$LISTFIND", 29, ObjectScript_System_function, 3},
+  {"$LISTFROMSTRING", "$LISTFROMSTRING", 30, ObjectScript_System_function, 15},
+  {"$LFS", "$LISTFROMSTRING", 30, ObjectScript_System_function, 4},
+  {"$LISTGET", "$LISTGET", 31, ObjectScript_System_function, 8},
+  {"$LG", "$LISTGET", 31, ObjectScript_System_function, 3},
+  {"$LISTLENGTH", "$LISTLENGTH", 32, ObjectScript_System_function, 11},
+  {"$LL", "$LISTLENGTH", 32, ObjectScript_System_function, 3},
+  {"$LISTNEXT", "$LISTNEXT", 33, ObjectScript_System_function, 9},
+  {"$LISTSAME", "$LISTSAME", 34, ObjectScript_System_function, 9},
+  {"$LS", "$LISTSAME", 34, ObjectScript_System_function, 3},
+  {"$LISTTOSTRING", "$LISTTOSTRING", 35, ObjectScript_System_function, 13},
+  {"$LTS", "$LISTTOSTRING", 35, ObjectScript_System_function, 4},
+  {"$LISTUPDATE", "$LISTUPDATE", 36, ObjectScript_System_function, 11},
+  {"$LU", "$LISTUPDATE", 36, ObjectScript_System_function, 3},
+  {"$LISTVALID", "$LISTVALID", 37, ObjectScript_System_function, 10},
+  {"$LV", "$LISTVALID", 37, ObjectScript_System_function, 3},
+  {"$LOCATE", "$LOCATE", 38, ObjectScript_System_function, 7},
+  {"$MATCH", "$MATCH", 39, ObjectScript_System_function, 6},
+  {"$METHOD", "$METHOD", 40, ObjectScript_System_function, 7},
+  {"$NAME", "$NAME", 41, ObjectScript_System_function, 5},
+  {"$NA", "$NAME", 41, ObjectScript_System_function, 3},
+  {"$NCONVERT", "$NCONVERT", 42, ObjectScript_System_function, 9},
+  {"$NC", "$NCONVERT", 42, ObjectScript_System_function, 3},
+  {"$NORMALIZE", "$NORMALIZE", 43, ObjectScript_System_function, 10},
+  {"$NOW", "$NOW", 44, ObjectScript_System_function, 4},
+  {"$NUMBER", "$NUMBER", 45, ObjectScript_System_function, 7},
+  {"$NUM", "$NUMBER", 45, ObjectScript_System_function, 4},
+  {"$ORDER", "$ORDER", 46, ObjectScript_System_function, 6},
+  {"$O", "$ORDER", 46, ObjectScript_System_function, 2},
+  {"$PARAMETER", "$PARAMETER", 47, ObjectScript_System_function, 10},
+  {"$PIECE", "$PIECE", 48, ObjectScript_System_function, 6},
+  {"$P", "$PIECE", 48, ObjectScript_System_function, 2},
+  {"$PREFETCHOFF", "$PREFETCHOFF", 49, ObjectScript_System_function, 12},
+  {"$PREFETCHON", "$PREFETCHON", 50, ObjectScript_System_function, 11},
+  {"$PREPROCESS", "$PREPROCESS", 51, ObjectScript_System_function, 11},
+  {"$PROPERTY", "$PROPERTY", 52, ObjectScript_System_function, 9},
+  {"$QLENGTH", "$QLENGTH", 53, ObjectScript_System_function, 8},
+  {"$QL", "$QLENGTH", 53, ObjectScript_System_function, 3},
+  {"$QSUBSCRIPT", "$QSUBSCRIPT", 54, ObjectScript_System_function, 11},
+  {"$QS", "$QSUBSCRIPT", 54, ObjectScript_System_function, 3},
+  {"$QUERY", "$QUERY", 55, ObjectScript_System_function, 6},
+  {"$Q", "$QUERY", 55, ObjectScript_System_function, 2},
+  {"$RANDOM", "$RANDOM", 56, ObjectScript_System_function, 7},
+  {"$R", "$RANDOM", 56, ObjectScript_System_function, 2},
+  {"$REPLACE", "$REPLACE", 57, ObjectScript_System_function, 8},
+  {"$REVERSE", "$REVERSE", 58, ObjectScript_System_function, 8},
+  {"$RE", "$REVERSE", 58, ObjectScript_System_function, 3},
+  {"$SCONVERT", "$SCONVERT", 59, ObjectScript_System_function, 9},
+  {"$SC", "$SCONVERT", 59, ObjectScript_System_function, 3},
+  {"$SELECT", "$SELECT", 60, ObjectScript_System_function, 7},
+  {"$S", "$SELECT", 60, ObjectScript_System_function, 2},
+  {"$SEQUENCE", "$SEQUENCE", 61, ObjectScript_System_function, 9},
+  {"$SEQ", "$SEQUENCE", 61, ObjectScript_System_function, 4},
+  {"$SORTBEGIN", "$SORTBEGIN", 62, ObjectScript_System_function, 10},
+  {"$SORTEND", "$SORTEND", 63, ObjectScript_System_function, 8},
+  {"$STACK", "$STACK", 64, ObjectScript_System_function, 6},
+  {"$ST", "$STACK", 64, ObjectScript_System_function, 3},
+  {"$TEXT", "$TEXT", 65, ObjectScript_System_function, 5},
+  {"$T", "$TEXT", 65, ObjectScript_System_function, 2},
+  {"$TRANSLATE", "$TRANSLATE", 66, ObjectScript_System_function, 10},
+  {"$TR", "$TRANSLATE", 66, ObjectScript_System_function, 3},
+  {"$VECTOR", "$VECTOR", 67, ObjectScript_System_function, 7},
+  {"$VE", "$VECTOR", 67, ObjectScript_System_function, 3},
+  {"$VECTORDEFINED", "$VECTORDEFINED", 68, ObjectScript_System_function, 14},
+  {"$VD", "$VECTORDEFINED", 68, ObjectScript_System_function, 3},
+  {"$VECTOROP", "$VECTOROP", 69, ObjectScript_System_function, 9},
+  {"$VOP", "$VECTOROP", 69, ObjectScript_System_function, 4},
+  {"$VIEW", "$VIEW", 70, ObjectScript_System_function, 5},
+  {"$V", "$VIEW", 70, ObjectScript_System_function, 2},
+  {"$WASCII", "$WASCII", 71, ObjectScript_System_function, 7},
+  {"$WA", "$WASCII", 71, ObjectScript_System_function, 3},
+  {"$WCHAR", "$WCHAR", 72, ObjectScript_System_function, 6},
+  {"$WC", "$WCHAR", 72, ObjectScript_System_function, 3},
+  {"$WEXTRACT", "$WEXTRACT", 73, ObjectScript_System_function, 9},
+  {"$WE", "$WEXTRACT", 73, ObjectScript_System_function, 3},
+  {"$WFIND", "$WFIND", 74, ObjectScript_System_function, 6},
+  {"$WF", "$WFIND", 74, ObjectScript_System_function, 3},
+  {"$WISWIDE", "$WISWIDE", 75, ObjectScript_System_function, 8},
+  {"$WLENGTH", "$WLENGTH", 76, ObjectScript_System_function, 8},
+  {"$WL", "$WLENGTH", 76, ObjectScript_System_function, 3},
+  {"$WREVERSE", "$WREVERSE", 77, ObjectScript_System_function, 9},
+  {"$WRE", "$WREVERSE", 77, ObjectScript_System_function, 4},
+  {"$XECUTE", "$XECUTE", 78, ObjectScript_System_function, 7},
+  {"$ZABS", "$ZABS", 79, ObjectScript_System_function, 5},
+  {"$ZARCCOS", "$ZARCCOS", 80, ObjectScript_System_function, 8},
+  {"$ZARCSIN", "$ZARCSIN", 81, ObjectScript_System_function, 8},
+  {"$ZARCTAN", "$ZARCTAN", 82, ObjectScript_System_function, 8},
+  {"$ZBITAND", "$ZBITAND", 83, ObjectScript_System_function, 8},
+  {"$ZBITCOUNT", "$ZBITCOUNT", 84, ObjectScript_System_function, 10},
+  {"$ZBITFIND", "$ZBITFIND", 85, ObjectScript_System_function, 9},
+  {"$ZBITGET", "$ZBITGET", 86, ObjectScript_System_function, 8},
+  {"$ZBITLEN", "$ZBITLEN", 87, ObjectScript_System_function, 8},
+  {"$ZBITNOT", "$ZBITNOT", 88, ObjectScript_System_function, 8},
+  {"$ZBITOR", "$ZBITOR", 89, ObjectScript_System_function, 7},
+  {"$ZBITSET", "$ZBITSET", 90, ObjectScript_System_function, 8},
+  {"$ZBITSTR", "$ZBITSTR", 91, ObjectScript_System_function, 8},
+  {"$ZBITXOR", "$ZBITXOR", 92, ObjectScript_System_function, 8},
+  {"$ZBOOLEAN", "$ZBOOLEAN", 93, ObjectScript_System_function, 9},
+  {"$ZB", "$ZBOOLEAN", 93, ObjectScript_System_function, 3},
+  {"$ZCONVERT", "$ZCONVERT", 94, ObjectScript_System_function, 9},
+  {"$ZCVT", "$ZCONVERT", 94, ObjectScript_System_function, 5},
+  {"$ZCOS", "$ZCOS", 95, ObjectScript_System_function, 5},
+  {"$ZCOT", "$ZCOT", 96, ObjectScript_System_function, 5},
+  {"$ZCRC", "$ZCRC", 97, ObjectScript_System_function, 5},
+  {"$ZCSC", "$ZCSC", 98, ObjectScript_System_function, 5},
+  {"$ZCYC", "$ZCYC", 99, ObjectScript_System_function, 5},
+  {"$ZC", "$ZCYC", 99, ObjectScript_System_function, 3},
+  {"$ZDASCII", "$ZDASCII", 100, ObjectScript_System_function, 8},
+  {"$ZDA", "$ZDASCII", 100, ObjectScript_System_function, 4},
+  {"$ZDATE", "$ZDATE", 101, ObjectScript_System_function, 6},
+  {"$ZD", "$ZDATE", 101, ObjectScript_System_function, 3},
+  {"$ZDATEH", "$ZDATEH", 102, ObjectScript_System_function, 7},
+  {"$ZDH", "$ZDATEH", 102, ObjectScript_System_function, 4},
+  {"$ZDATETIME", "$ZDATETIME", 103, ObjectScript_System_function, 10},
+  {"$ZDT", "$ZDATETIME", 103, ObjectScript_System_function, 4},
+  {"$ZDATETIMEH", "$ZDATETIMEH", 104, ObjectScript_System_function, 11},
+  {"$ZDTH", "$ZDATETIMEH", 104, ObjectScript_System_function, 5},
+  {"$ZDCHAR", "$ZDCHAR", 105, ObjectScript_System_function, 7},
+  {"$ZDC", "$ZDCHAR", 105, ObjectScript_System_function, 4},
+  {"$ZEXP", "$ZEXP", 106, ObjectScript_System_function, 5},
+  {"$ZF", "$ZF", 107, ObjectScript_System_function, 3},
+  {"$ZHEX", "$ZHEX", 108, ObjectScript_System_function, 5},
+  {"$ZH", "$ZHEX", 108, ObjectScript_System_function, 3},
+  {"$ZISWIDE", "$ZISWIDE", 109, ObjectScript_System_function, 8},
+  {"$ZLASCII", "$ZLASCII", 110, ObjectScript_System_function, 8},
+  {"$ZLA", "$ZLASCII", 110, ObjectScript_System_function, 4},
+  {"$ZLCHAR", "$ZLCHAR", 111, ObjectScript_System_function, 7},
+  {"$ZLC", "$ZLCHAR", 111, ObjectScript_System_function, 4},
+  {"$ZLN", "$ZLN", 112, ObjectScript_System_function, 4},
+  {"$ZLOG", "$ZLOG", 113, ObjectScript_System_function, 5},
+  {"$ZNAME", "$ZNAME", 114, ObjectScript_System_function, 6},
+  {"$ZOBJCLASS", "$ZOBJCLASS", 115, ObjectScript_System_function, 10},
+  {"$ZOBJCLASSMETHOD", "$ZOBJCLASSMETHOD", 116, ObjectScript_System_function, 16},
+  {"$ZOBJMETHOD", "$ZOBJMETHOD", 117, ObjectScript_System_function, 11},
+  {"$ZOBJPROPERTY", "$ZOBJPROPERTY", 118, ObjectScript_System_function, 13},
+  {"$ZPOSITION", "$ZPOSITION", 119, ObjectScript_System_function, 10},
+  {"$ZPOWER", "$ZPOWER", 120, ObjectScript_System_function, 7},
+  {"$ZQASCII", "$ZQASCII", 121, ObjectScript_System_function, 8},
+  {"$ZQA", "$ZQASCII", 121, ObjectScript_System_function, 4},
+  {"$ZQCHAR", "$ZQCHAR", 122, ObjectScript_System_function, 7},
+  {"$ZQC", "$ZQCHAR", 122, ObjectScript_System_function, 4},
+  {"$ZSEARCH", "$ZSEARCH", 123, ObjectScript_System_function, 8},
+  {"$ZSE", "$ZSEARCH", 123, ObjectScript_System_function, 4},
+  {"$ZSEC", "$ZSEC", 124, ObjectScript_System_function, 5},
+  {"$ZSEEK", "$ZSEEK", 125, ObjectScript_System_function, 6},
+  {"$ZSIN", "$ZSIN", 126, ObjectScript_System_function, 5},
+  {"$ZSQR", "$ZSQR", 127, ObjectScript_System_function, 5},
+  {"$ZSTRIP", "$ZSTRIP", 128, ObjectScript_System_function, 7},
+  {"$ZTAN", "$ZTAN", 129, ObjectScript_System_function, 5},
+  {"$ZTIME", "$ZTIME", 130, ObjectScript_System_function, 6},
+  {"$ZT", "$ZTIME", 130, ObjectScript_System_function, 3},
+  {"$ZTIMEH", "$ZTIMEH", 131, ObjectScript_System_function, 7},
+  {"$ZTH", "$ZTIMEH", 131, ObjectScript_System_function, 4},
+  {"$ZUTIL", "$ZUTIL", 132, ObjectScript_System_function, 6},
+  {"$ZU", "$ZUTIL", 132, ObjectScript_System_function, 3},
+  {"$ZVERSION", "$ZVERSION", 133, ObjectScript_System_function, 9},
+  {"$ZV", "$ZVERSION", 133, ObjectScript_System_function, 3},
+  {"$ZWASCII", "$ZWASCII", 134, ObjectScript_System_function, 8},
+  {"$ZWA", "$ZWASCII", 134, ObjectScript_System_function, 4},
+  {"$ZWBPACK", "$ZWBPACK", 135, ObjectScript_System_function, 8},
+  {"$ZWBUNPACK", "$ZWBUNPACK", 136, ObjectScript_System_function, 10},
+  {"$ZWCHAR", "$ZWCHAR", 137, ObjectScript_System_function, 7},
+  {"$ZWC", "$ZWCHAR", 137, ObjectScript_System_function, 4},
+  {"$ZWIDTH", "$ZWIDTH", 138, ObjectScript_System_function, 7},
+  {"$ZWPACK", "$ZWPACK", 139, ObjectScript_System_function, 7},
+  {"$ZWUNPACK", "$ZWUNPACK", 140, ObjectScript_System_function, 9},
+  {"$ZZENKAKU", "$ZZENKAKU", 141, ObjectScript_System_function, 9},
+  {"$DEVICE", "$DEVICE", 142, ObjectScript_System_variable, 7},
+  {"$D", "$DEVICE", 142, ObjectScript_System_variable, 2},
+  {"$ECODE", "$ECODE", 143, ObjectScript_System_variable, 6},
+  {"$EC", "$ECODE", 143, ObjectScript_System_variable, 3},
+  {"$ESTACK", "$ESTACK", 144, ObjectScript_System_variable, 7},
+  {"$ES", "$ESTACK", 144, ObjectScript_System_variable, 3},
+  {"$ETRAP", "$ETRAP", 145, ObjectScript_System_variable, 6},
+  {"$ET", "$ETRAP", 145, ObjectScript_System_variable, 3},
+  {"$HALT", "$HALT", 146, ObjectScript_System_variable, 5},
+  {"$HOROLOG", "$HOROLOG", 147, ObjectScript_System_variable, 8},
+  {"$H", "$HOROLOG", 147, ObjectScript_System_variable, 2},
+  {"$IO", "$IO", 148, ObjectScript_System_variable, 3},
+  {"$I", "$IO", 148, ObjectScript_System_variable, 2},
+  {"$JOB", "$JOB", 149, ObjectScript_System_variable, 4},
+  {"$J", "$JOB", 149, ObjectScript_System_variable, 2},
+  {"$KEY", "$KEY", 150, ObjectScript_System_variable, 4},
+  {"$K", "$KEY", 150, ObjectScript_System_variable, 2},
+  {"$NAMESPACE", "$NAMESPACE", 151, ObjectScript_System_variable, 10},
+  {"$PRINCIPAL", "$PRINCIPAL", 152, ObjectScript_System_variable, 10},
+  {"$P", "$PRINCIPAL", 152, ObjectScript_System_variable, 2},
+  {"$QUIT", "$QUIT", 153, ObjectScript_System_variable, 5},
+  {"$Q", "$QUIT", 153, ObjectScript_System_variable, 2},
+  {"$ROLES", "$ROLES", 154, ObjectScript_System_variable, 6},
+  {"$STACK", "$STACK", 155, ObjectScript_System_variable, 6},
+  {"$ST", "$STACK", 155, ObjectScript_System_variable, 3},
+  {"$STORAGE", "$STORAGE", 156, ObjectScript_System_variable, 8},
+  {"$S", "$STORAGE", 156, ObjectScript_System_variable, 2},
+  {"$SYSTEM", "$SYSTEM", 157, ObjectScript_System_variable, 7},
+  {"$SY", "$SYSTEM", 157, ObjectScript_System_variable, 3},
+  {"$TEST", "$TEST", 158, ObjectScript_System_variable, 5},
+  {"$T", "$TEST", 158, ObjectScript_System_variable, 2},
+  {"$THIS", "$THIS", 159, ObjectScript_System_variable, 5},
+  {"$THROWOBJ", "$THROWOBJ", 160, ObjectScript_System_variable, 9},
+  {"$TLEVEL", "$TLEVEL", 161, ObjectScript_System_variable, 7},
+  {"$TL", "$TLEVEL", 161, ObjectScript_System_variable, 3},
+  {"$USERNAME", "$USERNAME", 162, ObjectScript_System_variable, 9},
+  {"$X", "$X", 163, ObjectScript_System_variable, 2},
+  {"$Y", "$Y", 164, ObjectScript_System_variable, 2},
+  {"$ZA", "$ZA", 165, ObjectScript_System_variable, 3},
+  {"$ZB", "$ZB", 166, ObjectScript_System_variable, 3},
+  {"$ZCHILD", "$ZCHILD", 167, ObjectScript_System_variable, 7},
+  {"$ZC", "$ZCHILD", 167, ObjectScript_System_variable, 3},
+  {"$ZEOF", "$ZEOF", 168, ObjectScript_System_variable, 5},
+  {"$ZEOS", "$ZEOS", 169, ObjectScript_System_variable, 5},
+  {"$ZERROR", "$ZERROR", 170, ObjectScript_System_variable, 7},
+  {"$ZE", "$ZERROR", 170, ObjectScript_System_variable, 3},
+  {"$ZHOROLOG", "$ZHOROLOG", 171, ObjectScript_System_variable, 9},
+  {"$ZH", "$ZHOROLOG", 171, ObjectScript_System_variable, 3},
+  {"$ZIO", "$ZIO", 172, ObjectScript_System_variable, 4},
+  {"$ZI", "$ZIO", 172, ObjectScript_System_variable, 3},
+  {"$ZJOB", "$ZJOB", 173, ObjectScript_System_variable, 5},
+  {"$ZJ", "$ZJOB", 173, ObjectScript_System_variable, 3},
+  {"$ZMODE", "$ZMODE", 174, ObjectScript_System_variable, 6},
+  {"$ZM", "$ZMODE", 174, ObjectScript_System_variable, 3},
+  {"$ZNAME", "$ZNAME", 175, ObjectScript_System_variable, 6},
+  {"$ZN", "$ZNAME", 175, ObjectScript_System_variable, 3},
+  {"$ZNSPACE", "$ZNSPACE", 176, ObjectScript_System_variable, 8},
+  {"$ZORDER", "$ZORDER", 177, ObjectScript_System_variable, 7},
+  {"$ZO", "$ZORDER", 177, ObjectScript_System_variable, 3},
+  {"$ZPARENT", "$ZPARENT", 178, ObjectScript_System_variable, 8},
+  {"$ZP", "$ZPARENT", 178, ObjectScript_System_variable, 3},
+  {"$ZPI", "$ZPI", 179, ObjectScript_System_variable, 4},
+  {"$ZPOSITION", "$ZPOSITION", 180, ObjectScript_System_variable, 10},
+  {"$ZPOS", "$ZPOSITION", 180, ObjectScript_System_variable, 5},
+  {"$ZREFERENCE", "$ZREFERENCE", 181, ObjectScript_System_variable, 11},
+  {"$ZR", "$ZREFERENCE", 181, ObjectScript_System_variable, 3},
+  {"$ZSTORAGE", "$ZSTORAGE", 182, ObjectScript_System_variable, 9},
+  {"$ZS", "$ZSTORAGE", 182, ObjectScript_System_variable, 3},
+  {"$ZTIMESTAMP", "$ZTIMESTAMP", 183, ObjectScript_System_variable, 11},
+  {"$ZTS", "$ZTIMESTAMP", 183, ObjectScript_System_variable, 4},
+  {"$ZTIMEZONE", "$ZTIMEZONE", 184, ObjectScript_System_variable, 10},
+  {"$ZTZ", "$ZTIMEZONE", 184, ObjectScript_System_variable, 4},
+  {"$ZTRAP", "$ZTRAP", 185, ObjectScript_System_variable, 6},
+  {"$ZT", "$ZTRAP", 185, ObjectScript_System_variable, 3},
+  {"$ZVERSION", "$ZVERSION", 186, ObjectScript_System_variable, 9},
+  {"$ZV", "$ZVERSION", 186, ObjectScript_System_variable, 3},
+};
+
+static const uint16_t system_name_seeds[SYSTEM_NAME_BUCKET_COUNT] = {
+  8, 5, 8, 2, 17, 2, 4, 2, 6, 5, 3, 3,
+  1, 3, 13, 2, 4, 1, 5, 3, 4, 1, 4, 7,
+  5, 2, 3, 0, 1, 17, 6, 13, 3, 4, 1, 1,
+  1, 5, 38, 5, 3, 1, 12, 3, 2, 1, 4, 5,
+  6, 2, 11, 6, 5, 1, 2, 6, 3, 1, 6, 9,
+  2, 1, 3, 1, 8, 3, 2, 3, 13, 1, 6, 5,
+};
+
+// Index into system_names + 1, 0 for an empty slot
+static const uint16_t system_name_slots[SYSTEM_NAME_SLOT_COUNT] = {
+  61, 46, 0, 0, 0, 167, 0, 0, 208, 53, 0, 0,
+  0, 215, 3, 58, 229, 0, 0, 286, 26, 162, 263, 195,
+  238, 218, 112, 221, 0, 0, 0, 2, 258, 0, 196, 0,
+  0, 0, 0, 0, 0, 0, 43, 0, 157, 115, 23, 210,
+  272, 0, 123, 89, 0, 130, 63, 0, 191, 0, 0, 0,
+  0, 0, 4, 0, 226, 270, 248, 77, 0, 277, 0, 118,
+  160, 0, 0, 211, 0, 14, 259, 154, 0, 159, 39, 0,
+  51, 216, 0, 271, 0, 233, 0, 56, 0, 140, 198, 0,
+  173, 163, 0, 0, 241, 142, 0, 55, 72, 47, 156, 29,
+  15, 122, 169, 0, 0, 0, 0, 192, 0, 110, 0, 0,
+  179, 0, 42, 280, 164, 0, 161, 132, 177, 124, 0, 166,
+  0, 0, 59, 152, 0, 20, 0, 49, 0, 22, 0, 136,
+  247, 0, 0, 138, 0, 0, 194, 0, 92, 0, 0, 0,
+  28, 101, 214, 261, 96, 0, 114, 119, 116, 86, 69, 150,
+  18, 0, 0, 155, 65, 0, 0, 0, 0, 0, 25, 0,
+  137, 183, 0, 0, 0, 66, 0, 0, 9, 0, 182, 0,
+  145, 0, 228, 0, 243, 0, 45, 73, 146, 225, 0, 256,
+  0, 1, 242, 237, 245, 0, 203, 0, 0, 0, 0, 0,
+  0, 222, 0, 74, 0, 165, 189, 8, 0, 0, 0, 0,
+  253, 0, 98, 0, 0, 0, 0, 250, 0, 17, 0, 37,
+  0, 40, 0, 0, 0, 0, 0, 200, 0, 144, 254, 0,
+  262, 0, 287, 212, 0, 75, 127, 185, 0, 64, 201, 0,
+  264, 34, 0, 0, 139, 38, 0, 113, 0, 197, 143, 0,
+  0, 0, 0, 104, 6, 252, 71, 0, 128, 0, 227, 50,
+  0, 48, 0, 0, 172, 0, 0, 81, 0, 0, 0, 251,
+  95, 187, 0, 0, 220, 0, 184, 219, 78, 0, 147, 175,
+  108, 269, 0, 236, 85, 217, 0, 207, 0, 30, 31, 0,
+  0, 281, 83, 131, 0, 176, 27, 204, 0, 0, 0, 0,
+  260, 186, 32, 0, 82, 0, 205, 0, 0, 0, 209, 0,
+  282, 0, 0, 0, 102, 213, 206, 0, 120, 170, 129, 0,
+  0, 135, 134, 0, 273, 148, 246, 158, 0, 88, 0, 36,
+  0, 0, 181, 0, 105, 279, 0, 168, 174, 180, 239, 99,
+  79, 244, 109, 235, 240, 94, 10, 0, 0, 0, 234, 0,
+  0, 0, 0, 76, 0, 0, 0, 84, 93, 0, 0, 0,
+  230, 68, 178, 141, 199, 0, 0, 121, 267, 5, 275, 0,
+  0, 0, 151, 103, 24, 12, 274, 0, 153, 0, 0, 0,
+  276, 0, 126, 283, 62, 87, 91, 7, 0, 232, 149, 0,
+  284, 231, 0, 0, 0, 0, 285, 0, 0, 0, 0, 0,
+  107, 97, 0, 202, 100, 13, 90, 266, 278, 188, 0, 0,
+  21, 257, 0, 190, 224, 35, 52, 0, 193, 249, 0, 0,
+  171, 133, 80, 60, 125, 111, 0, 255, 19, 0, 0, 106,
+  0, 0, 33, 57, 265, 0, 268, 0, 67, 117, 0, 44,
+  54, 223, 0, 0, 41, 16, 70, 11,
+};
+
+#endif // OBJECTSCRIPT_SYSTEM_NAMES_TABLE_H_
@@ -0,0 +1,493 @@
+#define _POSIX_C_SOURCE 200809L
+#include "tree_cache.h"
+#include <errno.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+// File layout, all integers little endian:
+//
+//   "OSTC" u32 format, u64 grammar hash, u64 check hash,
+//   u32 text length, u32 node count, u32 payload length, payload
+//
+// The payload holds every node in pre-order as varints: symbol, field id
+// and flags, child count, then the start byte and row as (zigzag) deltas
+// from the previous node, the start column, and the end byte and row as
+// deltas from the start, the end column.  Most of those fit in one byte.
+#define TREE_CACHE_MAGIC "OSTC"
+#define TREE_CACHE_FORMAT 1
+#define TREE_CACHE_HEADER_SIZE 36
+#define TREE_CACHE_FLAG_BITS 4
+
+struct ObjectScript_Tree_Cache {
+  char *directory;
+  const TSLanguage *language;
+  uint64_t grammar_hash;
+  struct ObjectScript_Tree_Cache_Stats stats;
+};
+
+struct ObjectScript_Cached_Tree {
+  const TSLanguage *language;
+  struct ObjectScript_Cached_Node *nodes;
+  uint32_t node_count;
+};
+
+struct Tree_Cache_Buffer {
+  uint8_t *data;
+  size_t length;
+  size_t capacity;
+};
+
+static uint64_t fnv1a(uint64_t hash, const void *data, size_t length) {
+  const unsigned char *bytes = (const unsigned char *)data;
+  for (size_t i = 0; i < length; i++) {
+    hash ^= bytes[i];
+    hash *= 0x100000001b3ULL;
+  }
+  return hash;
+}
+
+// The file name; seeded with the grammar so a new grammar misses
+static uint64_t key_hash(const struct ObjectScript_Tree_Cache *cache, const char *text,
+                         uint32_t length) {
+  return fnv1a(0xcbf29ce484222325ULL ^ cache->grammar_hash, text, length);
+}
+
+// Stored in the file, guards against the (unlikely) key collision
+static uint64_t check_hash(const char *text, uint32_t length) {
+  return fnv1a(0x84222325cbf29ce4ULL, text, length);
+}
+
+static bool buffer_reserve(struct Tree_Cache_Buffer *buffer, size_t extra) {
+  if (buffer->length + extra <= buffer->capacity) return true;
+  size_t capacity = buffer->capacity ? buffer->capacity : 4096;
+  while (capacity < buffer->length + extra) capacity *= 2;
+  uint8_t *data = (uint8_t *)realloc(buffer->data, capacity);
+  if (!data) return false;
+  buffer->data = data;
+  buffer->capacity = capacity;
+  return true;
+}
+
+static bool write_varint(struct Tree_Cache_Buffer *buffer, uint64_t value) {
+  if (!buffer_reserve(buffer, 10)) return false;
+  while (value >= 0x80) {
+    buffer->data[buffer->length++] = (uint8_t)(value | 0x80);
+    value >>= 7;
+  }
+  buffer->data[buffer->length++] = (uint8_t)value;
+  return true;
+}
+
+static bool write_zigzag(struct Tree_Cache_Buffer *buffer, int64_t value) {
+  return write_varint(buffer, ((uint64_t)value << 1) ^ (uint64_t)(value >> 63));
+}
+
+static bool read_varint(const uint8_t **cursor, const uint8_t *end, uint64_t *value) {
+  uint64_t result = 0;
+  for (unsigned shift = 0; shift < 64; shift += 7) {
+    if (*cursor == end) return false;
+    uint8_t byte = *(*cursor)++;
+    result |= (uint64_t)(byte & 0x7f) << shift;
+    if (!(byte & 0x80)) {
+      *value = result;
+      return true;
+    }
+  }
+  return false;
+}
+
+static bool read_zigzag(const uint8_t **cursor, const uint8_t *end, int64_t *value) {
+  uint64_t raw;
+  if (!read_varint(cursor, end, &raw)) return false;
+  *value = (int64_t)(raw >> 1) ^ -(int64_t)(raw & 1);
+  return true;
+}
+
+static void put_u32(uint8_t *out, uint32_t value) {
+  for (int i = 0; i < 4; i++) out[i] = (uint8_t)(value >> (8 * i));
+}
+
+static void put_u64(uint8_t *out, uint64_t value) {
+  for (int i = 0; i < 8; i++) out[i] = (uint8_t)(value >> (8 * i));
+}
+
+static uint32_t get_u32(const uint8_t *in) {
+  uint32_t value = 0;
+  for (int i = 0; i < 4; i++) value |= (uint32_t)in[i] << (8 * i);
+  return value;
+}
+
+static uint64_t get_u64(const uint8_t *in) {
+  uint64_t value = 0;
+  for (int i = 0; i < 8; i++) value |= (uint64_t)in[i] << (8 * i);
+  return value;
+}
+
+static char *entry_path(const struct ObjectScript_Tree_Cache *cache, uint64_t hash,
+                        bool create_directory) {
+  size_t length = strlen(cache->directory) + 32;
+  char *path = (char *)malloc(length);
+  if (!path) return NULL;
+
+  // Fan out over 256 sub directories, 40k files in one is slow on some systems
+  snprintf(path, length, "%s/%02x", cache->directory, (unsigned)(hash >> 56));
+  if (create_directory && mkdir(path, 0777) != 0 && errno != EEXIST) {
+    free(path);
+    return NULL;
+  }
+  snprintf(path, length, "%s/%02x/%014llx.tree", cache->directory,
+           (unsigned)(hash >> 56), (unsigned long long)(hash & 0x00ffffffffffffffULL));
+  return path;
+}
+
+// mkdir -p
+static bool make_directories(const char *directory) {
+  char *path = strdup(directory);
+  if (!path) return false;
+  bool ok = true;
+  for (char *slash = path + 1; ok && *slash; slash++) {
+    if (*slash != '/') continue;
+    *slash = '\0';
+    ok = mkdir(path, 0777) == 0 || errno == EEXIST;
+    *slash = '/';
+  }
+  ok = ok && (mkdir(path, 0777) == 0 || errno == EEXIST);
+  free(path);
+  return ok;
+}
+
+// The grammar part of every key: the format, the ABI version and parse
+// table size, the name and kind of every symbol and the field names, so a
+// regenerated grammar with renamed, reordered or re-aliased rules gets keys
+// of its own.  None of that changes with an external scanner, which is why
+// the caller's version string is required as well.
+static uint64_t grammar_hash(const TSLanguage *language, const char *grammar_version) {
+  uint32_t identity[5] = {
+    TREE_CACHE_FORMAT,
+    ts_language_version(language),
+    ts_language_state_count(language),
+    ts_language_symbol_count(language),
+    ts_language_field_count(language),
+  };
+  uint64_t hash = fnv1a(0xcbf29ce484222325ULL, identity, sizeof(identity));
+
+  for (uint32_t symbol = 0; symbol < identity[3]; symbol++) {
+    const char *name = ts_language_symbol_name(language, (TSSymbol)symbol);
+    uint8_t type = (uint8_t)ts_language_symbol_type(language, (TSSymbol)symbol);
+    if (name) hash = fnv1a(hash, name, strlen(name) + 1);
+    hash = fnv1a(hash, &type, 1);
+  }
+  for (uint32_t field = 1; field <= identity[4]; field++) {
+    const char *name = ts_language_field_name_for_id(language, (TSFieldId)field);
+    if (name) hash = fnv1a(hash, name, strlen(name) + 1);
+  }
+
+  // The version from tree-sitter.json, if the parser has it (ABI 15)
+  const TSLanguageMetadata *metadata = ts_language_metadata(language);
+  if (metadata) {
+    uint8_t version[3] = {metadata->major_version, metadata->minor_version,
+                          metadata->patch_version};
+    hash = fnv1a(hash, version, sizeof(version));
+  }
+  return fnv1a(hash, grammar_version, strlen(grammar_version));
+}
+
+struct ObjectScript_Tree_Cache *ObjectScript_Tree_Cache_new(
+    const char *directory, const TSLanguage *language, const char *grammar_version) {
+  if (!grammar_version || !*grammar_version) return NULL;
+  if (!*directory || !make_directories(directory)) return NULL;
+
+  struct ObjectScript_Tree_Cache *cache =
+      (struct ObjectScript_Tree_Cache *)calloc(1, sizeof(struct ObjectScript_Tree_Cache));
+  if (!cache) return NULL;
+  cache->directory = strdup(directory);
+  if (!cache->directory) {
+    free(cache);
+    return NULL;
+  }
+  cache->language = language;
+  cache->grammar_hash = grammar_hash(language, grammar_version);
+  return cache;
+}
+
+void ObjectScript_Tree_Cache_delete(struct ObjectScript_Tree_Cache *cache) {
+  if (!cache) return;
+  free(cache->directory);
+  free(cache);
+}
+
+void ObjectScript_Tree_Cache_stats(const struct ObjectScript_Tree_Cache *cache,
+                                   struct ObjectScript_Tree_Cache_Stats *stats) {
+  *stats = cache->stats;
+}
+
+static bool encode_tree(const TSTree *tree, struct Tree_Cache_Buffer *payload,
+                        uint32_t *node_count) {
+  TSTreeCursor cursor = ts_tree_cursor_new(ts_tree_root_node(tree));
+  uint32_t previous_byte = 0, previous_row = 0;
+  bool ok = true;
+  *node_count = 0;
+
+  for (;;) {
+    TSNode node = ts_tree_cursor_current_node(&cursor);
+    uint32_t start_byte = ts_node_start_byte(node);
+    TSPoint start = ts_node_start_point(node);
+    TSPoint end = ts_node_end_point(node);
+    uint8_t flags = (ts_node_is_named(node) ? ObjectScript_Cached_Node_named : 0) |
+                    (ts_node_is_extra(node) ? ObjectScript_Cached_Node_extra : 0) |
+                    (ts_node_is_missing(node) ? ObjectScript_Cached_Node_missing : 0) |
+                    (ts_node_is_error(node) ? ObjectScript_Cached_Node_error : 0);
+    TSFieldId field_id = ts_tree_cursor_current_field_id(&cursor);
+
+    ok = write_varint(payload, ts_node_symbol(node)) &&
+         write_varint(payload, ((uint64_t)field_id << TREE_CACHE_FLAG_BITS) | flags) &&
+         write_varint(payload, ts_node_child_count(node)) &&
+         write_zigzag(payload, (int64_t)start_byte - previous_byte) &&
+         write_zigzag(payload, (int64_t)start.row - previous_row) &&
+         write_varint(payload, start.column) &&
+         write_varint(payload, ts_node_end_byte(node) - start_byte) &&
+         write_varint(payload, end.row - start.row) &&
+         write_varint(payload, end.column);
+    if (!ok) break;
+    previous_byte = start_byte;
+    previous_row = start.row;
+    (*node_count)++;
+
+    if (ts_tree_cursor_goto_first_child(&cursor)) continue;
+    bool done = false;
+    while (!ts_tree_cursor_goto_next_sibling(&cursor)) {
+      if (!ts_tree_cursor_goto_parent(&cursor)) {
+        done = true;
+        break;
+      }
+    }
+    if (done) break;
+  }
+  ts_tree_cursor_delete(&cursor);
+  return ok;
+}
+
+struct Tree_Cache_Frame {
+  uint32_t index;
+  uint32_t remaining;
+  uint32_t last_child;
+};
+
+// Rebuild the node array, with parent/sibling links, from a payload
+static struct ObjectScript_Cached_Tree *decode_tree(const TSLanguage *language,
+                                                    const uint8_t *cursor, const uint8_t *end,
+                                                    uint32_t node_count) {
+  // Every node takes at least 9 bytes, reject counts the payload can't hold
+  if (node_count == 0 || node_count > (size_t)(end - cursor) / 9) return NULL;
+
+  struct ObjectScript_Cached_Tree *tree =
+      (struct ObjectScript_Cached_Tree *)calloc(1, sizeof(struct ObjectScript_Cached_Tree));
+  struct ObjectScript_Cached_Node *nodes = (struct ObjectScript_Cached_Node *)malloc(
+      node_count * sizeof(struct ObjectScript_Cached_Node));
+  struct Tree_Cache_Frame *stack = NULL;
+  uint32_t depth = 0, stack_capacity = 0;
+  uint64_t previous_byte = 0, previous_row = 0;
+  if (!tree || !nodes) goto fail;
+
+  for (uint32_t i = 0; i < node_count; i++) {
+    struct ObjectScript_Cached_Node *node = &nodes[i];
+    uint64_t symbol, field_flags, child_count, start_column, length, rows, end_column;
+    int64_t byte_delta, row_delta;
+    if (!read_varint(&cursor, end, &symbol) || !read_varint(&cursor, end, &field_flags) ||
+        !read_varint(&cursor, end, &child_count) ||
+        !read_zigzag(&cursor, end, &byte_delta) || !read_zigzag(&cursor, end, &row_delta) ||
+        !read_varint(&cursor, end, &start_column) || !read_varint(&cursor, end, &length) ||
+        !read_varint(&cursor, end, &rows) || !read_varint(&cursor, end, &end_column)) {
+      goto fail;
+    }
+    previous_byte += byte_delta;
+    previous_row += row_delta;
+
+    node->symbol = (TSSymbol)symbol;
+    node->field_id = (TSFieldId)(field_flags >> TREE_CACHE_FLAG_BITS);
+    node->flags = (uint8_t)(field_flags & ((1 << TREE_CACHE_FLAG_BITS) - 1));
+    node->start_byte = (uint32_t)previous_byte;
+    node->end_byte = (uint32_t)(previous_byte + length);
+    node->start_point = (TSPoint){(uint32_t)previous_row, (uint32_t)start_column};
+    node->end_point = (TSPoint){(uint32_t)(previous_row + rows), (uint32_t)end_column};
+    node->child_count = (uint32_t)child_count;
+    node->next_sibling = OBJECTSCRIPT_CACHED_NODE_NONE;
+    node->parent = OBJECTSCRIPT_CACHED_NODE_NONE;
+
+    if (depth) {
+      struct Tree_Cache_Frame *frame = &stack[depth - 1];
+      node->parent = frame->index;
+      if (frame->last_child != OBJECTSCRIPT_CACHED_NODE_NONE) {
+        nodes[frame->last_child].next_sibling = i;
+      }
+      frame->last_child = i;
+      frame->remaining--;
+    } else if (i > 0) {
+      goto fail;   // A second root
+    }
+
+    if (child_count) {
+      if (child_count > node_count) goto fail;
+      if (depth == stack_capacity) {
+        stack_capacity = stack_capacity ? stack_capacity * 2 : 64;
+        struct Tree_Cache_Frame *grown = (struct Tree_Cache_Frame *)realloc(
+            stack, stack_capacity * sizeof(struct Tree_Cache_Frame));
+        if (!grown) goto fail;
+        stack = grown;
+      }
+      stack[depth++] = (struct Tree_Cache_Frame){i, (uint32_t)child_count,
+                                                 OBJECTSCRIPT_CACHED_NODE_NONE};
+    }
+    while (depth && stack[depth - 1].remaining == 0) depth--;
+  }
+  if (depth || cursor != end) goto fail;
+
+  free(stack);
+  tree->language = language;
+  tree->nodes = nodes;
+  tree->node_count = node_count;
+  return tree;
+
+fail:
+  free(stack);
+  free(nodes);
+  free(tree);
+  return NULL;
+}
+
+struct ObjectScript_Cached_Tree *ObjectScript_Tree_Cache_load(
+    struct ObjectScript_Tree_Cache *cache, const char *text, uint32_t length) {
+  char *path = entry_path(cache, key_hash(cache, text, length), false);
+  FILE *file = path ? fopen(path, "rb") : NULL;
+  free(path);
+  if (!file) {
+    cache->stats.misses++;
+    return NULL;
+  }
+
+  struct ObjectScript_Cached_Tree *tree = NULL;
+  uint8_t header[TREE_CACHE_HEADER_SIZE];
+  uint8_t *payload = NULL;
+  if (fread(header, 1, sizeof(header), file) != sizeof(header) ||
+      memcmp(header, TREE_CACHE_MAGIC, 4) != 0 || get_u32(header + 4) != TREE_CACHE_FORMAT ||
+      get_u64(header + 8) != cache->grammar_hash ||
+      get_u64(header + 16) != check_hash(text, length) || get_u32(header + 24) != length) {
+    goto done;
+  }
+  uint32_t node_count = get_u32(header + 28);
+  uint32_t payload_length = get_u32(header + 32);
+  payload = (uint8_t *)malloc(payload_length ? payload_length : 1);
+  if (!payload || fread(payload, 1, payload_length, file) != payload_length) goto done;
+
+  tree = decode_tree(cache->language, payload, payload + payload_length, node_count);
+  cache->stats.bytes_read += sizeof(header) + payload_length;
+
+done:
+  fclose(file);
+  free(payload);
+  if (tree) {
+    cache->stats.hits++;
+  } else {
+    cache->stats.misses++;
+  }
+  return tree;
+}
+
+bool ObjectScript_Tree_Cache_store(struct ObjectScript_Tree_Cache *cache,
+                                   const char *text, uint32_t length,
+                                   const TSTree *tree) {
+  struct Tree_Cache_Buffer payload = {0};
+  uint32_t node_count;
+  if (!encode_tree(tree, &payload, &node_count) || payload.length > UINT32_MAX) {
+    free(payload.data);
+    return false;
+  }
+
+  uint8_t header[TREE_CACHE_HEADER_SIZE];
+  memcpy(header, TREE_CACHE_MAGIC, 4);
+  put_u32(header + 4, TREE_CACHE_FORMAT);
+  put_u64(header + 8, cache->grammar_hash);
+  put_u64(header + 16, check_hash(text, length));
+  put_u32(header + 24, length);
+  put_u32(header + 28, node_count);
+  put_u32(header + 32, (uint32_t)payload.length);
+
+  // Write under a private name and rename, readers never see a partial file
+  bool ok = false;
+  char *path = entry_path(cache, key_hash(cache, text, length), true);
+  char *temporary = path ? (char *)malloc(strlen(path) + 32) : NULL;
+  if (temporary) {
+    sprintf(temporary, "%s.%ld.tmp", path, (long)getpid());
+    FILE *file = fopen(temporary, "wb");
+    if (file) {
+      ok = fwrite(header, 1, sizeof(header), file) == sizeof(header) &&
+           fwrite(payload.data, 1, payload.length, file) == payload.length;
+      ok = fclose(file) == 0 && ok;
+      ok = ok && rename(temporary, path) == 0;
+      if (!ok) remove(temporary);
+    }
+  }
+  if (ok) {
+    cache->stats.stores++;
+    cache->stats.bytes_written += sizeof(header) + payload.length;
+  }
+  free(temporary);
+  free(path);
+  free(payload.data);
+  return ok;
+}
+
+struct ObjectScript_Cached_Tree *ObjectScript_Tree_Cache_get(
+    struct ObjectScript_Tree_Cache *cache, TSParser *parser,
+    const char *text, uint32_t length) {
+  struct ObjectScript_Cached_Tree *cached = ObjectScript_Tree_Cache_load(cache, text, length);
+  if (cached) return cached;
+
+  TSTree *tree = ts_parser_parse_string(parser, NULL, text, length);
+  if (!tree) return NULL;
+  ObjectScript_Tree_Cache_store(cache, text, length, tree);
+  cached = ObjectScript_Cached_Tree_from_tree(tree);
+  ts_tree_delete(tree);
+  return cached;
+}
+
+struct ObjectScript_Cached_Tree *ObjectScript_Cached_Tree_from_tree(const TSTree *tree) {
+  struct Tree_Cache_Buffer payload = {0};
+  uint32_t node_count;
+  struct ObjectScript_Cached_Tree *cached = NULL;
+  if (encode_tree(tree, &payload, &node_count)) {
+    cached = decode_tree(ts_tree_language(tree), payload.data,
+                         payload.data + payload.length, node_count);
+  }
+  free(payload.data);
+  return cached;
+}
+
+void ObjectScript_Cached_Tree_delete(struct ObjectScript_Cached_Tree *tree) {
+  if (!tree) return;
+  free(tree->nodes);
+  free(tree);
+}
+
+uint32_t ObjectScript_Cached_Tree_node_count(const struct ObjectScript_Cached_Tree *tree) {
+  return tree->node_count;
+}
+
+const struct ObjectScript_Cached_Node *ObjectScript_Cached_Tree_nodes(
+    const struct ObjectScript_Cached_Tree *tree) {
+  return tree->nodes;
+}
+
+const char *ObjectScript_Cached_Tree_type(const struct ObjectScript_Cached_Tree *tree,
+                                          const struct ObjectScript_Cached_Node *node) {
+  return ts_language_symbol_name(tree->language, node->symbol);
+}
+
+const char *ObjectScript_Cached_Tree_field_name(const struct ObjectScript_Cached_Tree *tree,
+                                                const struct ObjectScript_Cached_Node *node) {
+  return node->field_id ? ts_language_field_name_for_id(tree->language, node->field_id)
+                        : NULL;
+}
@@ -0,0 +1,112 @@
+#ifndef OBJECTSCRIPT_TREE_CACHE_H_
+#define OBJECTSCRIPT_TREE_CACHE_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stddef.h>
+#include <tree_sitter/api.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Persistent, content-hash keyed cache of parse trees on disk.
+//
+// Batch consumers (CI linting, indexing) see the same sources over and over.
+// The cache stores a compact serialized form of each tree, node kinds,
+// fields, byte ranges and points, under a hash of the source text, so a run
+// over mostly unchanged files reads the trees back instead of parsing.
+//
+// Entries are keyed by the text and by the grammar: the language ABI
+// version, its parse table size, symbol names and kinds, field names and
+// metadata version, plus a caller supplied version string (e.g. the package
+// version, or a hash of the scanner sources) all go into the key, so a new
+// grammar never picks up stale trees.  Files are written to a temporary name and renamed,
+// so concurrent processes can share a directory.
+//
+// A loaded tree is a plain array of nodes in pre-order, not a TSTree, so it
+// can be walked but not queried with a TSQuery or edited.
+struct ObjectScript_Tree_Cache;
+
+struct ObjectScript_Tree_Cache_Stats {
+  uint64_t hits;            // Loads answered from disk
+  uint64_t misses;          // Loads that found no (valid) entry
+  uint64_t stores;          // Trees written
+  uint64_t bytes_read;      // Cache file bytes read
+  uint64_t bytes_written;   // Cache file bytes written
+};
+
+enum {
+  ObjectScript_Cached_Node_named   = 1 << 0,
+  ObjectScript_Cached_Node_extra   = 1 << 1,
+  ObjectScript_Cached_Node_missing = 1 << 2,
+  ObjectScript_Cached_Node_error   = 1 << 3,   // An ERROR node
+};
+
+#define OBJECTSCRIPT_CACHED_NODE_NONE UINT32_MAX
+
+struct ObjectScript_Cached_Node {
+  TSSymbol  symbol;         // As ts_node_symbol(), i.e. after aliasing
+  TSFieldId field_id;       // Field in the parent, 0 if none
+  uint8_t   flags;
+  uint32_t  start_byte;
+  uint32_t  end_byte;
+  TSPoint   start_point;
+  TSPoint   end_point;
+  uint32_t  parent;         // Indices into the tree, or ..._NONE
+  uint32_t  next_sibling;
+  uint32_t  child_count;    // The first child, if any, is at index + 1
+};
+
+struct ObjectScript_Cached_Tree;
+
+// `directory` (and its parents) is created if needed.  `grammar_version`
+// is required: a changed external scanner leaves the language tables as they
+// were, so only the caller can tell the cache apart.  Returns NULL if the
+// directory can't be created or the version is NULL or empty.
+struct ObjectScript_Tree_Cache *ObjectScript_Tree_Cache_new(
+    const char *directory, const TSLanguage *language, const char *grammar_version);
+void ObjectScript_Tree_Cache_delete(struct ObjectScript_Tree_Cache *cache);
+
+void ObjectScript_Tree_Cache_stats(const struct ObjectScript_Tree_Cache *cache,
+                                   struct ObjectScript_Tree_Cache_Stats *stats);
+
+// Return the cached tree for `text`, or NULL if there is none (or it was
+// written by another grammar, or is corrupt).  Free with
+// ObjectScript_Cached_Tree_delete().
+struct ObjectScript_Cached_Tree *ObjectScript_Tree_Cache_load(
+    struct ObjectScript_Tree_Cache *cache, const char *text, uint32_t length);
+
+// Serialize `tree`, which must have been parsed from `text`, into the cache
+bool ObjectScript_Tree_Cache_store(struct ObjectScript_Tree_Cache *cache,
+                                   const char *text, uint32_t length,
+                                   const TSTree *tree);
+
+// Load `text` from the cache, or parse it with `parser` and store it.
+// Returns NULL only if the parse itself fails.
+struct ObjectScript_Cached_Tree *ObjectScript_Tree_Cache_get(
+    struct ObjectScript_Tree_Cache *cache, TSParser *parser,
+    const char *text, uint32_t length);
+
+// Convert a live tree without going through the disk
+struct ObjectScript_Cached_Tree *ObjectScript_Cached_Tree_from_tree(const TSTree *tree);
+
+void ObjectScript_Cached_Tree_delete(struct ObjectScript_Cached_Tree *tree);
+
+uint32_t ObjectScript_Cached_Tree_node_count(const struct ObjectScript_Cached_Tree *tree);
+
+// All nodes, in pre-order; the root is at index 0
+const struct ObjectScript_Cached_Node *ObjectScript_Cached_Tree_nodes(
+    const struct ObjectScript_Cached_Tree *tree);
+
+// The node's type and field names, as ts_node_type()/ts_tree_cursor_current_field_name()
+const char *ObjectScript_Cached_Tree_type(const struct ObjectScript_Cached_Tree *tree,
+                                          const struct ObjectScript_Cached_Node *node);
+const char *ObjectScript_Cached_Tree_field_name(const struct ObjectScript_Cached_Tree *tree,
+                                                const struct ObjectScript_Cached_Node *node);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // OBJECTSCRIPT_TREE_CACHE_H_
@@ -0,0 +1,177 @@
+// Parsing from many threads that share each grammar's TSLanguage
+//
+// Usage: concurrent_parse_test [-t threads] [-r rounds] [-n count]
+//
+// Parses every case of */test/corpus plus a generated input of `count`
+// methods, tags or operands per grammar on one thread for a baseline, then
+// from `threads` threads at once (8 by default), each with its own parser
+// that it switches between the grammars as it goes.  Every tree's
+// S-expression must match the baseline.  Build it with `make test-tsan` to
+// run it under ThreadSanitizer; the grammar sources are compiled into the
+// test, so the scanners are instrumented too.
+#include "bench.h"
+#include "grammars.h"
+#include <dirent.h>
+#include <pthread.h>
+
+#define MAX_INPUTS 1024
+
+struct Input {
+  const struct Bench_Grammar *grammar;
+  char *name;
+  struct Bench_Buffer text;
+  char *expected;   // S-expression of the single threaded parse
+};
+
+static struct Input inputs[MAX_INPUTS];
+static uint32_t input_count;
+static int rounds = 20;
+
+static void add_input(const struct Bench_Grammar *grammar, const char *name,
+                      const char *text, uint32_t length) {
+  if (input_count == MAX_INPUTS) return;
+  struct Input *input = &inputs[input_count++];
+  input->grammar = grammar;
+  input->name = strdup(name);
+  Bench_Buffer_reserve(&input->text, length);
+  memcpy(input->text.data, text, length);
+  input->text.data[length] = 0;
+  input->text.length = length;
+}
+
+static bool is_rule(const char *line, char c) {
+  return line[0] == c && line[1] == c && line[2] == c;
+}
+
+// The input of each `===` header ... `---` case of a corpus file
+static void add_corpus_file(const struct Bench_Grammar *grammar, const char *path) {
+  struct Bench_Buffer file = {0};
+  if (!Bench_read_file(path, &file)) exit(1);
+  Bench_Buffer_printf(&file, "\n");
+
+  char name[256] = "";
+  const char *start = NULL;
+  int header = 0;
+  for (char *line = file.data; line < file.data + file.length;) {
+    char *end = strchr(line, '\n');
+    if (is_rule(line, '=')) {
+      if (++header == 2) start = end + 1;
+    } else if (header == 1) {
+      snprintf(name, sizeof(name), "%s: %.*s", path, (int)(end - line), line);
+    } else if (start && is_rule(line, '-')) {
+      add_input(grammar, name, start, (uint32_t)(line - start));
+      start = NULL;
+      header = 0;
+    }
+    line = end + 1;
+  }
+  Bench_Buffer_free(&file);
+}
+
+static char *parse(TSParser *parser, const struct Input *input) {
+  TSTree *tree = ts_parser_parse_string(parser, NULL, input->text.data, input->text.length);
+  if (!tree) return NULL;
+  char *sexp = ts_node_string(ts_tree_root_node(tree));
+  ts_tree_delete(tree);
+  return sexp;
+}
+
+static void *worker(void *arg) {
+  uintptr_t thread = (uintptr_t)arg;
+  TSParser *parser = ts_parser_new();
+  const TSLanguage *current = NULL;
+  uintptr_t mismatches = 0;
+  for (int round = 0; round < rounds; round++) {
+    // Each thread starts at a different input, so the same one is rarely
+    // parsed by all of them at once
+    for (uint32_t i = 0; i < input_count; i++) {
+      const struct Input *input = &inputs[(i + thread * 7 + round) % input_count];
+      const TSLanguage *language = input->grammar->language();
+      if (language != current) {
+        ts_parser_set_language(parser, language);
+        current = language;
+      }
+      char *sexp = parse(parser, input);
+      if (!sexp || strcmp(sexp, input->expected)) {
+        fprintf(stderr, "thread %u: %s differs from the single threaded parse\n",
+                (unsigned)thread, input->name);
+        mismatches++;
+      }
+      free(sexp);
+    }
+  }
+  ts_parser_delete(parser);
+  return (void *)mismatches;
+}
+
+int main(int argc, char **argv) {
+  int threads = 8;
+  int count = 50;
+  for (int arg = 1; arg < argc; arg++) {
+    if (!strcmp(argv[arg], "-t") && arg + 1 < argc) {
+      threads = atoi(argv[++arg]);
+    } else if (!strcmp(argv[arg], "-r") && arg + 1 < argc) {
+      rounds = atoi(argv[++arg]);
+    } else if (!strcmp(argv[arg], "-n") && arg + 1 < argc) {
+      count = atoi(argv[++arg]);
+    }
+  }
+  if (threads < 1) threads = 1;
+
+  // The corpus is relative to the repository root, one level up
+  for (size_t g = 0; g < sizeof(Bench_grammars) / sizeof(Bench_grammars[0]); g++) {
+    const struct Bench_Grammar *grammar = &Bench_grammars[g];
+    char directory[256];
+    snprintf(directory, sizeof(directory), "../%s/test/corpus", grammar->name);
+    DIR *corpus = opendir(directory);
+    for (struct dirent *entry; corpus && (entry = readdir(corpus));) {
+      size_t length = strlen(entry->d_name);
+      if (length < 4 || strcmp(entry->d_name + length - 4, ".txt")) continue;
+      char path[1024];
+      snprintf(path, sizeof(path), "%s/%s", directory, entry->d_name);
+      add_corpus_file(grammar, path);
+    }
+    if (corpus) closedir(corpus);
+
+    struct Bench_Buffer generated = {0};
+    Bench_generate(grammar, &generated, count);
+    char name[64];
+    snprintf(name, sizeof(name), "generated %s", grammar->name);
+    add_input(grammar, name, generated.data, generated.length);
+    Bench_Buffer_free(&generated);
+  }
+
+  TSParser *parser = ts_parser_new();
+  for (uint32_t i = 0; i < input_count; i++) {
+    ts_parser_set_language(parser, inputs[i].grammar->language());
+    inputs[i].expected = parse(parser, &inputs[i]);
+    if (!inputs[i].expected) {
+      fprintf(stderr, "%s: no tree\n", inputs[i].name);
+      return 1;
+    }
+  }
+  ts_parser_delete(parser);
+
+  double start = Bench_now_ms();
+  pthread_t *ids = (pthread_t *)calloc((size_t)threads, sizeof(pthread_t));
+  int started = 0;
+  for (; started < threads; started++) {
+    if (pthread_create(&ids[started], NULL, worker, (void *)(uintptr_t)started)) break;
+  }
+  uintptr_t mismatches = 0;
+  for (int i = 0; i < started; i++) {
+    void *result;
+    pthread_join(ids[i], &result);
+    mismatches += (uintptr_t)result;
+  }
+  free(ids);
+
+  printf("%u inputs, %d threads x %d rounds in %.0f ms: %lu mismatches\n", input_count,
+         started, rounds, Bench_now_ms() - start, (unsigned long)mismatches);
+  for (uint32_t i = 0; i < input_count; i++) {
+    free(inputs[i].name);
+    free(inputs[i].expected);
+    Bench_Buffer_free(&inputs[i].text);
+  }
+  return mismatches || started < threads ? 1 : 0;
+}
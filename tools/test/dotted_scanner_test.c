@@ -0,0 +1,80 @@
+// The dotted DO block tokens of core/src/scanner.h, without a parser
+//
+// Usage: dotted_scanner_test
+//
+// Calls the core scanner at the end of a line with the tokens the parser
+// would accept there, and checks which token it returns, where the token
+// ends and the block level it leaves behind.  Covers opening, continuing
+// and closing blocks, and the unbalanced lines the parser has to reject: a
+// line that skips a level, and dots where no argumentless DO opened a
+// block, which must not produce a block token at all.
+#include "bench.h"
+#include "bench_lexer.h"
+#include "../../core/src/scanner.h"
+
+#define NONE OBJECTSCRIPT_CORE_TOKEN_TYPE_MAX
+
+struct Case {
+  const char *name;
+  uint8_t level;             // Open blocks before the scan
+  bool in_block;             // _DOTTED_LINE and _DOTTED_BLOCK_END are valid
+  bool after_do;             // _DOTTED_BLOCK_START is valid
+  const char *input;
+  int symbol;                // NONE if no token
+  uint32_t end;              // Of the token
+  uint8_t level_after;
+};
+
+static const struct Case cases[] = {
+  {"argumentless DO opens a block", 0, false, true, "\n . set x=1",
+   _DOTTED_BLOCK_START, 4, 1},
+  {"nested DO opens a second level", 1, true, true, "\n . . write x",
+   _DOTTED_BLOCK_START, 6, 2},
+  {"a line of the block", 1, true, false, "\n . write x", _DOTTED_LINE, 4, 1},
+  {"blank lines before the next line", 1, true, false, "\n\n  \n . write x", _DOTTED_LINE, 8, 1},
+  {"a line at level 0 closes the block", 1, true, false, "\n quit", _DOTTED_BLOCK_END, 0, 0},
+  {"closing two levels, the first", 2, true, false, "\n quit", _DOTTED_BLOCK_END, 0, 1},
+  {"the end of the input closes the block", 1, true, false, "", _DOTTED_BLOCK_END, 0, 0},
+  {"whitespace in the middle of a line", 1, true, false, " x", _WHITESPACE, 1, 1},
+
+  // Unbalanced
+  {"DO followed by a line two levels in", 0, false, true, "\n . . set x=1", NONE, 0, 0},
+  {"a block line that skips from 1 to 3", 1, true, true, "\n . . . set x=1", NONE, 0, 1},
+  {"a block line that skips from 1 to 3, no DO", 1, true, false, "\n . . . set x=1", NONE, 0, 1},
+  {"dots after a line with no DO", 0, false, false, "\n . write x", _WHITESPACE, 2, 0},
+};
+
+static int check_case(const struct Case *test) {
+  struct ObjectScript_Core_Scanner scanner;
+  ObjectScript_Core_Scanner_init(&scanner);
+  scanner.dot_level = test->level;
+
+  bool valid_symbols[OBJECTSCRIPT_CORE_TOKEN_TYPE_MAX] = {false};
+  valid_symbols[_WHITESPACE] = true;
+  valid_symbols[_DOTTED_LINE] = test->in_block;
+  valid_symbols[_DOTTED_BLOCK_END] = test->in_block;
+  valid_symbols[_DOTTED_BLOCK_START] = test->after_do;
+
+  struct Bench_Lexer lexer;
+  Bench_Lexer_start(&lexer, test->input, (uint32_t)strlen(test->input), 0);
+  bool found = ObjectScript_Core_Scanner_scan(&scanner, &lexer.lexer, valid_symbols);
+  int symbol = found ? (int)lexer.lexer.result_symbol : NONE;
+  uint32_t end = found ? Bench_Lexer_token_end(&lexer) : 0;
+
+  if (symbol == test->symbol && end == test->end && scanner.dot_level == test->level_after) {
+    return 0;
+  }
+  fprintf(stderr, "%s: expected %s ending at %u at level %u, got %s ending at %u at level %u\n",
+          test->name, test->symbol == NONE ? "no token" : token_names[test->symbol], test->end,
+          test->level_after, symbol == NONE ? "no token" : token_names[symbol], end,
+          scanner.dot_level);
+  return 1;
+}
+
+int main(void) {
+  int failures = 0;
+  uint32_t count = sizeof(cases) / sizeof(cases[0]);
+  for (uint32_t i = 0; i < count; i++) failures += check_case(&cases[i]);
+  printf("dotted block scanner: %u cases, %d failures\n", count, failures);
+  return failures ? 1 : 0;
+}
@@ -0,0 +1,156 @@
+// The injection driver over udl/queries/injections.scm
+//
+// Usage: injection_cache_test
+//
+// Runs the layered injections query of the udl grammar over a class with
+// XData blocks that both a MimeType pattern and the catch-all xml pattern
+// match, and checks that each body is injected once, with the language of
+// the MimeType pattern, and that identical bodies are parsed once.  Every
+// language name resolves to the udl grammar; only the names are checked.
+#include "bench.h"
+#include "grammars.h"
+#include "injection_cache.h"
+
+#define MAX_INJECTIONS 16
+
+static const char source[] =
+    "Class Demo.Injections\n"
+    "{\n"
+    "\n"
+    "XData Config [ MimeType = \"application/json\" ]\n"
+    "{\n"
+    "{ \"a\": 1 }\n"
+    "}\n"
+    "\n"
+    "XData Page [ MimeType = \"text/html\" ]\n"
+    "{\n"
+    "<p>hello</p>\n"
+    "}\n"
+    "\n"
+    "XData Resource [ MimeType = \"application/fhir+json\" ]\n"
+    "{\n"
+    "{ \"a\": 1 }\n"
+    "}\n"
+    "\n"
+    "XData Plain\n"
+    "{\n"
+    "<plain/>\n"
+    "}\n"
+    "\n"
+    "}\n";
+
+struct Injected {
+  uint32_t start_byte;
+  char language[16];
+};
+
+struct Result {
+  struct Injected injected[MAX_INJECTIONS];
+  uint32_t count;
+};
+
+static const TSLanguage *resolve(void *payload, const char *name, uint32_t length) {
+  (void)payload;
+  (void)name;
+  (void)length;
+  return tree_sitter_objectscript_udl();
+}
+
+static void record(void *payload, const struct ObjectScript_Injection *injection) {
+  struct Result *result = (struct Result *)payload;
+  if (result->count == MAX_INJECTIONS) return;
+  struct Injected *injected = &result->injected[result->count++];
+  injected->start_byte = ts_node_start_byte(injection->content);
+  snprintf(injected->language, sizeof(injected->language), "%.*s",
+           (int)injection->language_length, injection->language);
+}
+
+// The language the body after `marker` was injected as, or NULL if it
+// wasn't.  Fails if it was injected more than once.
+static const char *language_after(const struct Result *result, const char *marker,
+                                  int *failures) {
+  uint32_t body = (uint32_t)(strstr(strstr(source, marker), "{\n") - source);
+  const char *language = NULL;
+  for (uint32_t i = 0; i < result->count; i++) {
+    if (result->injected[i].start_byte < body ||
+        result->injected[i].start_byte > body + 2) {
+      continue;
+    }
+    if (language) {
+      fprintf(stderr, "%s: injected as %s and again as %s\n", marker, language,
+              result->injected[i].language);
+      (*failures)++;
+    }
+    language = result->injected[i].language;
+  }
+  return language;
+}
+
+static void expect(const struct Result *result, const char *marker,
+                   const char *expected, int *failures) {
+  const char *language = language_after(result, marker, failures);
+  if (!language || strcmp(language, expected)) {
+    fprintf(stderr, "%s: expected %s, got %s\n", marker, expected,
+            language ? language : "no injection");
+    (*failures)++;
+  }
+}
+
+int main(void) {
+  const struct Bench_Grammar *udl = Bench_grammar("udl");
+  struct Bench_Buffer query_source = {0};
+  Bench_load_query(udl, "..", "injections", &query_source);
+
+  uint32_t error_offset;
+  TSQueryError error_type;
+  TSQuery *query = ts_query_new(udl->language(), query_source.data, query_source.length,
+                                &error_offset, &error_type);
+  if (!query) {
+    fprintf(stderr, "injections query: error %d at byte %u\n", (int)error_type,
+            error_offset);
+    return 1;
+  }
+
+  TSParser *parser = ts_parser_new();
+  ts_parser_set_language(parser, udl->language());
+  TSTree *tree = ts_parser_parse_string(parser, NULL, source, sizeof(source) - 1);
+
+  struct ObjectScript_Injection_Cache *cache = ObjectScript_Injection_Cache_new();
+  TSParser *injection_parser = ts_parser_new();
+  struct Result result = {0};
+  uint32_t reported = ObjectScript_Injection_Cache_inject(
+      cache, injection_parser, query, ts_tree_root_node(tree), source, resolve,
+      record, &result);
+
+  int failures = 0;
+  expect(&result, "XData Config", "json", &failures);
+  expect(&result, "XData Page", "html", &failures);
+  expect(&result, "XData Resource", "json", &failures);
+  expect(&result, "XData Plain", "xml", &failures);
+  for (uint32_t i = 1; i < result.count; i++) {
+    if (result.injected[i].start_byte < result.injected[i - 1].start_byte) {
+      fprintf(stderr, "injections are not in document order\n");
+      failures++;
+    }
+  }
+
+  // Config and Resource carry the same body as the same (resolved) language
+  struct ObjectScript_Injection_Cache_Stats stats;
+  ObjectScript_Injection_Cache_stats(cache, &stats);
+  if (stats.misses != 3 || stats.hits != 1) {
+    fprintf(stderr, "expected 3 parses and 1 hit, got %lu and %lu\n",
+            (unsigned long)stats.misses, (unsigned long)stats.hits);
+    failures++;
+  }
+
+  printf("%u injections, %lu parsed, %lu from the cache: %d failures\n", reported,
+         (unsigned long)stats.misses, (unsigned long)stats.hits, failures);
+
+  ObjectScript_Injection_Cache_delete(cache);
+  ts_parser_delete(injection_parser);
+  ts_tree_delete(tree);
+  ts_parser_delete(parser);
+  ts_query_delete(query);
+  Bench_Buffer_free(&query_source);
+  return failures ? 1 : 0;
+}
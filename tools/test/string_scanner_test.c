@@ -0,0 +1,107 @@
+// The string scanner of expr/src/scanner.h, without a parser
+//
+// Usage: string_scanner_test
+//
+// Lexes string_literal and json_string_literal from the start of each case
+// with the functions core and udl build a copy of, and checks where each
+// token ends, or that it is rejected: `""` quotes, line breaks, UTF-8,
+// every JSON escape, and unterminated strings.  Then calls the expr
+// grammar's scan function the way the parser does, to check that it skips
+// leading whitespace and leaves error recovery to the lexer.
+#include "bench.h"
+#include "bench_lexer.h"
+#include "../../expr/src/scanner.h"
+
+// Keep in the order of `externals` in expr/grammar.js
+enum { STRING_LITERAL, JSON_STRING_LITERAL };
+
+bool tree_sitter_objectscript_expr_external_scanner_scan(void *payload, TSLexer *lexer,
+                                                         const bool *valid_symbols);
+
+struct Case {
+  bool json;
+  const char *input;
+  const char *token;   // The prefix of `input` it lexes, NULL if rejected
+};
+
+static const struct Case cases[] = {
+  // From expr/test/corpus/strings.txt
+  {false, "\"a \"\"quoted\"\" word\"_\"line one", "\"a \"\"quoted\"\" word\""},
+  {false, "\"line one\nline two\"", "\"line one\nline two\""},
+  {true, "\"k\\\"ey\": \"caf\xc3\xa9\\n\"", "\"k\\\"ey\""},
+  {true, "\"caf\xc3\xa9\\n\", \"n\"", "\"caf\xc3\xa9\\n\""},
+  {true, "\"x\\\\y\", 1]", "\"x\\\\y\""},
+
+  {false, "\"\"", "\"\""},
+  {false, "\"\"\"\"_x", "\"\"\"\""},
+  {false, "\"caf\xc3\xa9 \xe2\x82\xac\"", "\"caf\xc3\xa9 \xe2\x82\xac\""},
+  {false, "\"no end", NULL},
+  {false, "\"no end\"\"", NULL},
+  {false, "x\"", NULL},
+  {true, "\"\"", "\"\""},
+  {true, "\"\\/\\b\\f\\n\\r\\t\\u00e9\\uFFFF\"}", "\"\\/\\b\\f\\n\\r\\t\\u00e9\\uFFFF\""},
+  {true, "\"\\u00g9\"", NULL},
+  {true, "\"\\u00\"", NULL},
+  {true, "\"a\\qb\"", NULL},
+  {true, "\"line\nbreak\"", NULL},
+  {true, "\"no end\\\"", NULL},
+};
+
+static int check_case(const struct Case *test) {
+  struct Bench_Lexer lexer;
+  uint32_t length = (uint32_t)strlen(test->input);
+  Bench_Lexer_start(&lexer, test->input, length, 0);
+  bool found = test->json ? ObjectScript_Expr_Scanner_lex_json_string(&lexer.lexer)
+                          : ObjectScript_Expr_Scanner_lex_string(&lexer.lexer);
+  uint32_t end = Bench_Lexer_token_end(&lexer);
+  if (!test->token) {
+    if (!found) return 0;
+    fprintf(stderr, "%s `%s`: expected no token, got %u bytes\n",
+            test->json ? "json" : "string", test->input, end);
+    return 1;
+  }
+  uint32_t expected = (uint32_t)strlen(test->token);
+  if (found && end == expected) return 0;
+  fprintf(stderr, "%s `%s`: expected %u bytes, got %s %u\n", test->json ? "json" : "string",
+          test->input, expected, found ? "a token of" : "no token, stopped at", end);
+  return 1;
+}
+
+static int check_scan(const char *input, bool string_valid, bool json_valid, bool expected_found,
+                      uint32_t expected_symbol, const char *expected_text) {
+  struct Bench_Lexer lexer;
+  bool valid_symbols[] = {string_valid, json_valid};
+  Bench_Lexer_start(&lexer, input, (uint32_t)strlen(input), 0);
+  bool found = tree_sitter_objectscript_expr_external_scanner_scan(NULL, &lexer.lexer,
+                                                                   valid_symbols);
+  if (found != expected_found) {
+    fprintf(stderr, "scan `%s`: expected %s\n", input, expected_found ? "a token" : "none");
+    return 1;
+  }
+  if (!found) return 0;
+  // Skipped whitespace isn't part of the token
+  const char *text = strchr(input, '"');
+  uint32_t end = Bench_Lexer_token_end(&lexer);
+  if (lexer.lexer.result_symbol != expected_symbol ||
+      end != (uint32_t)(text - input + strlen(expected_text)) ||
+      strncmp(text, expected_text, strlen(expected_text))) {
+    fprintf(stderr, "scan `%s`: expected symbol %u `%s`, got symbol %u ending at %u\n", input,
+            expected_symbol, expected_text, (unsigned)lexer.lexer.result_symbol, end);
+    return 1;
+  }
+  return 0;
+}
+
+int main(void) {
+  int failures = 0;
+  uint32_t count = sizeof(cases) / sizeof(cases[0]);
+  for (uint32_t i = 0; i < count; i++) failures += check_case(&cases[i]);
+
+  failures += check_scan(" \n\t\"a\"\"b\" x", true, false, true, STRING_LITERAL, "\"a\"\"b\"");
+  failures += check_scan("  \"a\\\"b\" x", false, true, true, JSON_STRING_LITERAL, "\"a\\\"b\"");
+  failures += check_scan("\"a\"", true, true, false, 0, NULL);
+  failures += check_scan("\"a\"", false, false, false, 0, NULL);
+
+  printf("string scanner: %u cases, %d failures\n", count + 4, failures);
+  return failures ? 1 : 0;
+}
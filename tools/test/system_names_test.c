@@ -0,0 +1,129 @@
+// Classifying the generic `$name` tokens with the system names table
+//
+// Usage: system_names_test
+//
+// Every spelling in the table must look itself up, in upper and in lower
+// case.  Then each grammar parses the same `$name` variables and calls,
+// full names, abbreviations, a user `$ZF` callout and unknown names, and
+// every system_defined_variable, system_defined_function and
+// doable_dollar_functions node must resolve, in document order, to the
+// expected full name, or to none for the unknown names.
+#include "bench.h"
+#include "grammars.h"
+#include "system_names.h"
+#include <ctype.h>
+
+#define EXPRESSION \
+  "$zdt($h,3)_$P(x,\",\",2)_$ZF(\"MyFunc\",x)_$ZE_$IsObject(o)_$Foo_$Foo(1)_$zcvt($ZT,\"U\")"
+
+// NULL for the unknown `$Foo` and `$Foo(`
+static const char *const expected_names[] = {
+  "$ZDATETIME", "$HOROLOG", "$PIECE", "$ZF", "$ZERROR", "$ISOBJECT",
+  NULL, NULL, "$ZCONVERT", "$ZTRAP",
+  "$ZF",   // `do $ZF(...)`, core and udl only
+};
+
+#define MAX_NAMES 32
+
+struct Names {
+  const struct ObjectScript_System_Name *resolved[MAX_NAMES];
+  uint32_t count;
+};
+
+static void generate(const struct Bench_Grammar *grammar, struct Bench_Buffer *buffer) {
+  if (!strcmp(grammar->name, "expr")) {
+    Bench_Buffer_printf(buffer, "%s", EXPRESSION);
+    return;
+  }
+  bool udl = !strcmp(grammar->name, "udl");
+  if (udl) Bench_Buffer_printf(buffer, "Class Test.SystemNames\n{\n\nClassMethod M()\n{\n");
+  Bench_Buffer_printf(buffer, " set x = %s\n do $ZF(-1,\"dir\")\n", EXPRESSION);
+  if (udl) Bench_Buffer_printf(buffer, "}\n\n}\n");
+}
+
+static void collect(TSNode root, const char *source, struct Names *names) {
+  TSTreeCursor cursor = ts_tree_cursor_new(root);
+  for (;;) {
+    TSNode node = ts_tree_cursor_current_node(&cursor);
+    const char *type = ts_node_type(node);
+    if ((!strcmp(type, "system_defined_function") || !strcmp(type, "system_defined_variable") ||
+         !strcmp(type, "doable_dollar_functions")) &&
+        names->count < MAX_NAMES) {
+      names->resolved[names->count++] = ObjectScript_System_Name_of_node(node, source);
+    }
+    if (ts_tree_cursor_goto_first_child(&cursor)) continue;
+    while (!ts_tree_cursor_goto_next_sibling(&cursor)) {
+      if (!ts_tree_cursor_goto_parent(&cursor)) {
+        ts_tree_cursor_delete(&cursor);
+        return;
+      }
+    }
+  }
+}
+
+static int check_spellings(void) {
+  int failures = 0;
+  uint32_t count;
+  const struct ObjectScript_System_Name *spellings = ObjectScript_System_Names(&count);
+  for (uint32_t i = 0; i < count; i++) {
+    const struct ObjectScript_System_Name *spelling = &spellings[i];
+    enum ObjectScript_System_Name_Kind kind = (enum ObjectScript_System_Name_Kind)spelling->kind;
+    char lower[64];
+    snprintf(lower, sizeof(lower), "%s", spelling->spelling);
+    for (char *c = lower; *c; c++) *c = (char)tolower((unsigned char)*c);
+    if (ObjectScript_System_Name_lookup(spelling->spelling, spelling->length, kind) != spelling ||
+        ObjectScript_System_Name_lookup(lower, spelling->length, kind) != spelling) {
+      fprintf(stderr, "%s doesn't look itself up\n", spelling->spelling);
+      failures++;
+    }
+  }
+  return failures;
+}
+
+static int check_grammar(const struct Bench_Grammar *grammar, TSParser *parser) {
+  struct Bench_Buffer buffer = {0};
+  generate(grammar, &buffer);
+  ts_parser_set_language(parser, grammar->language());
+  TSTree *tree = ts_parser_parse_string(parser, NULL, buffer.data, buffer.length);
+  TSNode root = ts_tree_root_node(tree);
+
+  int failures = 0;
+  if (ts_node_has_error(root)) {
+    fprintf(stderr, "%s: the input has errors\n", grammar->name);
+    failures++;
+  }
+
+  struct Names names = {0};
+  collect(root, buffer.data, &names);
+  uint32_t expected = sizeof(expected_names) / sizeof(expected_names[0]);
+  if (!strcmp(grammar->name, "expr")) expected--;
+  if (names.count != expected) {
+    fprintf(stderr, "%s: expected %u names, got %u\n", grammar->name, expected, names.count);
+    failures++;
+  }
+  for (uint32_t i = 0; i < names.count && i < expected; i++) {
+    const char *name = names.resolved[i] ? names.resolved[i]->name : NULL;
+    if (name == expected_names[i] ||
+        (name && expected_names[i] && !strcmp(name, expected_names[i]))) {
+      continue;
+    }
+    fprintf(stderr, "%s: name %u resolved to %s, expected %s\n", grammar->name, i,
+            name ? name : "nothing", expected_names[i] ? expected_names[i] : "nothing");
+    failures++;
+  }
+
+  ts_tree_delete(tree);
+  Bench_Buffer_free(&buffer);
+  return failures;
+}
+
+int main(void) {
+  int failures = check_spellings();
+  TSParser *parser = ts_parser_new();
+  for (size_t i = 0; i < sizeof(Bench_grammars) / sizeof(Bench_grammars[0]); i++) {
+    failures += check_grammar(&Bench_grammars[i], parser);
+  }
+  ts_parser_delete(parser);
+  printf("system names: %d failures\n", failures);
+  return failures ? 1 : 0;
+}
@@ -0,0 +1,132 @@
+#!/usr/bin/env node
+/**
+ * Cost of finding the class members an edit touched.
+ *
+ * Parses a class of `-m` methods, then `-r` times: takes the `classMembers` of
+ * the tree, types one character in the body of the method in the middle,
+ * reparses incrementally and calls `changedMembers` on the old and new tree.
+ * Reports the median and worst time of the reparse, of `classMembers`, which
+ * grows with the number of members, and of `changedMembers`, which should stay
+ * well under a millisecond whatever the size of the class.
+ *
+ * Usage: node benches/changed_members.js [-m methods] [-r runs]
+ *
+ * Needs the native binding.
+ */
+
+/* eslint-disable camelcase */
+// @ts-check
+
+const { performance } = require('perf_hooks');
+const Parser = require('tree-sitter');
+const udl = require('..');
+
+/**
+ * @param {number} methods
+ * @return {string} a class of a property and a method per `methods`
+ */
+function generate_class(methods) {
+  const lines = ['Class Bench.Members Extends %Persistent', '{', ''];
+  for (let i = 0; i < methods; i++) {
+    lines.push(
+      `Property Prop${i} As %String(MAXLEN = 200);`,
+      '',
+      `ClassMethod Method${i}(pInput As %String) As %Status`,
+      '{',
+      `    set tSC = $$$OK, ^Bench.Data(${i}) = $listbuild(pInput, ${i})`,
+      '    quit tSC',
+      '}',
+      '',
+    );
+  }
+  lines.push('}', '');
+  return lines.join('\n');
+}
+
+/**
+ * @param {string} text
+ * @param {number} index
+ * @return {{row: number, column: number}}
+ */
+function point_at(text, index) {
+  const before = text.slice(0, index);
+  const row = before.split('\n').length - 1;
+  return { row, column: index - (before.lastIndexOf('\n') + 1) };
+}
+
+/**
+ * @param {string} name
+ * @param {number[]} times
+ * @param {string} [extra]
+ */
+function report(name, times, extra = '') {
+  times.sort((a, b) => a - b);
+  console.log(
+    `${name.padEnd(16)} median ${times[times.length >> 1].toFixed(3).padStart(9)} ms` +
+      `   max ${times[times.length - 1].toFixed(3).padStart(9)} ms${extra}`,
+  );
+}
+
+function main() {
+  const args = process.argv.slice(2);
+  let methods = 1000;
+  let runs = 50;
+  for (let i = 0; i < args.length; i++) {
+    if (args[i] === '-m') {
+      methods = Number(args[++i]);
+    } else if (args[i] === '-r') {
+      runs = Number(args[++i]);
+    }
+  }
+
+  let input = generate_class(methods);
+  const parser = new Parser();
+  parser.setLanguage(udl);
+  let tree = parser.parse(input);
+  console.log(`${methods} methods, ${input.split('\n').length} lines, ${runs} runs\n`);
+
+  // Each run inserts a digit after `$$$OK` in the middle method
+  const marker = `$$$OK, ^Bench.Data(${methods >> 1})`;
+  const at = input.indexOf(marker) + '$$$OK'.length;
+  const reparse = [];
+  const snapshot = [];
+  const changed = [];
+  let members = [];
+  for (let i = 0; i < runs; i++) {
+    const position = point_at(input, at);
+    const newEndPosition = { row: position.row, column: position.column + 1 };
+    input = input.slice(0, at) + String(i % 10) + input.slice(at);
+    const oldTree = tree;
+    let start = performance.now();
+    const oldMembers = udl.classMembers(oldTree);
+    snapshot.push(performance.now() - start);
+
+    const edit = {
+      startIndex: at,
+      oldEndIndex: at,
+      newEndIndex: at + 1,
+      startPosition: position,
+      oldEndPosition: position,
+      newEndPosition,
+    };
+    oldTree.edit(edit);
+
+    start = performance.now();
+    tree = parser.parse(input, oldTree);
+    reparse.push(performance.now() - start);
+
+    start = performance.now();
+    members = udl.changedMembers(oldTree, tree, oldMembers, [edit]);
+    changed.push(performance.now() - start);
+  }
+
+  report('reparse', reparse);
+  report('classMembers', snapshot);
+  report(
+    'changedMembers',
+    changed,
+    `   ${members.map((member) => `${member.change} ${member.kind} ${member.name}`).join(', ')}`,
+  );
+}
+
+main();
@@ -0,0 +1,129 @@
+#!/usr/bin/env node
+/**
+ * Reparse latency of a document held as a rope, with and without joining it.
+ *
+ * Keeps a generated class as leaves of `-l` lines, then `-r` times: types
+ * one character into the leaf in the middle, edits the old tree and reparses
+ * it incrementally, either
+ *
+ * - joined:  from `leaves.join('')`, the copy an editor makes today
+ * - chunked: from `chunkedInput(leaves)`, reading the leaves in place
+ *
+ * and reports the median and worst time of each, the join included.
+ *
+ * Usage: node benches/chunked_input.js [-m methods] [-l lines] [-r runs]
+ *
+ * Needs the native binding.
+ */
+
+/* eslint-disable camelcase */
+// @ts-check
+
+const { performance } = require('perf_hooks');
+const Parser = require('tree-sitter');
+const udl = require('..');
+
+/**
+ * @param {number} methods
+ * @return {string[]} the lines of a class of 10 lines per method
+ */
+function generate_lines(methods) {
+  const lines = ['Class Bench.Rope Extends %Persistent', '{', ''];
+  for (let i = 0; i < methods; i++) {
+    lines.push(
+      `Property Prop${i} As %String(MAXLEN = 200);`,
+      '',
+      `ClassMethod Method${i}(pInput As %String) As %Status`,
+      '{',
+      `    set tSC = $$$OK, ^Bench.Data(${i}) = $listbuild(pInput, ${i})`,
+      '    &sql(SELECT Name INTO :tName FROM Sample.Person WHERE ID = :pInput)',
+      '    quit tSC',
+      '}',
+      '',
+    );
+  }
+  lines.push('}', '');
+  return lines.map((line) => `${line}\n`);
+}
+
+/**
+ * @param {string} name
+ * @param {number[]} times
+ */
+function report(name, times) {
+  times.sort((a, b) => a - b);
+  console.log(
+    `${name.padEnd(10)} median ${times[times.length >> 1].toFixed(3).padStart(9)} ms` +
+      `   max ${times[times.length - 1].toFixed(3).padStart(9)} ms`,
+  );
+}
+
+/**
+ * @param {Parser} parser
+ * @param {string[]} leaves
+ * @param {number} runs
+ * @param {(leaves: string[]) => string | Parser.Input} input
+ * @return {number[]}
+ */
+function measure(parser, leaves, runs, input) {
+  leaves = [...leaves];
+  const middle = leaves.length >> 1;
+  let tree = parser.parse(input(leaves));
+  const times = [];
+  for (let i = 0; i < runs; i++) {
+    // Insert a space at the start of the middle leaf
+    let startIndex = 0;
+    let row = 0;
+    for (let leaf = 0; leaf < middle; leaf++) {
+      startIndex += leaves[leaf].length;
+      row += leaves[leaf].split('\n').length - 1;
+    }
+    leaves[middle] = ` ${leaves[middle]}`;
+    tree.edit({
+      startIndex,
+      oldEndIndex: startIndex,
+      newEndIndex: startIndex + 1,
+      startPosition: { row, column: 0 },
+      oldEndPosition: { row, column: 0 },
+      newEndPosition: { row, column: 1 },
+    });
+    const start = performance.now();
+    tree = parser.parse(input(leaves), tree);
+    times.push(performance.now() - start);
+  }
+  return times;
+}
+
+function main() {
+  const args = process.argv.slice(2);
+  let methods = 5000;
+  let leaf_lines = 64;
+  let runs = 50;
+  for (let i = 0; i < args.length; i++) {
+    if (args[i] === '-m') {
+      methods = Number(args[++i]);
+    } else if (args[i] === '-l') {
+      leaf_lines = Number(args[++i]);
+    } else if (args[i] === '-r') {
+      runs = Number(args[++i]);
+    }
+  }
+
+  const lines = generate_lines(methods);
+  const leaves = [];
+  for (let i = 0; i < lines.length; i += leaf_lines) {
+    leaves.push(lines.slice(i, i + leaf_lines).join(''));
+  }
+  const bytes = leaves.reduce((total, leaf) => total + leaf.length, 0);
+  console.log(
+    `${lines.length} lines, ${(bytes / 1024 / 1024).toFixed(1)} MB in ` +
+      `${leaves.length} leaves, ${runs} runs\n`,
+  );
+
+  const parser = new Parser();
+  parser.setLanguage(udl);
+  report('joined', measure(parser, leaves, runs, (rope) => rope.join('')));
+  report('chunked', measure(parser, leaves, runs, (rope) => udl.chunkedInput(rope)));
+}
+
+main();
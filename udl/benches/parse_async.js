@@ -0,0 +1,127 @@
+#!/usr/bin/env node
+/**
+ * Event loop blocking of synchronous vs. threadpool parsing.
+ *
+ * Parses the same classes three ways and reports how long the event loop
+ * was blocked (the longest stall and p99 of `monitorEventLoopDelay`) next to
+ * the wall time:
+ *
+ * - sync:  `Parser#parse` from the `tree-sitter` package, one file at a time
+ * - async: `parseAsync`, one file at a time
+ * - batch: `parseBatch`, all files, `UV_THREADPOOL_SIZE` at a time
+ *
+ * Usage: node benches/parse_async.js [-n files] [-m methods] [file.cls...]
+ *
+ * Without files, `-n` synthetic classes of `-m` methods are generated (the
+ * default is 4 classes of ~50k lines).  Needs the native binding to be built.
+ */
+
+/* eslint-disable camelcase */
+// @ts-check
+
+const fs = require('fs');
+const { monitorEventLoopDelay, performance } = require('perf_hooks');
+const Parser = require('tree-sitter');
+const udl = require('..');
+
+/**
+ * @param {number} methods
+ * @return {string} a class of roughly 20 lines per method
+ */
+function generate_class(methods) {
+  const lines = ['Class Bench.Large Extends %Persistent', '{', ''];
+  for (let i = 0; i < methods; i++) {
+    lines.push(
+      `Property Prop${i} As %String(MAXLEN = 200) [ Required ];`,
+      '',
+      `/// Method ${i}`,
+      `ClassMethod Method${i}(pInput As %String, Output pOutput As %DynamicObject) As %Status`,
+      '{',
+      `    set tSC = $$$OK, pOutput = {"name": "item${i}", "items": [1, 2, 3]}`,
+      '    try {',
+      '        for i=1:1:$length(pInput, ",") {',
+      '            set tPiece = $piece(pInput, ",", i)',
+      `            set ^Bench.Data(${i}, i) = $listbuild(tPiece, i * 2 + 1)`,
+      '            do ..Helper(.tPiece, i), ##class(Bench.Util).Log("step", i)',
+      '        }',
+      '        &sql(SELECT Name INTO :tName FROM Sample.Person WHERE ID = :pId)',
+      '    } catch ex {',
+      '        set tSC = ex.AsStatus()',
+      '    }',
+      '    quit tSC',
+      '}',
+      '',
+    );
+  }
+  lines.push('}', '');
+  return lines.join('\n');
+}
+
+/**
+ * Run `body` while sampling the event loop delay
+ *
+ * @param {string} name
+ * @param {() => Promise<void>} body
+ */
+async function measure(name, body) {
+  const histogram = monitorEventLoopDelay({ resolution: 1 });
+  // Keep the loop busy with a timer, so that stalls show up as delay
+  const ticker = setInterval(() => {}, 1);
+  histogram.enable();
+  const start = performance.now();
+  await body();
+  const wall = performance.now() - start;
+  histogram.disable();
+  clearInterval(ticker);
+
+  const ms = (/** @type {number} */ ns) => (ns / 1e6).toFixed(1);
+  console.log(
+    `${name.padEnd(6)} wall ${wall.toFixed(0).padStart(7)} ms` +
+      `   max stall ${ms(histogram.max).padStart(8)} ms` +
+      `   p99 stall ${ms(histogram.percentile(99)).padStart(8)} ms`,
+  );
+}
+
+async function main() {
+  const args = process.argv.slice(2);
+  let count = 4;
+  let methods = 2600;
+  const files = [];
+  for (let i = 0; i < args.length; i++) {
+    if (args[i] === '-n') {
+      count = Number(args[++i]);
+    } else if (args[i] === '-m') {
+      methods = Number(args[++i]);
+    } else {
+      files.push(args[i]);
+    }
+  }
+
+  const inputs = files.length
+    ? files.map((file) => fs.readFileSync(file, 'utf8'))
+    : Array.from({ length: count }, () => generate_class(methods));
+  const lines = inputs.reduce((n, input) => n + input.split('\n').length, 0);
+  console.log(`${inputs.length} input(s), ${lines} lines\n`);
+
+  const parser = new Parser();
+  parser.setLanguage(udl);
+  // Let each parse return to the loop, as a server handling requests would
+  const yield_ = () => new Promise((resolve) => setImmediate(resolve));
+
+  await measure('sync', async () => {
+    for (const input of inputs) {
+      parser.parse(input);
+      await yield_();
+    }
+  });
+  await measure('async', async () => {
+    for (const input of inputs) {
+      await udl.parseAsync(input, { sexp: false });
+    }
+  });
+  await measure('batch', async () => {
+    await udl.parseBatch(inputs, { sexp: false });
+  });
+}
+
+main();
@@ -0,0 +1,72 @@
+"""Scaling of parse_bytes_many() across threads
+
+    pip install '.[bench]'
+    pytest benches/test_parse_many.py --benchmark-group-by=param:sources
+
+Parses the same set of generated classes on 1, 2, 4, ... threads (up to the
+number of cores), so the speedup is the ratio of the means in each group.
+Set OBJECTSCRIPT_BENCH_DIR to a directory of .cls files to use real sources.
+"""
+
+import os
+from pathlib import Path
+
+import pytest
+
+import tree_sitter_objectscript_udl as udl
+
+CORES = os.cpu_count() or 1
+THREADS = sorted({1, CORES} | {n for n in (2, 4, 8, 16, 32) if n < CORES})
+
+
+def generate_class(index, methods):
+    body = "".join(
+        f"""
+/// Method {i}
+ClassMethod Method{i}(pInput As %String, Output pOutput As %DynamicObject) As %Status
+{{
+    set tSC = $$$OK, pOutput = {{"name": "item{i}", "items": [1, 2, 3]}}
+    for i=1:1:$length(pInput, ",") {{
+        set ^Bench.Data({i}, i) = $listbuild($piece(pInput, ",", i), i * 2 + 1)
+        do ..Helper(.pInput, i), ##class(Bench.Util).Log("step", i)
+    }}
+    &sql(SELECT Name INTO :tName FROM Sample.Person WHERE ID = :pId)
+    quit tSC
+}}
+"""
+        for i in range(methods)
+    )
+    return f"Class Bench.Class{index} Extends %Persistent\n{{\n{body}\n}}\n".encode()
+
+
+def load_sources(size):
+    directory = os.environ.get("OBJECTSCRIPT_BENCH_DIR")
+    if directory:
+        return [path.read_bytes() for path in sorted(Path(directory).rglob("*.cls"))]
+    count, methods = {"small": (256, 20), "large": (32, 1000)}[size]
+    return [generate_class(i, methods) for i in range(count)]
+
+
+@pytest.fixture(scope="module", params=["small", "large"])
+def sources(request):
+    return load_sources(request.param)
+
+
+@pytest.mark.parametrize("threads", THREADS)
+def test_parse_bytes_many(benchmark, sources, threads):
+    benchmark.extra_info["threads"] = threads
+    benchmark.extra_info["megabytes"] = sum(map(len, sources)) / 1e6
+    summaries = benchmark(udl.parse_bytes_many, sources, threads)
+    assert len(summaries) == len(sources)
+
+
+def test_parse_files(benchmark, tmp_path, sources):
+    paths = []
+    for i, source in enumerate(sources):
+        path = tmp_path / f"Class{i}.cls"
+        path.write_bytes(source)
+        paths.append(path)
+    summaries = benchmark(udl.parse_files, paths, CORES)
+    assert [summary.node_count for summary in summaries] == [
+        summary.node_count for summary in udl.parse_bytes_many(sources, 1)
+    ]
@@ -0,0 +1,134 @@
+#!/usr/bin/env node
+/**
+ * Latency of highlighting a whole class vs. the lines an editor shows.
+ *
+ * Parses one large class, then times, over `-r` runs each:
+ *
+ * - full:     HIGHLIGHTS_QUERY captures over the whole tree
+ * - viewport: `highlightsInRange` over `-v` lines at the top, middle and end
+ * - injections: the same two for INJECTIONS_QUERY matches
+ *
+ * and reports the median and worst time of each.
+ *
+ * Usage: node benches/viewport.js [-m methods] [-v lines] [-r runs] [file.cls]
+ *
+ * Without a file, a class of `-m` methods is generated (the default is about
+ * 60k lines).  Needs the native binding and the merged queries.
+ */
+
+/* eslint-disable camelcase */
+// @ts-check
+
+const fs = require('fs');
+const { performance } = require('perf_hooks');
+const Parser = require('tree-sitter');
+const udl = require('..');
+
+/**
+ * @param {number} methods
+ * @return {string} a class of roughly 20 lines per method
+ */
+function generate_class(methods) {
+  const lines = ['Class Bench.Large Extends %Persistent', '{', ''];
+  for (let i = 0; i < methods; i++) {
+    lines.push(
+      `Property Prop${i} As %String(MAXLEN = 200) [ Required ];`,
+      '',
+      `/// Method ${i}`,
+      `ClassMethod Method${i}(pInput As %String, Output pOutput As %DynamicObject) As %Status`,
+      '{',
+      `    set tSC = $$$OK, pOutput = {"name": "item${i}", "items": [1, 2, 3]}`,
+      '    try {',
+      '        for i=1:1:$length(pInput, ",") {',
+      '            set tPiece = $piece(pInput, ",", i)',
+      `            set ^Bench.Data(${i}, i) = $listbuild(tPiece, i * 2 + 1)`,
+      '            do ..Helper(.tPiece, i), ##class(Bench.Util).Log("step", i)',
+      '        }',
+      '        &sql(SELECT Name INTO :tName FROM Sample.Person WHERE ID = :pId)',
+      '    } catch ex {',
+      '        set tSC = ex.AsStatus()',
+      '    }',
+      '    quit tSC',
+      '}',
+      '',
+    );
+  }
+  lines.push('}', '');
+  return lines.join('\n');
+}
+
+/**
+ * @param {string} name
+ * @param {number} runs
+ * @param {() => unknown[]} body
+ */
+function measure(name, runs, body) {
+  const times = [];
+  let results = 0;
+  for (let i = 0; i < runs; i++) {
+    const start = performance.now();
+    results = body().length;
+    times.push(performance.now() - start);
+  }
+  times.sort((a, b) => a - b);
+  console.log(
+    `${name.padEnd(22)} median ${times[times.length >> 1].toFixed(2).padStart(9)} ms` +
+      `   max ${times[times.length - 1].toFixed(2).padStart(9)} ms` +
+      `   ${String(results).padStart(8)} results`,
+  );
+}
+
+function main() {
+  const args = process.argv.slice(2);
+  let methods = 3000;
+  let viewport = 100;
+  let runs = 20;
+  let file;
+  for (let i = 0; i < args.length; i++) {
+    if (args[i] === '-m') {
+      methods = Number(args[++i]);
+    } else if (args[i] === '-v') {
+      viewport = Number(args[++i]);
+    } else if (args[i] === '-r') {
+      runs = Number(args[++i]);
+    } else {
+      file = args[i];
+    }
+  }
+
+  const input = file ? fs.readFileSync(file, 'utf8') : generate_class(methods);
+  const lines = input.split('\n').length;
+  const parser = new Parser();
+  parser.setLanguage(udl);
+  const tree = parser.parse(input);
+  const root = tree.rootNode;
+  console.log(`${lines} lines, ${viewport} line viewport, ${runs} runs\n`);
+
+  const highlights = new Parser.Query(udl, udl.HIGHLIGHTS_QUERY);
+  const injections = new Parser.Query(udl, udl.INJECTIONS_QUERY);
+  const viewports = {
+    top: 0,
+    middle: Math.max(0, (lines - viewport) >> 1),
+    end: Math.max(0, lines - viewport),
+  };
+
+  measure('highlights full', runs, () => highlights.captures(root));
+  for (const [name, first] of Object.entries(viewports)) {
+    const range = {
+      startPosition: { row: first, column: 0 },
+      endPosition: { row: first + viewport, column: 0 },
+    };
+    measure(`highlights ${name}`, runs, () => udl.highlightsInRange(root, range));
+  }
+  console.log();
+  measure('injections full', runs, () => injections.matches(root));
+  for (const [name, first] of Object.entries(viewports)) {
+    const range = {
+      startPosition: { row: first, column: 0 },
+      endPosition: { row: first + viewport, column: 0 },
+    };
+    measure(`injections ${name}`, runs, () => udl.injectionsInRange(root, range));
+  }
+}
+
+main();
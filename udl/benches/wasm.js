@@ -0,0 +1,160 @@
+#!/usr/bin/env node
+/**
+ * Startup and throughput of the udl wasm builds vs. the native binding.
+ *
+ * For every .wasm given (by default the playground build and the size
+ * optimized one from scripts/build-wasm.js), reports the download size (raw,
+ * gzip, brotli), the time to instantiate it with web-tree-sitter
+ * (`Language.load`, compile included, median of `-r` runs) and the parse
+ * throughput, next to the native binding parsing the same input.
+ *
+ * Usage: node benches/wasm.js [-m methods] [-r runs] [-f file.cls] [file.wasm...]
+ *
+ * Needs web-tree-sitter, and the native binding for the comparison.
+ */
+
+/* eslint-disable camelcase */
+// @ts-check
+
+const fs = require('fs');
+const path = require('path');
+const zlib = require('zlib');
+const { performance } = require('perf_hooks');
+
+const ROOT = path.join(__dirname, '..');
+
+/**
+ * @param {number} methods
+ * @return {string}
+ */
+function generate_class(methods) {
+  const lines = ['Class Bench.Wasm Extends %Persistent', '{', ''];
+  for (let i = 0; i < methods; i++) {
+    lines.push(
+      `Property Prop${i} As %String(MAXLEN = 200) [ Required, SqlFieldName = P${i} ];`,
+      '',
+      `ClassMethod Method${i}(pInput As %String) As %Status [ SqlProc ]`,
+      '{',
+      `    set tSC = $$$OK, obj = {"name": "item${i}", "items": [1, 2, 3]}`,
+      '    for i=1:1:$length(pInput, ",") {',
+      `        set ^Bench.Data(${i}, i) = $listbuild($piece(pInput, ",", i), i * 2)`,
+      '        do ..Helper(.pInput, i), ##class(Bench.Util).Log("step", i)',
+      '    }',
+      '    &sql(SELECT Name INTO :tName FROM Sample.Person WHERE ID = :pId)',
+      '    quit tSC',
+      '}',
+      '',
+    );
+  }
+  lines.push('}', '');
+  return lines.join('\n');
+}
+
+/**
+ * @param {number[]} values
+ * @return {number}
+ */
+function median(values) {
+  const sorted = [...values].sort((a, b) => a - b);
+  return sorted[Math.floor(sorted.length / 2)];
+}
+
+/**
+ * Parse `source` until at least ~1s has passed, returning MB/s
+ *
+ * @param {(source: string) => {delete?: () => void} | void} parse
+ * @param {string} source
+ * @return {number}
+ */
+function throughput(parse, source) {
+  parse(source);   // warm up
+  let bytes = 0;
+  const start = performance.now();
+  while (performance.now() - start < 1000) {
+    const tree = parse(source);
+    if (tree && tree.delete) tree.delete();
+    bytes += Buffer.byteLength(source);
+  }
+  return bytes / 1e6 / ((performance.now() - start) / 1e3);
+}
+
+async function main() {
+  const args = process.argv.slice(2);
+  let methods = 1000;
+  let runs = 5;
+  let source;
+  const wasm_files = [];
+  for (let i = 0; i < args.length; i++) {
+    if (args[i] === '-m') {
+      methods = Number(args[++i]);
+    } else if (args[i] === '-r') {
+      runs = Number(args[++i]);
+    } else if (args[i] === '-f') {
+      source = fs.readFileSync(args[++i], 'utf8');
+    } else {
+      wasm_files.push(args[i]);
+    }
+  }
+  source ??= generate_class(methods);
+  if (!wasm_files.length) {
+    for (const file of [
+      'tree-sitter-objectscript_udl.wasm',
+      'tree-sitter-objectscript_udl.min.wasm',
+    ]) {
+      if (fs.existsSync(path.join(ROOT, file))) {
+        wasm_files.push(path.join(ROOT, file));
+      }
+    }
+  }
+  console.log(`input: ${(Buffer.byteLength(source) / 1024).toFixed(0)} KB\n`);
+
+  try {
+    const NativeParser = require('tree-sitter');
+    const parser = new NativeParser();
+    parser.setLanguage(require('..'));
+    const mbs = throughput((text) => parser.parse(text), source);
+    console.log(`native: ${mbs.toFixed(1)} MB/s\n`);
+  } catch (error) {
+    console.log(`native: not available (${error.message})\n`);
+  }
+
+  // Not a dependency of the grammar, `npm install --no-save web-tree-sitter`
+  let web;
+  try {
+    web = require('web-tree-sitter');
+  } catch (_) {
+    console.log('web-tree-sitter is not installed');
+    process.exit(1);
+  }
+  // web-tree-sitter 0.25 has named exports, older versions export Parser
+  const Parser = web.Parser ?? web;
+  const Language = web.Language ?? Parser.Language;
+  await Parser.init();
+
+  for (const file of wasm_files) {
+    const bytes = fs.readFileSync(file);
+    const instantiate = [];
+    let language;
+    for (let i = 0; i < runs; i++) {
+      const start = performance.now();
+      language = await Language.load(new Uint8Array(bytes));
+      instantiate.push(performance.now() - start);
+    }
+    const parser = new Parser();
+    parser.setLanguage(language);
+    const mbs = throughput((text) => parser.parse(text), source);
+
+    const kb = (/** @type {number} */ n) => `${(n / 1024).toFixed(1)} KB`;
+    console.log(path.basename(file));
+    console.log(
+      `  size:         ${kb(bytes.length)}` +
+        `, gzip ${kb(zlib.gzipSync(bytes, { level: 9 }).length)}` +
+        `, brotli ${kb(zlib.brotliCompressSync(bytes).length)}`,
+    );
+    console.log(`  instantiate:  ${median(instantiate).toFixed(1)} ms (median of ${runs})`);
+    console.log(`  parse:        ${mbs.toFixed(1)} MB/s\n`);
+    parser.delete();
+  }
+}
+
+main();
@@ -1,4 +1,12 @@
 {
+  "variables": {
+    # The async parse API runs the parser itself on the libuv threadpool, so
+    # the addon links its own copy of the runtime, built from the sources the
+    # `tree-sitter` node package vendors (a dependency for that reason).  It
+    # never shares trees with that package: parseAsync/parseBatch return
+    # plain objects and strings.
+    "tree_sitter_lib": "<!(node -p \"require('path').join(require('path').dirname(require.resolve('tree-sitter/package.json')), 'vendor', 'tree-sitter', 'lib')\")",
+  },
   "targets": [
     {
       "target_name": "tree_sitter_objectscript_udl_binding",
@@ -7,11 +15,13 @@
       ],
       "include_dirs": [
         "src",
+        "<(tree_sitter_lib)/include",
       ],
       "sources": [
         "bindings/node/binding.cc",
         "src/parser.c",
         "src/scanner.c",
+        "<(tree_sitter_lib)/src/lib.c",
       ],
       "conditions": [
         ["OS!='win'", {
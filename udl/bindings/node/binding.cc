@@ -1,6 +1,12 @@
 #include <napi.h>
+#include <tree_sitter/api.h>
 
-typedef struct TSLanguage TSLanguage;
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <string>
+#include <utility>
+#include <vector>
 
 extern "C" TSLanguage *tree_sitter_objectscript_udl();
 
@@ -9,11 +15,317 @@ const napi_type_tag LANGUAGE_TYPE_TAG = {
   0x8AF2E5212AD58ABF, 0xD5006CAD83ABBA16
 };
 
+namespace {
+
+struct ParseOptions {
+    bool sexp = true;
+    uint32_t max_errors = 100;
+    // 0 for no limit
+    uint64_t timeout_micros = 0;
+    // Set from the main thread to stop the parse, see index.js
+    const std::atomic<uint64_t> *cancellation_flag = nullptr;
+};
+
+enum class ParseFailure { None, Failed, TimedOut, Cancelled };
+
+struct ParseError {
+    std::string type;
+    bool missing;
+    uint32_t start_byte;
+    uint32_t end_byte;
+    TSPoint start_point;
+    TSPoint end_point;
+};
+
+struct ParseResult {
+    bool has_error = false;
+    std::string root_type;
+    std::string sexp;
+    std::vector<ParseError> errors;
+    double parse_ms = 0;
+};
+
+// One parser per libuv thread, so that concurrent work items never share one
+// and repeated parses on the same thread reuse its allocations.  NULL if the
+// runtime the addon was built with can't load the grammar's ABI version.
+TSParser *ThreadParser() {
+    struct Holder {
+        TSParser *parser = nullptr;
+        ~Holder() {
+            if (parser) ts_parser_delete(parser);
+        }
+    };
+    static thread_local Holder holder;
+    if (!holder.parser) {
+        TSParser *parser = ts_parser_new();
+        if (!ts_parser_set_language(parser, tree_sitter_objectscript_udl())) {
+            ts_parser_delete(parser);
+            return nullptr;
+        }
+        holder.parser = parser;
+    }
+    return holder.parser;
+}
+
+std::string LanguageVersionError() {
+    return "The objectscript_udl grammar has ABI version " +
+           std::to_string(ts_language_abi_version(tree_sitter_objectscript_udl())) +
+           ", the tree-sitter runtime this addon was built with loads versions " +
+           std::to_string(TREE_SITTER_MIN_COMPATIBLE_LANGUAGE_VERSION) + " to " +
+           std::to_string(TREE_SITTER_LANGUAGE_VERSION) +
+           ", rebuild it against tree-sitter 0.25 or later";
+}
+
+// Polled by the parser through its progress callback
+struct ParseBudget {
+    std::chrono::steady_clock::time_point deadline;
+    bool has_deadline;
+    const std::atomic<uint64_t> *cancellation_flag;
+    bool timed_out = false;
+    bool cancelled = false;
+};
+
+// Returns true to halt the parse
+bool ParseProgress(TSParseState *state) {
+    auto *budget = static_cast<ParseBudget *>(state->payload);
+    if (budget->cancellation_flag &&
+        budget->cancellation_flag->load(std::memory_order_relaxed) != 0) {
+        budget->cancelled = true;
+    } else if (budget->has_deadline && std::chrono::steady_clock::now() >= budget->deadline) {
+        budget->timed_out = true;
+    }
+    return budget->cancelled || budget->timed_out;
+}
+
+const char *ReadString(void *payload, uint32_t byte_index, TSPoint, uint32_t *bytes_read) {
+    auto *source = static_cast<const std::string *>(payload);
+    if (byte_index >= source->size()) {
+        *bytes_read = 0;
+        return "";
+    }
+    *bytes_read = static_cast<uint32_t>(source->size() - byte_index);
+    return source->data() + byte_index;
+}
+
+// Collect ERROR and MISSING nodes, only descending into subtrees with errors
+void CollectErrors(TSNode root, uint32_t max_errors, std::vector<ParseError> &errors) {
+    if (!ts_node_has_error(root) || max_errors == 0) return;
+
+    TSTreeCursor cursor = ts_tree_cursor_new(root);
+    bool done = false;
+    while (!done) {
+        TSNode node = ts_tree_cursor_current_node(&cursor);
+        bool missing = ts_node_is_missing(node);
+        if (missing || ts_node_is_error(node)) {
+            errors.push_back({
+                ts_node_type(node), missing,
+                ts_node_start_byte(node), ts_node_end_byte(node),
+                ts_node_start_point(node), ts_node_end_point(node),
+            });
+            if (errors.size() >= max_errors) break;
+        } else if (ts_node_has_error(node) && ts_tree_cursor_goto_first_child(&cursor)) {
+            continue;
+        }
+        while (!ts_tree_cursor_goto_next_sibling(&cursor)) {
+            if (!ts_tree_cursor_goto_parent(&cursor)) {
+                done = true;
+                break;
+            }
+        }
+    }
+    ts_tree_cursor_delete(&cursor);
+}
+
+Napi::Object PointToObject(Napi::Env env, TSPoint point) {
+    auto object = Napi::Object::New(env);
+    object["row"] = Napi::Number::New(env, point.row);
+    object["column"] = Napi::Number::New(env, point.column);
+    return object;
+}
+
+Napi::Object ResultToObject(Napi::Env env, const ParseResult &result) {
+    auto object = Napi::Object::New(env);
+    object["rootType"] = Napi::String::New(env, result.root_type);
+    object["hasError"] = Napi::Boolean::New(env, result.has_error);
+    object["parseTime"] = Napi::Number::New(env, result.parse_ms);
+    if (!result.sexp.empty()) {
+        object["sexp"] = Napi::String::New(env, result.sexp);
+    }
+    auto errors = Napi::Array::New(env, result.errors.size());
+    for (uint32_t i = 0; i < result.errors.size(); i++) {
+        const ParseError &error = result.errors[i];
+        auto item = Napi::Object::New(env);
+        item["type"] = Napi::String::New(env, error.type);
+        item["isMissing"] = Napi::Boolean::New(env, error.missing);
+        item["startIndex"] = Napi::Number::New(env, error.start_byte);
+        item["endIndex"] = Napi::Number::New(env, error.end_byte);
+        item["startPosition"] = PointToObject(env, error.start_point);
+        item["endPosition"] = PointToObject(env, error.end_point);
+        errors[i] = item;
+    }
+    object["errors"] = errors;
+    return object;
+}
+
+// Parses on the libuv threadpool, nothing in Execute() touches JS values
+class ParseWorker : public Napi::AsyncWorker {
+  public:
+    ParseWorker(Napi::Env env, std::string source, ParseOptions options)
+        : Napi::AsyncWorker(env, "objectscript_udl.parseAsync"),
+          deferred_(Napi::Promise::Deferred::New(env)),
+          source_(std::move(source)),
+          options_(options) {}
+
+    Napi::Promise Promise() { return deferred_.Promise(); }
+
+    // Keep the typed array behind the cancellation flag alive until the
+    // parse is done
+    void HoldCancellationFlag(Napi::Object array) {
+        cancellation_array_ = Napi::Persistent(array);
+    }
+
+    void Execute() override {
+        auto start = std::chrono::steady_clock::now();
+        TSParser *parser = ThreadParser();
+        if (!parser) {
+            failure_ = ParseFailure::Failed;
+            SetError(LanguageVersionError());
+            return;
+        }
+        ParseBudget budget = {
+            start + std::chrono::microseconds(options_.timeout_micros),
+            options_.timeout_micros != 0,
+            options_.cancellation_flag,
+        };
+        TSInput input = {};
+        input.payload = &source_;
+        input.read = ReadString;
+        input.encoding = TSInputEncodingUTF8;
+        TSParseOptions parse_options = {};
+        parse_options.payload = &budget;
+        parse_options.progress_callback = ParseProgress;
+        TSTree *tree = ts_parser_parse_with_options(parser, nullptr, input, parse_options);
+        if (!tree) {
+            // A halted parse would otherwise resume with the next input
+            ts_parser_reset(parser);
+            if (budget.cancelled) {
+                failure_ = ParseFailure::Cancelled;
+                SetError("Parsing was cancelled");
+            } else if (budget.timed_out) {
+                failure_ = ParseFailure::TimedOut;
+                SetError("Parsing timed out");
+            } else {
+                failure_ = ParseFailure::Failed;
+                SetError("Parsing failed");
+            }
+            return;
+        }
+
+        TSNode root = ts_tree_root_node(tree);
+        result_.root_type = ts_node_type(root);
+        result_.has_error = ts_node_has_error(root);
+        CollectErrors(root, options_.max_errors, result_.errors);
+        if (options_.sexp) {
+            char *sexp = ts_node_string(root);
+            result_.sexp = sexp;
+            free(sexp);
+        }
+        ts_tree_delete(tree);
+
+        result_.parse_ms =
+            std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start)
+                .count();
+        // The source copy isn't needed any more, release it off the main thread
+        std::string().swap(source_);
+    }
+
+    void OnOK() override { deferred_.Resolve(ResultToObject(Env(), result_)); }
+
+    // Timeouts and cancellations carry the codes node uses for its own
+    void OnError(const Napi::Error &error) override {
+        if (failure_ == ParseFailure::TimedOut) {
+            error.Value().Set("code", Napi::String::New(Env(), "ETIMEDOUT"));
+        } else if (failure_ == ParseFailure::Cancelled) {
+            error.Value().Set("name", Napi::String::New(Env(), "AbortError"));
+            error.Value().Set("code", Napi::String::New(Env(), "ABORT_ERR"));
+        }
+        deferred_.Reject(error.Value());
+    }
+
+  private:
+    Napi::Promise::Deferred deferred_;
+    std::string source_;
+    ParseOptions options_;
+    ParseResult result_;
+    ParseFailure failure_ = ParseFailure::None;
+    Napi::ObjectReference cancellation_array_;
+};
+
+// parseAsync(input: string | Buffer,
+//            options?: {sexp?: boolean, maxErrors?: number, timeoutMicros?: number,
+//                       cancellationFlag?: BigUint64Array})
+Napi::Value ParseAsync(const Napi::CallbackInfo &info) {
+    Napi::Env env = info.Env();
+
+    std::string source;
+    if (info.Length() > 0 && info[0].IsString()) {
+        source = info[0].As<Napi::String>().Utf8Value();
+    } else if (info.Length() > 0 && info[0].IsBuffer()) {
+        auto buffer = info[0].As<Napi::Buffer<char>>();
+        source.assign(buffer.Data(), buffer.Length());
+    } else {
+        throw Napi::TypeError::New(env, "Input must be a string or a Buffer");
+    }
+    if (source.size() > UINT32_MAX) {
+        throw Napi::RangeError::New(env, "Input is larger than 4GB");
+    }
+
+    ParseOptions options;
+    Napi::TypedArray cancellation_array;
+    if (info.Length() > 1 && info[1].IsObject()) {
+        auto object = info[1].As<Napi::Object>();
+        if (object.Has("sexp")) {
+            options.sexp = object.Get("sexp").ToBoolean();
+        }
+        if (object.Has("maxErrors")) {
+            options.max_errors = object.Get("maxErrors").ToNumber().Uint32Value();
+        }
+        if (object.Has("timeoutMicros")) {
+            double timeout = object.Get("timeoutMicros").ToNumber().DoubleValue();
+            if (!(timeout >= 0)) {
+                throw Napi::RangeError::New(env, "timeoutMicros must be a positive number");
+            }
+            options.timeout_micros = static_cast<uint64_t>(timeout);
+        }
+        // One element the parser polls, written by the AbortSignal listener
+        Napi::Value flag = object.Get("cancellationFlag");
+        if (flag.IsTypedArray()) {
+            cancellation_array = flag.As<Napi::TypedArray>();
+            if (cancellation_array.TypedArrayType() != napi_biguint64_array ||
+                cancellation_array.ElementLength() != 1) {
+                throw Napi::TypeError::New(env, "cancellationFlag must be a BigUint64Array(1)");
+            }
+            auto data = static_cast<const uint8_t *>(cancellation_array.ArrayBuffer().Data());
+            options.cancellation_flag = reinterpret_cast<const std::atomic<uint64_t> *>(
+                data + cancellation_array.ByteOffset());
+        }
+    }
+
+    auto *worker = new ParseWorker(env, std::move(source), options);
+    if (options.cancellation_flag) worker->HoldCancellationFlag(cancellation_array);
+    auto promise = worker->Promise();
+    worker->Queue();
+    return promise;
+}
+
+} // namespace
+
 Napi::Object Init(Napi::Env env, Napi::Object exports) {
     exports["name"] = Napi::String::New(env, "objectscript_udl");
     auto language = Napi::External<TSLanguage>::New(env, tree_sitter_objectscript_udl());
     language.TypeTag(&LANGUAGE_TYPE_TAG);
     exports["language"] = language;
+    exports["parseAsync"] = Napi::Function::New(env, ParseAsync, "parseAsync");
     return exports;
 }
 
@@ -18,10 +18,119 @@ type NodeInfo =
       children: ChildNode[];
     });
 
+type Point = {
+  row: number;
+  column: number;
+};
+
+type ParseOptions = {
+  /** Include the S-expression of the tree (default true) */
+  sexp?: boolean;
+  /** Stop collecting errors after this many (default 100) */
+  maxErrors?: number;
+  /** Give up after this many microseconds, rejecting with code `ETIMEDOUT` */
+  timeoutMicros?: number;
+  /** Stop the parse when aborted, rejecting with an `AbortError` */
+  signal?: AbortSignal;
+};
+
+type BatchOptions = ParseOptions & {
+  /** Inputs parsed at the same time (default UV_THREADPOOL_SIZE or 4) */
+  concurrency?: number;
+};
+
+type ParseError = {
+  /** `ERROR`, or the type of the MISSING node */
+  type: string;
+  isMissing: boolean;
+  /** Offsets and columns are in bytes of the UTF-8 input */
+  startIndex: number;
+  endIndex: number;
+  startPosition: Point;
+  endPosition: Point;
+};
+
+type ParseResult = {
+  rootType: string;
+  hasError: boolean;
+  /** Milliseconds spent on the threadpool */
+  parseTime: number;
+  /** Same as `tree.rootNode.toString()`, unless `sexp: false` */
+  sexp?: string;
+  errors: ParseError[];
+};
+
+/** Bytes of the UTF-8 source, or rows and byte columns */
+type QueryRange =
+  | { startIndex?: number; endIndex?: number }
+  | { startPosition?: Point; endPosition?: Point };
+
+/** The `Query`, `SyntaxNode` and results of the `tree-sitter` package */
+type Query = {
+  captures(node: unknown, options?: object): unknown[];
+  matches(node: unknown, options?: object): unknown[];
+};
+
+type ClassMember = {
+  /** `method`, `classmethod`, `property`, `query`, `xdata`, `storage`, ... */
+  kind: string;
+  name: string;
+  /** Of the class_statement, in the old source for a removed ChangedMember */
+  startIndex: number;
+  endIndex: number;
+  startPosition: Point;
+  endPosition: Point;
+};
+
+type ChangedMember = ClassMember & { change: "changed" | "added" | "removed" };
+
+/** What `tree.edit()` was given */
+type Edit = { startIndex: number; oldEndIndex: number; newEndIndex: number };
+
+/** Reads a document for `parser.parse()` from the index (UTF-16 code units) */
+type Input = (index: number, position?: Point) => string | null;
+
+/** A span of one of the buffers of a piece table */
+type Piece = { buffer: number; start: number; length: number };
+
 type Language = {
   name: string;
   language: unknown;
   nodeTypeInfo: NodeInfo[];
+  /** Highlights query with the `;; inherits` chain resolved */
+  HIGHLIGHTS_QUERY: string;
+  /** Injections query with the `;; inherits` chain resolved */
+  INJECTIONS_QUERY: string;
+  /** Locals query with the `;; inherits` chain resolved */
+  LOCALS_QUERY: string;
+  /** Parse on the libuv threadpool instead of blocking the event loop, to plain data, not a `Tree` */
+  parseAsync(input: string | Buffer, options?: ParseOptions): Promise<ParseResult>;
+  /** Parse many inputs on the libuv threadpool, `null` for those that timed out */
+  parseBatch(
+    inputs: (string | Buffer)[],
+    options?: BatchOptions,
+  ): Promise<(ParseResult | null)[]>;
+  /** Captures of `query` within `range` of `node` */
+  capturesInRange(query: Query, node: unknown, range: QueryRange): unknown[];
+  /** Matches of `query` within `range` of `node` */
+  matchesInRange(query: Query, node: unknown, range: QueryRange): unknown[];
+  /** HIGHLIGHTS_QUERY captures within `range` of `node`, compiled on first use */
+  highlightsInRange(node: unknown, range: QueryRange): unknown[];
+  /** INJECTIONS_QUERY matches within `range` of `node`, compiled on first use */
+  injectionsInRange(node: unknown, range: QueryRange): unknown[];
+  /** Members of the class in `tree`, to take before `tree.edit()` */
+  classMembers(tree: unknown): ClassMember[];
+  /** Members of the class that differ between the old members and the reparse */
+  changedMembers(
+    oldTree: unknown,
+    newTree: unknown,
+    oldMembers: ClassMember[],
+    edits: Edit[],
+  ): ChangedMember[];
+  /** `parser.parse()` input over the chunks of a rope, without joining them */
+  chunkedInput(chunks: string[]): Input;
+  /** `parser.parse()` input over a piece table, without joining its pieces */
+  pieceTableInput(buffers: string[], pieces: Piece[]): Input;
 };
 
 declare const language: Language;
@@ -5,3 +5,337 @@ module.exports = require("node-gyp-build")(root);
 try {
   module.exports.nodeTypeInfo = require("../../src/node-types.json");
 } catch (_) {}
+
+const nativeParseAsync = module.exports.parseAsync;
+
+/**
+ * Parse off the main thread.  With `timeoutMicros`, rejects with code
+ * `ETIMEDOUT` once the parse has taken that long; with `signal`, rejects with
+ * an `AbortError` once it is aborted.  Either way the threadpool slot is
+ * released right away.
+ */
+module.exports.parseAsync = function parseAsync(input, options = {}) {
+  const { signal, ...rest } = options;
+  if (!signal) return nativeParseAsync(input, rest);
+  if (signal.aborted) {
+    return Promise.reject(
+      Object.assign(new Error("Parsing was cancelled"), {
+        name: "AbortError",
+        code: "ABORT_ERR",
+      }),
+    );
+  }
+  // Polled by the parser on the threadpool
+  const cancellationFlag = new BigUint64Array(1);
+  const onAbort = () => {
+    Atomics.store(cancellationFlag, 0, 1n);
+  };
+  signal.addEventListener("abort", onAbort, { once: true });
+  return nativeParseAsync(input, { ...rest, cancellationFlag }).finally(() =>
+    signal.removeEventListener("abort", onAbort),
+  );
+};
+
+/**
+ * Parse many inputs off the main thread, at most `concurrency` at a time so
+ * that other users of the libuv threadpool (fs, dns, zlib) aren't starved.
+ * Results are in the order of `inputs`; an input that timed out is `null`.
+ * Aborting `signal` rejects the batch and stops the parses in progress.
+ */
+module.exports.parseBatch = async function parseBatch(inputs, options = {}) {
+  const concurrency = Math.max(
+    1,
+    options.concurrency ?? (Number(process.env.UV_THREADPOOL_SIZE) || 4),
+  );
+  const results = new Array(inputs.length);
+  let next = 0;
+  const worker = async () => {
+    while (next < inputs.length) {
+      const index = next++;
+      try {
+        results[index] = await module.exports.parseAsync(inputs[index], options);
+      } catch (error) {
+        if (error.code !== "ETIMEDOUT") throw error;
+        results[index] = null;
+      }
+    }
+  };
+  await Promise.all(
+    Array.from({ length: Math.min(concurrency, inputs.length) }, worker),
+  );
+  return results;
+};
+
+// The merged query bundles (see scripts/merge-queries.js), read on first use
+const queries = {
+  HIGHLIGHTS_QUERY: "highlights.scm",
+  INJECTIONS_QUERY: "injections.scm",
+  LOCALS_QUERY: "locals.scm",
+};
+for (const [name, file] of Object.entries(queries)) {
+  let query;
+  Object.defineProperty(module.exports, name, {
+    configurable: true,
+    enumerable: true,
+    get() {
+      query ??= require("fs").readFileSync(
+        require("path").join(root, "queries", "merged", file),
+        "utf8",
+      );
+      return query;
+    },
+  });
+}
+
+// Queries restricted to part of a tree, e.g. the lines an editor shows.  The
+// cursor only returns captures of nodes that intersect the range.
+
+const compiledQueries = {};
+
+function compiledQuery(name) {
+  if (!compiledQueries[name]) {
+    const { Query } = require("tree-sitter");
+    compiledQueries[name] = new Query(module.exports, module.exports[name]);
+  }
+  return compiledQueries[name];
+}
+
+function rangeOptions(range) {
+  const { startIndex, endIndex, startPosition, endPosition } = range;
+  if (startIndex !== undefined || endIndex !== undefined) {
+    return { startIndex: startIndex ?? 0, endIndex: endIndex ?? 0xffffffff };
+  }
+  if (startPosition !== undefined || endPosition !== undefined) {
+    return {
+      startPosition: startPosition ?? { row: 0, column: 0 },
+      endPosition: endPosition ?? { row: 0xffffffff, column: 0xffffffff },
+    };
+  }
+  throw new TypeError(
+    "range needs startIndex/endIndex or startPosition/endPosition",
+  );
+}
+
+/**
+ * Captures of `query` (a `Query` from the `tree-sitter` package) within
+ * `range` of `node`: `{startIndex, endIndex}` in bytes of the UTF-8 source,
+ * or `{startPosition, endPosition}`.  Captures of nodes that only overlap
+ * the range are included whole.
+ */
+module.exports.capturesInRange = function capturesInRange(query, node, range) {
+  return query.captures(node, rangeOptions(range));
+};
+
+/** Matches of `query` within `range` of `node`, see capturesInRange */
+module.exports.matchesInRange = function matchesInRange(query, node, range) {
+  return query.matches(node, rangeOptions(range));
+};
+
+/**
+ * HIGHLIGHTS_QUERY captures within `range` of `node`, for a viewport:
+ * `{startPosition: {row: first, column: 0}, endPosition: {row: last + 1,
+ * column: 0}}`.  The query is compiled on first use and kept.
+ */
+module.exports.highlightsInRange = function highlightsInRange(node, range) {
+  return compiledQuery("HIGHLIGHTS_QUERY").captures(node, rangeOptions(range));
+};
+
+/** INJECTIONS_QUERY matches within `range` of `node`, see highlightsInRange */
+module.exports.injectionsInRange = function injectionsInRange(node, range) {
+  return compiledQuery("INJECTIONS_QUERY").matches(node, rangeOptions(range));
+};
+
+// Class members touched by an edit, for a language server that re-checks
+// only those after each reparse.
+
+function classBody(tree) {
+  for (const child of tree.rootNode.namedChildren) {
+    if (child.type === "class_definition") {
+      return child.childForFieldName("class_body");
+    }
+  }
+  return null;
+}
+
+function intersects(startIndex, endIndex, start, end) {
+  if (startIndex === endIndex || start === end) {
+    return startIndex <= end && start <= endIndex;
+  }
+  return startIndex < end && start < endIndex;
+}
+
+function memberName(member) {
+  const name =
+    member.childForFieldName("name") ??
+    member.namedChildren
+      .find((child) => child.type === "method_definition")
+      ?.childForFieldName("name");
+  return name ? name.text : "";
+}
+
+function classMember(statement) {
+  const member = statement.type === "class_statement" ? statement.firstNamedChild : null;
+  if (!member) return null;
+  return {
+    kind: member.type,
+    name: memberName(member),
+    startIndex: statement.startIndex,
+    endIndex: statement.endIndex,
+    startPosition: statement.startPosition,
+    endPosition: statement.endPosition,
+  };
+}
+
+// The members of `body` whose class_statement intersects any of `ranges`,
+// keyed by start index.  Each range costs a lookup, not a walk of the body.
+function membersInRanges(body, ranges) {
+  const members = new Map();
+  for (const [start, end] of ranges) {
+    let statement = body.firstChildForIndex(start) ?? body.lastChild;
+    // The member just before may end at the range, or have been emptied
+    if (statement?.previousSibling) statement = statement.previousSibling;
+    for (; statement && statement.startIndex <= end; statement = statement.nextSibling) {
+      const { startIndex, endIndex } = statement;
+      if (members.has(startIndex) || !intersects(startIndex, endIndex, start, end)) continue;
+      const member = classMember(statement);
+      if (member) members.set(startIndex, member);
+    }
+  }
+  return [...members.values()];
+}
+
+// Where `tree.edit()` moves a node: text inserted where it starts goes
+// before it, and an end in the replaced text moves to the new text's end
+function editedRange([start, end], { startIndex, oldEndIndex, newEndIndex }) {
+  const moved = (index) => (index >= oldEndIndex ? index + newEndIndex - oldEndIndex : newEndIndex);
+  return [start < startIndex ? start : moved(start), end <= startIndex ? end : moved(end)];
+}
+
+/**
+ * Every member of the class in `tree`, in source order, as `{kind, name,
+ * startIndex, endIndex, startPosition, endPosition}`.  Take them before
+ * `tree.edit()` and pass them to `changedMembers`: the edited tree's nodes
+ * no longer line up with the text they were parsed from, so their names
+ * can't be read from it.
+ */
+module.exports.classMembers = function classMembers(tree) {
+  const body = classBody(tree);
+  return body ? body.children.map(classMember).filter(Boolean) : [];
+};
+
+/**
+ * The members (method, classmethod, property, query, xdata, storage, ...)
+ * of the class in `newTree` that differ from `oldMembers`, which
+ * `classMembers` took from `oldTree` before it was edited with
+ * `tree.edit()` and passed to `parser.parse()` to get `newTree`.  Each is
+ * a member of `classMembers` with a `change` of "changed", "added" or
+ * "removed"; a removed member's range is where it was in the old source.
+ * A renamed member is removed under its old name and added under its new
+ * one.
+ *
+ * `edits` are the edits given to `tree.edit()`, in order.  They map the
+ * old members onto the new tree, and `tree.getChangedRanges()` only
+ * reports where the syntax differs, so an edit that keeps it (`set x = 1`
+ * to `set x = 2`) is only found through them.
+ */
+module.exports.changedMembers = function changedMembers(
+  oldTree,
+  newTree,
+  oldMembers,
+  edits,
+) {
+  const ranges = oldTree
+    .getChangedRanges(newTree)
+    .map(({ startIndex, endIndex }) => [startIndex, endIndex]);
+  for (const { startIndex, newEndIndex } of edits) {
+    ranges.push([startIndex, newEndIndex]);
+  }
+  const newBody = classBody(newTree);
+  if (!ranges.length || !newBody) return [];
+
+  const key = (member) => `${member.kind} ${member.name}`;
+  // With where each old member is in the new tree, to sort the removed ones
+  const before = [];
+  for (const member of oldMembers) {
+    let [start, end] = [member.startIndex, member.endIndex];
+    for (const edit of edits) [start, end] = editedRange([start, end], edit);
+    if (ranges.some(([rangeStart, rangeEnd]) => intersects(start, end, rangeStart, rangeEnd))) {
+      before.push({ at: start, member });
+    }
+  }
+  const after = membersInRanges(newBody, ranges);
+  const beforeKeys = new Set(before.map(({ member }) => key(member)));
+  const afterKeys = new Set(after.map(key));
+  return [
+    ...after.map((member) => ({
+      at: member.startIndex,
+      member: { ...member, change: beforeKeys.has(key(member)) ? "changed" : "added" },
+    })),
+    ...before
+      .filter(({ member }) => !afterKeys.has(key(member)))
+      .map(({ at, member }) => ({ at, member: { ...member, change: "removed" } })),
+  ]
+    .sort((a, b) => a.at - b.at)
+    .map(({ member }) => member);
+};
+
+// `read(chunk, offset)` for the reads of `parser.parse()`, given the
+// `count` chunks and their lengths in UTF-16 code units
+function chunkReader(count, lengthOf, read) {
+  const starts = new Array(count + 1);
+  starts[0] = 0;
+  for (let i = 0; i < count; i++) starts[i + 1] = starts[i] + lengthOf(i);
+  let last = 0;
+  return (index) => {
+    if (index >= starts[count]) return null;
+    // The parser mostly reads on from where it was
+    let chunk = last;
+    if (!(starts[chunk] <= index && index < starts[chunk + 1])) {
+      chunk = starts[chunk + 1] <= index && index < starts[chunk + 2] ? chunk + 1 : 0;
+    }
+    if (!(starts[chunk] <= index && index < starts[chunk + 1])) {
+      // The last chunk starting at or before `index`, past empty ones
+      let low = 0;
+      let high = count - 1;
+      while (low < high) {
+        const middle = (low + high + 1) >> 1;
+        if (starts[middle] <= index) low = middle;
+        else high = middle - 1;
+      }
+      chunk = low;
+    }
+    last = chunk;
+    return read(chunk, index - starts[chunk]);
+  };
+}
+
+/**
+ * A `parser.parse()` input over a document held in `chunks`, strings such
+ * as the leaves of a rope or the lines of a buffer, so that it isn't joined
+ * into one string before each reparse.  The parser reads on from the
+ * chunk it was in; any other position is found by bisection.  The chunks
+ * must not change until the parse returns.
+ */
+module.exports.chunkedInput = function chunkedInput(chunks) {
+  return chunkReader(
+    chunks.length,
+    (i) => chunks[i].length,
+    (i, offset) => (offset ? chunks[i].slice(offset) : chunks[i]),
+  );
+};
+
+/**
+ * A `parser.parse()` input over a piece table: `pieces` are `{buffer,
+ * start, length}` in document order, each a span of `buffers[buffer]` (the
+ * original text and the appended edits, say).  See chunkedInput().
+ */
+module.exports.pieceTableInput = function pieceTableInput(buffers, pieces) {
+  return chunkReader(
+    pieces.length,
+    (i) => pieces[i].length,
+    (i, offset) => {
+      const { buffer, start, length } = pieces[i];
+      return buffers[buffer].slice(start + offset, start + length);
+    },
+  );
+};
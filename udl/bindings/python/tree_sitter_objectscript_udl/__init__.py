@@ -1,5 +1,436 @@
 "ObjectscriptUdl grammar for tree-sitter"
 
+from bisect import bisect_right as _bisect_right
+from concurrent.futures import CancelledError as _CancelledError
+from ctypes import addressof as _addressof, c_size_t as _c_size_t
+from importlib.resources import files as _files
+from os import PathLike as _PathLike, cpu_count as _cpu_count, fsencode as _fsencode
+from typing import Iterable, List, NamedTuple, Optional, Tuple, Union
+
 from ._binding import language
 
-__all__ = ["language"]
+
+class ParseSummary(NamedTuple):
+    """What parse_files() and parse_bytes_many() return for each input"""
+
+    #: None if the parse ran out of time, was cancelled or failed
+    root_type: Optional[str]
+    has_error: bool
+    node_count: int
+    error_count: int
+    #: ``(start_byte, end_byte, (row, column))`` of the first ``max_errors``
+    #: ERROR or MISSING nodes
+    errors: List[Tuple[int, int, Tuple[int, int]]]
+    #: The S-expression of the tree, if asked for
+    sexp: Optional[str]
+    #: Milliseconds spent parsing and summarizing
+    parse_time: float
+    #: The parse took longer than ``timeout`` and was given up
+    timed_out: bool = False
+
+
+class Cancellation:
+    """Stops a parse_files() or parse_bytes_many() call from another thread
+
+    The parsers in progress poll a flag owned by this object, and inputs that
+    haven't been started are skipped; the call then raises CancelledError.
+    """
+
+    def __init__(self):
+        self._flag = _c_size_t(0)
+
+    def cancel(self) -> None:
+        self._flag.value = 1
+
+    @property
+    def cancelled(self) -> bool:
+        return self._flag.value != 0
+
+
+def _parse_many(items, paths, threads, sexp, max_errors, timeout, cancel):
+    try:
+        from ._parallel import parse_many
+    except ImportError as error:
+        raise ImportError(
+            "batch parsing needs the _parallel extension, which is only built "
+            "when the tree-sitter library is found by pkg-config"
+        ) from error
+
+    if threads is None:
+        threads = _cpu_count() or 1
+    if timeout is not None and timeout <= 0:
+        raise ValueError("timeout must be positive")
+    timeout_micros = 0 if timeout is None else max(1, int(timeout * 1e6))
+    flag = None if cancel is None else _addressof(cancel._flag)
+    summaries = parse_many(items, paths, threads, sexp, max_errors, timeout_micros, flag)
+    if cancel is not None and cancel.cancelled:
+        raise _CancelledError()
+    return [ParseSummary(*summary) for summary in summaries]
+
+
+def parse_files(
+    paths: Iterable[Union[str, bytes, _PathLike]],
+    threads: Optional[int] = None,
+    *,
+    sexp: bool = False,
+    max_errors: int = 100,
+    timeout: Optional[float] = None,
+    cancel: Optional[Cancellation] = None,
+) -> List[ParseSummary]:
+    """Read and parse files on ``threads`` threads (default: one per core)
+    without holding the GIL, returning a summary per file in order
+
+    A file taking more than ``timeout`` seconds to parse is given up and its
+    summary has ``timed_out`` set."""
+    return _parse_many(
+        [_fsencode(path) for path in paths], True, threads, sexp, max_errors, timeout, cancel
+    )
+
+
+def parse_bytes_many(
+    sources: Iterable[bytes],
+    threads: Optional[int] = None,
+    *,
+    sexp: bool = False,
+    max_errors: int = 100,
+    timeout: Optional[float] = None,
+    cancel: Optional[Cancellation] = None,
+) -> List[ParseSummary]:
+    """Parse UTF-8 sources on ``threads`` threads (default: one per core)
+    without holding the GIL, returning a summary per source in order
+
+    A source taking more than ``timeout`` seconds to parse is given up and
+    its summary has ``timed_out`` set."""
+    return _parse_many(list(sources), False, threads, sexp, max_errors, timeout, cancel)
+
+
+# Queries restricted to part of a tree, e.g. the lines an editor shows.  The
+# cursor only returns captures of nodes that intersect the range.  These use
+# the ``core`` extra, py-tree-sitter 0.25 or later, the first to load ABI 15.
+
+_compiled_queries = {}
+
+
+def _compiled_query(name):
+    query = _compiled_queries.get(name)
+    if query is None:
+        from tree_sitter import Language, Query
+
+        source = globals()[name] if name in globals() else __getattr__(name)
+        query = Query(Language(language()), source)
+        _compiled_queries[name] = query
+    return query
+
+
+def _range_cursor(query, start_byte, end_byte, start_point, end_point):
+    from tree_sitter import QueryCursor
+
+    cursor = QueryCursor(query)
+    if start_byte is not None or end_byte is not None:
+        cursor.set_byte_range(start_byte or 0, 0xFFFFFFFF if end_byte is None else end_byte)
+    elif start_point is not None or end_point is not None:
+        cursor.set_point_range(start_point or (0, 0), end_point or (0xFFFFFFFF, 0xFFFFFFFF))
+    else:
+        raise ValueError("give start_byte/end_byte or start_point/end_point")
+    return cursor
+
+
+def captures_in_range(
+    query,
+    node,
+    *,
+    start_byte: Optional[int] = None,
+    end_byte: Optional[int] = None,
+    start_point: Optional[Tuple[int, int]] = None,
+    end_point: Optional[Tuple[int, int]] = None,
+):
+    """Captures of ``query`` (a ``tree_sitter.Query``) within a byte range,
+    or a ``(row, column)`` range, of ``node``, by capture name
+
+    Captures of nodes that only overlap the range are included whole."""
+    cursor = _range_cursor(query, start_byte, end_byte, start_point, end_point)
+    return cursor.captures(node)
+
+
+def matches_in_range(
+    query,
+    node,
+    *,
+    start_byte: Optional[int] = None,
+    end_byte: Optional[int] = None,
+    start_point: Optional[Tuple[int, int]] = None,
+    end_point: Optional[Tuple[int, int]] = None,
+):
+    """Matches of ``query`` within a range of ``node``, see captures_in_range()"""
+    cursor = _range_cursor(query, start_byte, end_byte, start_point, end_point)
+    return cursor.matches(node)
+
+
+def highlights_in_range(node, **range):
+    """HIGHLIGHTS_QUERY captures within a range of ``node``, for a viewport
+    ``start_point=(first, 0), end_point=(last + 1, 0)``
+
+    The query is compiled on first use and kept."""
+    return captures_in_range(_compiled_query("HIGHLIGHTS_QUERY"), node, **range)
+
+
+def injections_in_range(node, **range):
+    """INJECTIONS_QUERY matches within a range of ``node``, see highlights_in_range()"""
+    return matches_in_range(_compiled_query("INJECTIONS_QUERY"), node, **range)
+
+
+class ClassMember(NamedTuple):
+    """What class_members() returns for each member"""
+
+    #: ``method``, ``classmethod``, ``property``, ``query``, ``xdata``, ...
+    kind: str
+    name: str
+    #: Of the class_statement
+    start_byte: int
+    end_byte: int
+    start_point: Tuple[int, int]
+    end_point: Tuple[int, int]
+
+
+class ChangedMember(NamedTuple):
+    """What changed_members() returns for each member"""
+
+    #: ``method``, ``classmethod``, ``property``, ``query``, ``xdata``, ...
+    kind: str
+    name: str
+    #: ``changed``, ``added`` or ``removed``
+    change: str
+    #: Of the class_statement, in the old source if removed
+    start_byte: int
+    end_byte: int
+    start_point: Tuple[int, int]
+    end_point: Tuple[int, int]
+
+
+def _class_body(tree):
+    for child in tree.root_node.named_children:
+        if child.type == "class_definition":
+            return child.child_by_field_name("class_body")
+    return None
+
+
+def _intersects(node_start, node_end, start, end):
+    if node_start == node_end or start == end:
+        return node_start <= end and start <= node_end
+    return node_start < end and start < node_end
+
+
+def _member_name(member):
+    name = member.child_by_field_name("name")
+    if name is None:
+        for child in member.named_children:
+            if child.type == "method_definition":
+                name = child.child_by_field_name("name")
+                break
+    return name.text.decode() if name is not None else ""
+
+
+def _class_member(statement):
+    if statement.type != "class_statement" or not statement.named_child_count:
+        return None
+    member = statement.named_children[0]
+    return ClassMember(
+        member.type,
+        _member_name(member),
+        statement.start_byte,
+        statement.end_byte,
+        statement.start_point,
+        statement.end_point,
+    )
+
+
+def _members_in_ranges(body, ranges):
+    statements = body.children
+    members = {}
+    for start, end in ranges:
+        # The first statement ending at or after the range, by bisection
+        low, high = 0, len(statements)
+        while low < high:
+            middle = (low + high) // 2
+            if statements[middle].end_byte < start:
+                low = middle + 1
+            else:
+                high = middle
+        for statement in statements[low:]:
+            if statement.start_byte > end:
+                break
+            if statement.start_byte in members or not _intersects(
+                statement.start_byte, statement.end_byte, start, end
+            ):
+                continue
+            member = _class_member(statement)
+            if member is not None:
+                members[statement.start_byte] = member
+    return list(members.values())
+
+
+def _edited_range(start, end, edit):
+    # Where Tree.edit() moves a node: text inserted where it starts goes
+    # before it, and an end in the replaced text moves to the new text's end
+    edit_start, old_end, new_end = edit
+
+    def moved(offset):
+        return offset + new_end - old_end if offset >= old_end else new_end
+
+    return (start if start < edit_start else moved(start), end if end <= edit_start else moved(end))
+
+
+def class_members(tree) -> List[ClassMember]:
+    """Every member of the class in ``tree``, in source order
+
+    Take them before ``tree.edit()`` and pass them to changed_members():
+    the edited tree's nodes no longer line up with the text they were
+    parsed from, so their names can't be read from it."""
+    body = _class_body(tree)
+    if body is None:
+        return []
+    return [member for member in map(_class_member, body.children) if member is not None]
+
+
+def changed_members(old_tree, new_tree, old_members, edits) -> List[ChangedMember]:
+    """The members of the class in ``new_tree`` that differ from
+    ``old_members``, which class_members() took from ``old_tree`` before it
+    was edited with ``tree.edit()`` and passed to ``parser.parse()`` to get
+    ``new_tree``
+
+    ``edits`` are the edits given to ``tree.edit()``, in order, as
+    ``(start_byte, old_end_byte, new_end_byte)``.  They map the old members
+    onto the new tree, and ``Tree.changed_ranges()`` only reports where the
+    syntax differs, so an edit that keeps it (``set x = 1`` to ``set x =
+    2``) is only found through them.  A renamed member is removed under its
+    old name and added under its new one."""
+    edits = [tuple(edit) for edit in edits]
+    ranges = [(r.start_byte, r.end_byte) for r in old_tree.changed_ranges(new_tree)]
+    ranges.extend((start, new_end) for start, _, new_end in edits)
+    new_body = _class_body(new_tree)
+    if not ranges or new_body is None:
+        return []
+
+    # With where each old member is in the new tree, to sort the removed ones
+    before = []
+    for member in old_members:
+        start, end = member.start_byte, member.end_byte
+        for edit in edits:
+            start, end = _edited_range(start, end, edit)
+        if any(_intersects(start, end, *range) for range in ranges):
+            before.append((start, member))
+    after = _members_in_ranges(new_body, ranges)
+    before_keys = {member[:2] for _, member in before}
+    after_keys = {member[:2] for member in after}
+    changes = [
+        (start, ChangedMember(kind, name, "changed" if (kind, name) in before_keys else "added",
+                              start, *rest))
+        for kind, name, start, *rest in after
+    ] + [
+        (start, ChangedMember(member.kind, member.name, "removed", *member[2:]))
+        for start, member in before
+        if member[:2] not in after_keys
+    ]
+    return [member for _, member in sorted(changes, key=lambda change: change[0])]
+
+
+def _chunk_reader(lengths, read):
+    starts = [0]
+    for length in lengths:
+        starts.append(starts[-1] + length)
+    count = len(starts) - 1
+    last = 0
+
+    def read_callback(byte_offset, point):
+        nonlocal last
+        if byte_offset >= starts[-1]:
+            return None
+        # The parser mostly reads on from where it was
+        chunk = last
+        if not starts[chunk] <= byte_offset < starts[chunk + 1]:
+            if chunk + 1 < count and starts[chunk + 1] <= byte_offset < starts[chunk + 2]:
+                chunk += 1
+            else:
+                # The last chunk starting at or before it, past empty ones
+                chunk = _bisect_right(starts, byte_offset, 0, count) - 1
+        last = chunk
+        return read(chunk, byte_offset - starts[chunk])
+
+    return read_callback
+
+
+def chunked_input(chunks):
+    """A read callback for ``parser.parse()`` over a document held in
+    ``chunks``, UTF-8 ``bytes`` such as the leaves of a rope or the lines of
+    a buffer, so that it isn't joined before each reparse
+
+    The parser reads on from the chunk it was in; any other offset is found
+    by bisection.  The chunks must not change until the parse returns."""
+    chunks = list(chunks)
+
+    def read(i, offset):
+        chunk = chunks[i]
+        return chunk if not offset and type(chunk) is bytes else bytes(chunk[offset:])
+
+    return _chunk_reader([len(chunk) for chunk in chunks], read)
+
+
+def piece_table_input(buffers, pieces):
+    """A read callback for ``parser.parse()`` over a piece table: ``pieces``
+    are ``(buffer, start, length)`` in document order, each a span of
+    ``buffers[buffer]`` (UTF-8 ``bytes``, e.g. the original text and the
+    appended edits).  See chunked_input()."""
+    pieces = list(pieces)
+
+    def read(i, offset):
+        buffer, start, length = pieces[i]
+        return bytes(buffers[buffer][start + offset : start + length])
+
+    return _chunk_reader([length for _, _, length in pieces], read)
+
+
+def _get_query(name, file):
+    query = _files(f"{__package__}.queries") / "merged" / file
+    globals()[name] = query.read_text()
+    return globals()[name]
+
+
+def __getattr__(name):
+    # The merged query bundles (see scripts/merge-queries.js), read on first use
+    if name == "HIGHLIGHTS_QUERY":
+        return _get_query("HIGHLIGHTS_QUERY", "highlights.scm")
+    if name == "INJECTIONS_QUERY":
+        return _get_query("INJECTIONS_QUERY", "injections.scm")
+    if name == "LOCALS_QUERY":
+        return _get_query("LOCALS_QUERY", "locals.scm")
+
+    raise AttributeError(f"module {__name__!r} has no attribute {name!r}")
+
+
+__all__ = [
+    "language",
+    "parse_files",
+    "parse_bytes_many",
+    "ParseSummary",
+    "Cancellation",
+    "captures_in_range",
+    "matches_in_range",
+    "highlights_in_range",
+    "injections_in_range",
+    "class_members",
+    "changed_members",
+    "ClassMember",
+    "ChangedMember",
+    "chunked_input",
+    "piece_table_input",
+    "HIGHLIGHTS_QUERY",
+    "INJECTIONS_QUERY",
+    "LOCALS_QUERY",
+]
+
+
+def __dir__():
+    return sorted(__all__ + [
+        "__all__", "__builtins__", "__cached__", "__doc__", "__file__",
+        "__loader__", "__name__", "__package__", "__path__", "__spec__",
+    ])
@@ -1 +1,115 @@
+from os import PathLike
+from typing import Any, Callable, Dict, Final, Iterable, List, NamedTuple, Optional, Tuple, Union
+
+HIGHLIGHTS_QUERY: Final[str]
+INJECTIONS_QUERY: Final[str]
+LOCALS_QUERY: Final[str]
+
+class ParseSummary(NamedTuple):
+    root_type: Optional[str]
+    has_error: bool
+    node_count: int
+    error_count: int
+    errors: List[Tuple[int, int, Tuple[int, int]]]
+    sexp: Optional[str]
+    parse_time: float
+    timed_out: bool = False
+
+class ClassMember(NamedTuple):
+    kind: str
+    name: str
+    start_byte: int
+    end_byte: int
+    start_point: Tuple[int, int]
+    end_point: Tuple[int, int]
+
+class ChangedMember(NamedTuple):
+    kind: str
+    name: str
+    change: str
+    start_byte: int
+    end_byte: int
+    start_point: Tuple[int, int]
+    end_point: Tuple[int, int]
+
+class Cancellation:
+    def cancel(self) -> None: ...
+    @property
+    def cancelled(self) -> bool: ...
+
 def language() -> int: ...
+
+def parse_files(
+    paths: Iterable[Union[str, bytes, PathLike]],
+    threads: Optional[int] = None,
+    *,
+    sexp: bool = False,
+    max_errors: int = 100,
+    timeout: Optional[float] = None,
+    cancel: Optional[Cancellation] = None,
+) -> List[ParseSummary]: ...
+
+def parse_bytes_many(
+    sources: Iterable[bytes],
+    threads: Optional[int] = None,
+    *,
+    sexp: bool = False,
+    max_errors: int = 100,
+    timeout: Optional[float] = None,
+    cancel: Optional[Cancellation] = None,
+) -> List[ParseSummary]: ...
+
+def captures_in_range(
+    query: Any,
+    node: Any,
+    *,
+    start_byte: Optional[int] = None,
+    end_byte: Optional[int] = None,
+    start_point: Optional[Tuple[int, int]] = None,
+    end_point: Optional[Tuple[int, int]] = None,
+) -> Dict[str, List[Any]]: ...
+
+def matches_in_range(
+    query: Any,
+    node: Any,
+    *,
+    start_byte: Optional[int] = None,
+    end_byte: Optional[int] = None,
+    start_point: Optional[Tuple[int, int]] = None,
+    end_point: Optional[Tuple[int, int]] = None,
+) -> List[Tuple[int, Dict[str, List[Any]]]]: ...
+
+def highlights_in_range(
+    node: Any,
+    *,
+    start_byte: Optional[int] = None,
+    end_byte: Optional[int] = None,
+    start_point: Optional[Tuple[int, int]] = None,
+    end_point: Optional[Tuple[int, int]] = None,
+) -> Dict[str, List[Any]]: ...
+
+def injections_in_range(
+    node: Any,
+    *,
+    start_byte: Optional[int] = None,
+    end_byte: Optional[int] = None,
+    start_point: Optional[Tuple[int, int]] = None,
+    end_point: Optional[Tuple[int, int]] = None,
+) -> List[Tuple[int, Dict[str, List[Any]]]]: ...
+
+def class_members(tree: Any) -> List[ClassMember]: ...
+
+def changed_members(
+    old_tree: Any,
+    new_tree: Any,
+    old_members: Iterable[ClassMember],
+    edits: Iterable[Tuple[int, int, int]],
+) -> List[ChangedMember]: ...
+
+ReadCallback = Callable[[int, Tuple[int, int]], Optional[bytes]]
+
+def chunked_input(chunks: Iterable[Union[bytes, bytearray, memoryview]]) -> ReadCallback: ...
+
+def piece_table_input(
+    buffers: List[Union[bytes, bytearray, memoryview]], pieces: Iterable[Tuple[int, int, int]]
+) -> ReadCallback: ...
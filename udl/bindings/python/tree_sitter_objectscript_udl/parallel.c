@@ -0,0 +1,449 @@
+// Batch parsing without the GIL
+//
+// parse_many() parses a list of files or byte strings on a pool of threads,
+// each with its own TSParser for the udl language, and returns a compact
+// summary per input (the trees themselves can't be handed to py-tree-sitter,
+// which has its own copy of the runtime).  The GIL is only held to unpack
+// the arguments and to build the results.
+//
+// Each parse can be given a deadline, and all of them can be cancelled from
+// another thread through a flag the caller owns (see Cancellation in
+// __init__.py); the parser polls both through its progress callback.
+#include <Python.h>
+#include <tree_sitter/api.h>
+
+#include <errno.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <pthread.h>
+#endif
+
+struct Parse_Error {
+  uint32_t start_byte;
+  uint32_t end_byte;
+  TSPoint start_point;
+};
+
+struct Parse_Job {
+  // Input, a path or the bytes themselves
+  const char *data;
+  Py_ssize_t length;
+
+  // Output
+  int read_errno;
+  bool timed_out;
+  const char *root_type;   // NULL if not parsed
+  bool has_error;
+  uint32_t node_count;
+  uint32_t error_count;
+  struct Parse_Error *errors;   // First `max_errors` of them
+  char *sexp;
+  double parse_ms;
+};
+
+struct Parse_Pool {
+  const TSLanguage *language;
+  struct Parse_Job *jobs;
+  Py_ssize_t job_count;
+  bool paths;
+  bool sexp;
+  uint32_t max_errors;
+  uint64_t timeout_micros;            // 0 for no limit
+  const size_t *cancellation_flag;    // NULL if it can't be cancelled
+#ifdef _WIN32
+  volatile LONG next;
+#else
+  long next;
+#endif
+};
+
+static const TSLanguage *language;
+
+static double now_ms(void) {
+#ifdef _WIN32
+  LARGE_INTEGER counter, frequency;
+  QueryPerformanceCounter(&counter);
+  QueryPerformanceFrequency(&frequency);
+  return counter.QuadPart * 1000.0 / frequency.QuadPart;
+#else
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec * 1000.0 + ts.tv_nsec / 1e6;
+#endif
+}
+
+static Py_ssize_t next_job(struct Parse_Pool *pool) {
+#ifdef _WIN32
+  return InterlockedIncrement(&pool->next) - 1;
+#else
+  return __atomic_fetch_add(&pool->next, 1, __ATOMIC_RELAXED);
+#endif
+}
+
+static bool is_cancelled(const struct Parse_Pool *pool) {
+  if (!pool->cancellation_flag) return false;
+#ifdef _WIN32
+  return *(const volatile size_t *)pool->cancellation_flag != 0;
+#else
+  return __atomic_load_n(pool->cancellation_flag, __ATOMIC_RELAXED) != 0;
+#endif
+}
+
+static char *read_file(const char *path, size_t *length, int *error) {
+  FILE *file = fopen(path, "rb");
+  if (!file) {
+    *error = errno;
+    return NULL;
+  }
+  size_t capacity = 64 * 1024, size = 0;
+  char *data = malloc(capacity);
+  while (data) {
+    size += fread(data + size, 1, capacity - size, file);
+    if (size < capacity) break;
+    char *grown = realloc(data, capacity * 2);
+    if (!grown) {
+      free(data);
+      data = NULL;
+      break;
+    }
+    data = grown;
+    capacity *= 2;
+  }
+  if (!data) {
+    *error = ENOMEM;
+  } else if (ferror(file)) {
+    *error = EIO;
+    free(data);
+    data = NULL;
+  }
+  fclose(file);
+  *length = size;
+  return data;
+}
+
+// Polled by the parser through its progress callback
+struct Parse_Budget {
+  const struct Parse_Pool *pool;
+  double deadline_ms;   // 0 for none
+  bool timed_out;
+};
+
+// Returns true to halt the parse
+static bool parse_progress(TSParseState *state) {
+  struct Parse_Budget *budget = state->payload;
+  if (is_cancelled(budget->pool)) return true;
+  if (budget->deadline_ms && now_ms() >= budget->deadline_ms) {
+    budget->timed_out = true;
+    return true;
+  }
+  return false;
+}
+
+struct String_Input {
+  const char *data;
+  uint32_t length;
+};
+
+static const char *read_string(void *payload, uint32_t byte_index, TSPoint position,
+                               uint32_t *bytes_read) {
+  const struct String_Input *input = payload;
+  (void)position;
+  if (byte_index >= input->length) {
+    *bytes_read = 0;
+    return "";
+  }
+  *bytes_read = input->length - byte_index;
+  return input->data + byte_index;
+}
+
+// Count the nodes and record the ERROR/MISSING ones, in a single walk
+static void summarize(struct Parse_Job *job, TSNode root, uint32_t max_errors) {
+  TSTreeCursor cursor = ts_tree_cursor_new(root);
+  for (;;) {
+    TSNode node = ts_tree_cursor_current_node(&cursor);
+    job->node_count++;
+    if (ts_node_is_error(node) || ts_node_is_missing(node)) {
+      if (job->error_count < max_errors) {
+        job->errors[job->error_count] = (struct Parse_Error){
+          ts_node_start_byte(node), ts_node_end_byte(node), ts_node_start_point(node),
+        };
+      }
+      job->error_count++;
+    }
+    if (ts_tree_cursor_goto_first_child(&cursor)) continue;
+    while (!ts_tree_cursor_goto_next_sibling(&cursor)) {
+      if (!ts_tree_cursor_goto_parent(&cursor)) {
+        ts_tree_cursor_delete(&cursor);
+        return;
+      }
+    }
+  }
+}
+
+static void parse_job(struct Parse_Pool *pool, TSParser *parser, struct Parse_Job *job) {
+  const char *data = job->data;
+  size_t length = (size_t)job->length;
+  char *owned = NULL;
+  if (pool->paths) {
+    owned = read_file(job->data, &length, &job->read_errno);
+    if (!owned) return;
+    data = owned;
+  }
+  if (length > UINT32_MAX) {
+    job->read_errno = EFBIG;
+    free(owned);
+    return;
+  }
+
+  double start = now_ms();
+  struct Parse_Budget budget = {
+    .pool = pool,
+    .deadline_ms = pool->timeout_micros ? start + pool->timeout_micros / 1000.0 : 0,
+  };
+  struct String_Input string = {data, (uint32_t)length};
+  TSInput input = {
+    .payload = &string,
+    .read = read_string,
+    .encoding = TSInputEncodingUTF8,
+  };
+  TSParseOptions options = {.payload = &budget, .progress_callback = parse_progress};
+  TSTree *tree = ts_parser_parse_with_options(parser, NULL, input, options);
+  if (!tree) {
+    // Out of time, cancelled or failed, and the parser would otherwise
+    // resume this parse with the next input
+    ts_parser_reset(parser);
+    job->parse_ms = now_ms() - start;
+    job->timed_out = budget.timed_out;
+    free(owned);
+    return;
+  }
+  TSNode root = ts_tree_root_node(tree);
+  job->root_type = ts_node_type(root);
+  job->has_error = ts_node_has_error(root);
+  job->errors = calloc(pool->max_errors ? pool->max_errors : 1, sizeof(struct Parse_Error));
+  summarize(job, root, job->errors ? pool->max_errors : 0);
+  if (pool->sexp) job->sexp = ts_node_string(root);
+  ts_tree_delete(tree);
+  job->parse_ms = now_ms() - start;
+
+  free(owned);
+}
+
+static void parse_worker(struct Parse_Pool *pool) {
+  TSParser *parser = ts_parser_new();
+  if (!ts_parser_set_language(parser, pool->language)) {
+    // parse_many() checked it loads, this only guards the jobs
+    ts_parser_delete(parser);
+    return;
+  }
+  for (Py_ssize_t i = next_job(pool); i < pool->job_count; i = next_job(pool)) {
+    if (is_cancelled(pool)) break;
+    parse_job(pool, parser, &pool->jobs[i]);
+  }
+  ts_parser_delete(parser);
+}
+
+#ifdef _WIN32
+static DWORD WINAPI thread_main(LPVOID pool) {
+  parse_worker(pool);
+  return 0;
+}
+#else
+static void *thread_main(void *pool) {
+  parse_worker(pool);
+  return NULL;
+}
+#endif
+
+// Run the pool on `thread_count` threads, the calling one included
+static void run_pool(struct Parse_Pool *pool, int thread_count) {
+#ifdef _WIN32
+  HANDLE *threads = calloc(thread_count, sizeof(HANDLE));
+#else
+  pthread_t *threads = calloc(thread_count, sizeof(pthread_t));
+#endif
+  int started = 0;
+  for (int i = 1; threads && i < thread_count; i++, started++) {
+#ifdef _WIN32
+    threads[started] = CreateThread(NULL, 0, thread_main, pool, 0, NULL);
+    if (!threads[started]) break;
+#else
+    if (pthread_create(&threads[started], NULL, thread_main, pool)) break;
+#endif
+  }
+  parse_worker(pool);
+  for (int i = 0; i < started; i++) {
+#ifdef _WIN32
+    WaitForSingleObject(threads[i], INFINITE);
+    CloseHandle(threads[i]);
+#else
+    pthread_join(threads[i], NULL);
+#endif
+  }
+  free(threads);
+}
+
+static PyObject *job_summary(const struct Parse_Job *job, uint32_t max_errors) {
+  uint32_t count = job->error_count < max_errors ? job->error_count : max_errors;
+  if (!job->errors) count = 0;
+  PyObject *errors = PyList_New(count);
+  if (!errors) return NULL;
+  for (uint32_t i = 0; i < count; i++) {
+    const struct Parse_Error *error = &job->errors[i];
+    PyObject *item = Py_BuildValue("(II(II))", error->start_byte, error->end_byte,
+                                   error->start_point.row, error->start_point.column);
+    if (!item) {
+      Py_DECREF(errors);
+      return NULL;
+    }
+    PyList_SetItem(errors, i, item);
+  }
+
+  PyObject *sexp = Py_None;
+  if (job->sexp) {
+    sexp = PyUnicode_FromString(job->sexp);
+    if (!sexp) {
+      Py_DECREF(errors);
+      return NULL;
+    }
+  } else {
+    Py_INCREF(sexp);
+  }
+  return Py_BuildValue("(zOIINNdO)", job->root_type, job->has_error ? Py_True : Py_False,
+                       job->node_count, job->error_count, errors, sexp, job->parse_ms,
+                       job->timed_out ? Py_True : Py_False);
+}
+
+// parse_many(items: list[bytes], paths: bool, threads: int, sexp: bool, max_errors: int,
+//            timeout_micros: int, cancellation_flag: Optional[int])
+//
+// `cancellation_flag` is the address of a size_t that outlives the call.
+// Inputs left when it is set aren't parsed and have no root type.
+static PyObject *_parallel_parse_many(PyObject *self, PyObject *args) {
+  PyObject *items, *flag;
+  int paths, thread_count, sexp;
+  unsigned int max_errors;
+  unsigned long long timeout_micros;
+  if (!PyArg_ParseTuple(args, "O!pipIKO", &PyList_Type, &items, &paths, &thread_count,
+                        &sexp, &max_errors, &timeout_micros, &flag)) {
+    return NULL;
+  }
+  // Fail before starting the pool if the runtime can't load the grammar
+  TSParser *probe = ts_parser_new();
+  bool loaded = ts_parser_set_language(probe, language);
+  ts_parser_delete(probe);
+  if (!loaded) {
+    PyErr_Format(PyExc_RuntimeError,
+                 "the grammar has ABI version %u, the tree-sitter runtime _parallel "
+                 "was built with loads versions %d to %d",
+                 ts_language_abi_version(language),
+                 TREE_SITTER_MIN_COMPATIBLE_LANGUAGE_VERSION, TREE_SITTER_LANGUAGE_VERSION);
+    return NULL;
+  }
+
+  const size_t *cancellation_flag = NULL;
+  if (flag != Py_None) {
+    cancellation_flag = PyLong_AsVoidPtr(flag);
+    if (!cancellation_flag) {
+      if (!PyErr_Occurred()) PyErr_SetString(PyExc_ValueError, "null cancellation flag");
+      return NULL;
+    }
+  }
+
+  // Hold our own references, the list may change while the GIL is released
+  Py_ssize_t job_count = PyList_Size(items);
+  PyObject **refs = PyMem_Calloc(job_count ? job_count : 1, sizeof(PyObject *));
+  struct Parse_Job *jobs = PyMem_Calloc(job_count ? job_count : 1, sizeof(struct Parse_Job));
+  if (!refs || !jobs) {
+    PyMem_Free(refs);
+    PyMem_Free(jobs);
+    return PyErr_NoMemory();
+  }
+  PyObject *result = NULL;
+  for (Py_ssize_t i = 0; i < job_count; i++) {
+    refs[i] = PyList_GetItem(items, i);
+    Py_INCREF(refs[i]);
+    char *data;
+    if (PyBytes_AsStringAndSize(refs[i], &data, &jobs[i].length) < 0) goto done;
+    jobs[i].data = data;
+  }
+
+  struct Parse_Pool pool = {
+    .language = language,
+    .jobs = jobs,
+    .job_count = job_count,
+    .paths = paths,
+    .sexp = sexp,
+    .max_errors = max_errors,
+    .timeout_micros = timeout_micros,
+    .cancellation_flag = cancellation_flag,
+  };
+  if (thread_count < 1) thread_count = 1;
+  if (thread_count > job_count) thread_count = job_count ? (int)job_count : 1;
+
+  Py_BEGIN_ALLOW_THREADS
+  run_pool(&pool, thread_count);
+  Py_END_ALLOW_THREADS
+
+  for (Py_ssize_t i = 0; i < job_count; i++) {
+    if (jobs[i].read_errno) {
+      errno = jobs[i].read_errno;
+      PyErr_SetFromErrnoWithFilename(PyExc_OSError, jobs[i].data);
+      goto done;
+    }
+  }
+  result = PyList_New(job_count);
+  for (Py_ssize_t i = 0; result && i < job_count; i++) {
+    PyObject *summary = job_summary(&jobs[i], max_errors);
+    if (!summary) {
+      Py_CLEAR(result);
+      break;
+    }
+    PyList_SetItem(result, i, summary);
+  }
+
+done:
+  for (Py_ssize_t i = 0; i < job_count; i++) {
+    Py_XDECREF(refs[i]);
+    free(jobs[i].errors);
+    free(jobs[i].sexp);
+  }
+  PyMem_Free(refs);
+  PyMem_Free(jobs);
+  return result;
+}
+
+static PyMethodDef methods[] = {
+    {"parse_many", _parallel_parse_many, METH_VARARGS,
+     "Parse files or byte strings on a pool of threads, without the GIL."},
+    {NULL, NULL, 0, NULL}
+};
+
+static struct PyModuleDef module = {
+    .m_base = PyModuleDef_HEAD_INIT,
+    .m_name = "_parallel",
+    .m_doc = NULL,
+    .m_size = -1,
+    .m_methods = methods
+};
+
+// The language comes from _binding, so that the parse tables aren't linked
+// into this module a second time
+PyMODINIT_FUNC PyInit__parallel(void) {
+  PyObject *binding = PyImport_ImportModule("tree_sitter_objectscript_udl._binding");
+  if (!binding) return NULL;
+  PyObject *pointer = PyObject_CallMethod(binding, "language", NULL);
+  Py_DECREF(binding);
+  if (!pointer) return NULL;
+  language = PyLong_AsVoidPtr(pointer);
+  Py_DECREF(pointer);
+  if (!language) return NULL;
+  return PyModule_Create(&module);
+}
@@ -11,12 +11,12 @@ fn main() {
     c_config.file(&parser_path);
     println!("cargo:rerun-if-changed={}", parser_path.to_str().unwrap());
 
-    // NOTE: if your language uses an external scanner, uncomment this block:
-    /*
     let scanner_path = src_dir.join("scanner.c");
     c_config.file(&scanner_path);
     println!("cargo:rerun-if-changed={}", scanner_path.to_str().unwrap());
-    */
+    // The udl scanner builds on the core one
+    println!("cargo:rerun-if-changed=../core/src/scanner.h");
+    println!("cargo:rerun-if-changed={}", src_dir.join("expr_scanner.h").to_str().unwrap());
 
     c_config.compile("tree-sitter-objectscript_udl");
 }
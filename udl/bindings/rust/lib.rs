@@ -17,7 +17,14 @@
 //! [Parser]: https://docs.rs/tree-sitter/*/tree_sitter/struct.Parser.html
 //! [tree-sitter]: https://tree-sitter.github.io/
 
-use tree_sitter::Language;
+use std::collections::HashSet;
+use std::ops::Range;
+use std::sync::atomic::AtomicUsize;
+use std::sync::OnceLock;
+use std::time::Duration;
+
+use streaming_iterator::StreamingIterator;
+use tree_sitter::{InputEdit, Language, Node, Parser, Point, Query, QueryCursor, Tree};
 
 extern "C" {
     fn tree_sitter_objectscript_udl() -> Language;
@@ -35,15 +42,345 @@ pub fn language() -> Language {
 /// [`node-types.json`]: https://tree-sitter.github.io/tree-sitter/using-parsers#static-node-types
 pub const NODE_TYPES: &str = include_str!("../../src/node-types.json");
 
-// Uncomment these to include any queries that this grammar contains
+/// The highlights query, with the `;; inherits` chain already resolved.
+///
+/// Generated by `scripts/merge-queries.js`, so it can be compiled as is.
+pub const HIGHLIGHTS_QUERY: &str = include_str!("../../queries/merged/highlights.scm");
+
+/// The injections query, with the `;; inherits` chain already resolved.
+pub const INJECTIONS_QUERY: &str = include_str!("../../queries/merged/injections.scm");
+
+/// The locals query, with the `;; inherits` chain already resolved.
+pub const LOCALS_QUERY: &str = include_str!("../../queries/merged/locals.scm");
+
+/// Parse `source` with `parser`, giving up after `timeout` or once `cancel`
+/// is set to a non-zero value from another thread.
+///
+/// Returns `None` if the parse was given up.  The parser polls both as it
+/// goes, so a pathological input costs about `timeout` at most; either way
+/// the parser is left without a limit and ready for the next input.
+pub fn parse_with_budget(
+    parser: &mut Parser,
+    source: &[u8],
+    timeout: Option<Duration>,
+    cancel: Option<&AtomicUsize>,
+) -> Option<Tree> {
+    // At least a microsecond, 0 is no limit
+    parser.set_timeout_micros(timeout.map_or(0, |timeout| (timeout.as_micros() as u64).max(1)));
+    // Safety: the flag is unset again before it goes out of scope
+    unsafe { parser.set_cancellation_flag(cancel) };
+    let tree = parser.parse(source, None);
+    parser.set_timeout_micros(0);
+    unsafe { parser.set_cancellation_flag(None) };
+    if tree.is_none() {
+        // Otherwise the next parse would resume this one
+        parser.reset();
+    }
+    tree
+}
+
+/// A capture found by [`captures_in_byte_range`] or [`captures_in_point_range`].
+#[derive(Clone, Copy, Debug)]
+pub struct RangeCapture<'tree> {
+    pub node: Node<'tree>,
+    /// Index into `query.capture_names()`
+    pub index: u32,
+    pub pattern_index: usize,
+}
+
+fn collect_captures<'tree>(
+    cursor: &mut QueryCursor,
+    query: &Query,
+    node: Node<'tree>,
+    source: &[u8],
+) -> Vec<RangeCapture<'tree>> {
+    let mut result = Vec::new();
+    let mut captures = cursor.captures(query, node, source);
+    while let Some((query_match, index)) = captures.next() {
+        let capture = query_match.captures[*index];
+        result.push(RangeCapture {
+            node: capture.node,
+            index: capture.index,
+            pattern_index: query_match.pattern_index,
+        });
+    }
+    result
+}
+
+/// Run `query` over the bytes `range` of `node` only, e.g. the lines an
+/// editor shows.  Only captures of nodes that intersect the range are
+/// returned; nodes that only overlap it are captured whole.
+///
+/// `cursor` is left restricted to `range`; reuse it for the next call.
+pub fn captures_in_byte_range<'tree>(
+    cursor: &mut QueryCursor,
+    query: &Query,
+    node: Node<'tree>,
+    source: &[u8],
+    range: Range<usize>,
+) -> Vec<RangeCapture<'tree>> {
+    cursor.set_byte_range(range);
+    collect_captures(cursor, query, node, source)
+}
 
-// pub const HIGHLIGHTS_QUERY: &str = include_str!("../../queries/highlights.scm");
-// pub const INJECTIONS_QUERY: &str = include_str!("../../queries/injections.scm");
-// pub const LOCALS_QUERY: &str = include_str!("../../queries/locals.scm");
-// pub const TAGS_QUERY: &str = include_str!("../../queries/tags.scm");
+/// The same as [`captures_in_byte_range`] over rows and byte columns.  For a
+/// viewport of rows `first..=last`: `Point::new(first, 0)..Point::new(last + 1, 0)`.
+pub fn captures_in_point_range<'tree>(
+    cursor: &mut QueryCursor,
+    query: &Query,
+    node: Node<'tree>,
+    source: &[u8],
+    range: Range<Point>,
+) -> Vec<RangeCapture<'tree>> {
+    cursor.set_point_range(range);
+    collect_captures(cursor, query, node, source)
+}
+
+/// [`HIGHLIGHTS_QUERY`], compiled on first use and shared by every thread.
+pub fn highlights_query() -> &'static Query {
+    static QUERY: OnceLock<Query> = OnceLock::new();
+    QUERY.get_or_init(|| Query::new(&language(), HIGHLIGHTS_QUERY).unwrap())
+}
+
+/// [`INJECTIONS_QUERY`], compiled on first use and shared by every thread.
+pub fn injections_query() -> &'static Query {
+    static QUERY: OnceLock<Query> = OnceLock::new();
+    QUERY.get_or_init(|| Query::new(&language(), INJECTIONS_QUERY).unwrap())
+}
+
+/// How a member differs, see [`changed_members`].
+#[derive(Clone, Copy, Debug, PartialEq, Eq)]
+pub enum MemberChange {
+    Changed,
+    Added,
+    Removed,
+}
+
+/// A member of the class, see [`class_members`].
+#[derive(Clone, Debug, PartialEq, Eq)]
+pub struct ClassMember {
+    /// `method`, `classmethod`, `property`, `query`, `xdata`, `storage`, ...
+    pub kind: &'static str,
+    pub name: String,
+    /// Of the `class_statement`
+    pub range: tree_sitter::Range,
+}
+
+/// A class member reported by [`changed_members`].
+#[derive(Clone, Debug, PartialEq, Eq)]
+pub struct ChangedMember {
+    /// `method`, `classmethod`, `property`, `query`, `xdata`, `storage`, ...
+    pub kind: &'static str,
+    pub name: String,
+    pub change: MemberChange,
+    /// Of the `class_statement`, in the old source if removed
+    pub range: tree_sitter::Range,
+}
+
+fn class_body(tree: &Tree) -> Option<Node<'_>> {
+    let root = tree.root_node();
+    let mut cursor = root.walk();
+    let class = root
+        .named_children(&mut cursor)
+        .find(|child| child.kind() == "class_definition")?;
+    class.child_by_field_name("class_body")
+}
+
+fn intersects(node: Range<usize>, range: &Range<usize>) -> bool {
+    if node.start == node.end || range.start == range.end {
+        node.start <= range.end && range.start <= node.end
+    } else {
+        node.start < range.end && range.start < node.end
+    }
+}
+
+fn member_name(member: Node, source: &[u8]) -> String {
+    let mut cursor = member.walk();
+    let name = member.child_by_field_name("name").or_else(|| {
+        member
+            .named_children(&mut cursor)
+            .find(|child| child.kind() == "method_definition")
+            .and_then(|definition| definition.child_by_field_name("name"))
+    });
+    name.and_then(|name| name.utf8_text(source).ok()).unwrap_or_default().to_string()
+}
+
+fn class_member(statement: Node, source: &[u8]) -> Option<ClassMember> {
+    if statement.kind() != "class_statement" {
+        return None;
+    }
+    let member = statement.named_child(0)?;
+    Some(ClassMember {
+        kind: member.kind(),
+        name: member_name(member, source),
+        range: statement.range(),
+    })
+}
+
+// The members of `body` whose class_statement intersects any of `ranges`.
+// Each range costs a lookup, not a walk of the body.
+fn members_in_ranges(body: Node, source: &[u8], ranges: &[Range<usize>]) -> Vec<ClassMember> {
+    let mut members: Vec<ClassMember> = Vec::new();
+    let mut cursor = body.walk();
+    for range in ranges {
+        cursor.reset(body);
+        if cursor.goto_first_child_for_byte(range.start).is_none() {
+            // Past the last child
+            cursor.goto_first_child();
+            while cursor.goto_next_sibling() {}
+        }
+        // The member just before may end at the range, or have been emptied
+        let mut statement = cursor.node();
+        if let Some(previous) = statement.prev_sibling() {
+            statement = previous;
+        }
+        loop {
+            if statement.start_byte() > range.end {
+                break;
+            }
+            if intersects(statement.byte_range(), range)
+                && !members.iter().any(|member| member.range == statement.range())
+            {
+                members.extend(class_member(statement, source));
+            }
+            match statement.next_sibling() {
+                Some(next) => statement = next,
+                None => break,
+            }
+        }
+    }
+    members
+}
+
+// Where `Tree::edit` moves a node: text inserted where it starts goes
+// before it, and an end in the replaced text moves to the new text's end
+fn edited_range(range: Range<usize>, edit: &InputEdit) -> Range<usize> {
+    let moved = |offset: usize| {
+        if offset >= edit.old_end_byte {
+            offset + edit.new_end_byte - edit.old_end_byte
+        } else {
+            edit.new_end_byte
+        }
+    };
+    let start = if range.start < edit.start_byte { range.start } else { moved(range.start) };
+    let end = if range.end <= edit.start_byte { range.end } else { moved(range.end) };
+    start..end
+}
+
+/// Every member of the class in `tree`, in source order.  Take them before
+/// `Tree::edit` and pass them to [`changed_members`]: the edited tree's
+/// nodes no longer line up with `source`, so their names can't be read
+/// from it.
+pub fn class_members(tree: &Tree, source: &[u8]) -> Vec<ClassMember> {
+    let Some(body) = class_body(tree) else {
+        return Vec::new();
+    };
+    let mut cursor = body.walk();
+    body.children(&mut cursor).filter_map(|statement| class_member(statement, source)).collect()
+}
+
+/// The members of the class in `new_tree` that differ from `old_members`,
+/// which [`class_members`] took from `old_tree` before it was edited with
+/// `Tree::edit` and passed to `Parser::parse` to get `new_tree`.  A renamed
+/// member is removed under its old name and added under its new one.
+///
+/// `edits` are the edits given to `Tree::edit`, in order.  They map the old
+/// members onto the new tree, and [`Tree::changed_ranges`] only reports
+/// where the syntax differs, so an edit that keeps it (`set x = 1` to
+/// `set x = 2`) is only found through them.
+pub fn changed_members(
+    old_tree: &Tree,
+    old_members: &[ClassMember],
+    new_tree: &Tree,
+    new_source: &[u8],
+    edits: &[InputEdit],
+) -> Vec<ChangedMember> {
+    let mut ranges: Vec<Range<usize>> =
+        old_tree.changed_ranges(new_tree).map(|range| range.start_byte..range.end_byte).collect();
+    ranges.extend(edits.iter().map(|edit| edit.start_byte..edit.new_end_byte));
+    let Some(new_body) = class_body(new_tree) else {
+        return Vec::new();
+    };
+    if ranges.is_empty() {
+        return Vec::new();
+    }
+
+    // With where each old member is in the new tree, to sort the removed ones
+    let before: Vec<(usize, &ClassMember)> = old_members
+        .iter()
+        .filter_map(|member| {
+            let mut edited = member.range.start_byte..member.range.end_byte;
+            for edit in edits {
+                edited = edited_range(edited, edit);
+            }
+            let touched = ranges.iter().any(|range| intersects(edited.clone(), range));
+            touched.then_some((edited.start, member))
+        })
+        .collect();
+    let after = members_in_ranges(new_body, new_source, &ranges);
+    let before_keys: HashSet<(&str, &str)> =
+        before.iter().map(|(_, member)| (member.kind, member.name.as_str())).collect();
+    let after_keys: HashSet<(&str, &str)> =
+        after.iter().map(|member| (member.kind, member.name.as_str())).collect();
+    let mut changes: Vec<(usize, ChangedMember)> = Vec::new();
+    for member in &after {
+        let change = if before_keys.contains(&(member.kind, member.name.as_str())) {
+            MemberChange::Changed
+        } else {
+            MemberChange::Added
+        };
+        let ClassMember { kind, name, range } = member.clone();
+        changes.push((range.start_byte, ChangedMember { kind, name, change, range }));
+    }
+    for (at, member) in before {
+        if !after_keys.contains(&(member.kind, member.name.as_str())) {
+            let ClassMember { kind, name, range } = member.clone();
+            let change = MemberChange::Removed;
+            changes.push((at, ChangedMember { kind, name, change, range }));
+        }
+    }
+    changes.sort_by_key(|(at, _)| *at);
+    changes.into_iter().map(|(_, member)| member).collect()
+}
 
 #[cfg(test)]
 mod tests {
+    use std::sync::atomic::{AtomicUsize, Ordering};
+    use std::time::{Duration, Instant};
+
+    // Every case in test/pathological must finish or give up within its
+    // budget plus the time between two polls of the clock by the parser
+    const BUDGET: Duration = Duration::from_secs(2);
+    const SLACK: Duration = Duration::from_millis(500);
+
+    fn pathological_cases() -> Vec<(&'static str, Vec<u8>)> {
+        let unescape = |field: &str| {
+            field
+                .replace("\\\\", "\0")
+                .replace("\\n", "\n")
+                .replace("\\t", "\t")
+                .replace('\0', "\\")
+        };
+        include_str!("../../test/pathological/cases.tsv")
+            .lines()
+            .filter(|line| !line.is_empty() && !line.starts_with('#'))
+            .map(|line| {
+                let fields: Vec<&str> = line.split('\t').collect();
+                assert_eq!(fields.len(), 5, "bad case: {line:?}");
+                let count: usize = fields[1].parse().expect("bad count");
+                let source =
+                    unescape(fields[2]) + &unescape(fields[3]).repeat(count) + &unescape(fields[4]);
+                (fields[0], source.into_bytes())
+            })
+            .collect()
+    }
+
+    fn new_parser() -> tree_sitter::Parser {
+        let mut parser = tree_sitter::Parser::new();
+        parser.set_language(&super::language()).unwrap();
+        parser
+    }
+
     #[test]
     fn test_can_load_grammar() {
         let mut parser = tree_sitter::Parser::new();
@@ -51,4 +388,136 @@ mod tests {
             .set_language(&super::language())
             .expect("Error loading ObjectscriptUdl grammar");
     }
+
+    #[test]
+    fn test_can_compile_queries() {
+        for source in [super::HIGHLIGHTS_QUERY, super::INJECTIONS_QUERY, super::LOCALS_QUERY] {
+            tree_sitter::Query::new(&super::language(), source)
+                .expect("Error compiling ObjectscriptUdl query");
+        }
+    }
+
+    #[test]
+    fn test_captures_in_range_stay_in_range() {
+        let source = b"Class A.B\n{\n\nMethod M()\n{\n    set x = 1\n}\n\n\
+Method N()\n{\n    write \"n\"\n}\n\n}\n";
+        let tree = new_parser().parse(source, None).unwrap();
+        let root = tree.root_node();
+        let mut cursor = tree_sitter::QueryCursor::new();
+        let query = super::highlights_query();
+        let all = super::captures_in_byte_range(&mut cursor, query, root, source, 0..usize::MAX);
+        let range = 40..source.len();
+        let ranged = super::captures_in_byte_range(&mut cursor, query, root, source, range.clone());
+        assert!(!ranged.is_empty() && ranged.len() < all.len());
+        for capture in &ranged {
+            assert!(capture.node.end_byte() > range.start && capture.node.start_byte() < range.end);
+        }
+        let rows = tree_sitter::Point::new(10, 0)..tree_sitter::Point::new(13, 0);
+        for capture in super::captures_in_point_range(&mut cursor, query, root, source, rows) {
+            let (start, end) = (capture.node.start_position(), capture.node.end_position());
+            assert!(end.row >= 10 && start.row < 13);
+        }
+    }
+
+    const MEMBERS_SOURCE: &str = "Class A.B\n{\n\nMethod M()\n{\n    set x = 1\n}\n\n\
+Property P As %String;\n\nMethod N()\n{\n}\n\n}\n";
+
+    // Applies each (text to find, bytes to replace there, replacement) to
+    // MEMBERS_SOURCE and its tree in order, and lists the changed members
+    fn member_changes(edits: &[(&str, usize, &str)]) -> Vec<String> {
+        let point = |source: &str, at: usize| {
+            let before = &source[..at];
+            let column = at - before.rfind('\n').map_or(0, |newline| newline + 1);
+            tree_sitter::Point::new(before.matches('\n').count(), column)
+        };
+        let mut parser = new_parser();
+        let mut old_tree = parser.parse(MEMBERS_SOURCE, None).unwrap();
+        // Before the edits, which leave the old tree out of line with its source
+        let old_members = super::class_members(&old_tree, MEMBERS_SOURCE.as_bytes());
+
+        let mut source = MEMBERS_SOURCE.to_string();
+        let mut input_edits = Vec::new();
+        for (find, length, text) in edits {
+            let at = source.find(find).unwrap();
+            let (start_position, old_end_position) =
+                (point(&source, at), point(&source, at + length));
+            source.replace_range(at..at + length, text);
+            let edit = tree_sitter::InputEdit {
+                start_byte: at,
+                old_end_byte: at + length,
+                new_end_byte: at + text.len(),
+                start_position,
+                old_end_position,
+                new_end_position: point(&source, at + text.len()),
+            };
+            old_tree.edit(&edit);
+            input_edits.push(edit);
+        }
+        let new_tree = parser.parse(&source, Some(&old_tree)).unwrap();
+        super::changed_members(&old_tree, &old_members, &new_tree, source.as_bytes(), &input_edits)
+            .iter()
+            .map(|member| format!("{:?} {} {}", member.change, member.kind, member.name))
+            .collect()
+    }
+
+    #[test]
+    fn test_changed_members() {
+        // `set x = 1` to `set x = 2`, which keeps the syntax, and P to Q
+        assert_eq!(
+            member_changes(&[("1\n}", 1, "2"), ("P As", 1, "Q")]),
+            ["Changed method M", "Added property Q", "Removed property P"]
+        );
+    }
+
+    #[test]
+    fn test_changed_members_after_deleting_one() {
+        let changes = member_changes(&[("Property P", "Property P As %String;\n\n".len(), "")]);
+        let changes: Vec<&String> =
+            changes.iter().filter(|change| !change.starts_with("Changed")).collect();
+        assert_eq!(changes, ["Removed property P"]);
+    }
+
+    #[test]
+    fn test_changed_members_below_inserted_lines() {
+        // Every member after the insertion moves, and P changes its type
+        let changes = member_changes(&[
+            ("Property P", 0, "Parameter X = 1;\n\n"),
+            ("%String", "%String".len(), "%Integer"),
+        ]);
+        assert_eq!(changes, ["Added parameter X", "Changed property P"]);
+    }
+
+    #[test]
+    fn test_pathological_inputs_stay_within_budget() {
+        let mut parser = new_parser();
+        for (name, source) in pathological_cases() {
+            let start = Instant::now();
+            super::parse_with_budget(&mut parser, &source, Some(BUDGET), None);
+            let elapsed = start.elapsed();
+            assert!(elapsed <= BUDGET + SLACK, "{name} took {elapsed:?}");
+        }
+    }
+
+    #[test]
+    fn test_cancel_from_another_thread() {
+        let (name, source) = pathological_cases()
+            .into_iter()
+            .max_by_key(|(_, source)| source.len())
+            .unwrap();
+        let mut parser = new_parser();
+        let cancel = AtomicUsize::new(0);
+        std::thread::scope(|scope| {
+            scope.spawn(|| {
+                std::thread::sleep(Duration::from_millis(10));
+                cancel.store(1, Ordering::SeqCst);
+            });
+            let start = Instant::now();
+            super::parse_with_budget(&mut parser, &source, None, Some(&cancel));
+            let elapsed = start.elapsed();
+            assert!(elapsed <= SLACK, "{name} took {elapsed:?} to stop");
+        });
+
+        // The parser is usable again afterwards
+        assert!(super::parse_with_budget(&mut parser, b"", None, None).is_some());
+    }
 }
@@ -32,11 +32,20 @@ const kw_integer = function ($, keyword) {
   );
 };
 
+// The size optimized wasm profile (scripts/build-wasm.js --compact-keywords)
+// generates with OBJECTSCRIPT_COMPACT_KEYWORDS set, which accepts any word
+// for the long value tables (ClientDataType, OdbcType, SqlCategory) instead
+// of spelling out every value, saving lexer states.  The rhs is anonymous
+// either way, so valid classes parse to the same tree.
+const COMPACT_KEYWORDS = !!process.env.OBJECTSCRIPT_COMPACT_KEYWORDS;
+const COMPACT_MIN_VARIANTS = 10;
+
 const kw_enum = function ($, keyword, variants) {
+  const compact = COMPACT_KEYWORDS && variants.length >= COMPACT_MIN_VARIANTS;
   return seq(
     field('name', alias(keyword, $.keyword_name)),
     '=',
-    field('rhs', choice(...variants)),
+    field('rhs', compact ? /[A-Za-z0-9_]+/ : choice(...variants)),
   );
 };
 
@@ -48,6 +57,31 @@ const kw_expression = function ($, keyword) {
   );
 };
 
+// RFC 6838 restricted-name characters, less the facet and suffix separators
+const MIMETYPE_PART = /[A-Za-z0-9!#$&^_-]+/;
+
+const mimetype_fields = function ($, type) {
+  const part = alias(token.immediate(MIMETYPE_PART), $.mimetype_part);
+  return seq(
+    field('type', alias(type, $.mimetype_part)),
+    optional(
+      seq(
+        token.immediate('/'),
+        repeat(seq(field('facet', part), token.immediate('.'))),
+        field('subtype', part),
+        optional(seq(token.immediate('+'), field('suffix', part))),
+      ),
+    ),
+  );
+};
+
+const mimetype_parameters = function ($) {
+  return field(
+    'parameters',
+    alias(token.immediate(prec(-1, /[^"\r\n]+/)), $.mimetype_parameters),
+  );
+};
+
 const kw_text = function ($, keyword) {
   return seq(
     field('name', alias(keyword, $.keyword_name)),
@@ -114,7 +148,33 @@ module.exports = {
     ]),
   kw_Unique: ($) => kw_boolean($, /Unique/i),
   kw_Content: ($) => kw_text($, /Content/i),
-  kw_MimeType: ($) => kw_text($, /MimeType/i),
+  kw_MimeType: ($) =>
+    seq(
+      field('name', alias(/MimeType/i, $.keyword_name)),
+      '=',
+      field('rhs', $.mimetype),
+    ),
+  // Split into the parts injections.scm needs to pick a grammar for the
+  // XData body: application/vnd.api+json has the facet vnd, the subtype api
+  // and the suffix json.  Parameters, or anything else that does not read as
+  // a media type, end up in `parameters`, so no quoted value is an error.
+  mimetype: ($) =>
+    choice(
+      seq(
+        '"',
+        optional(
+          choice(
+            seq(
+              mimetype_fields($, token.immediate(MIMETYPE_PART)),
+              optional(mimetype_parameters($)),
+            ),
+            mimetype_parameters($),
+          ),
+        ),
+        token.immediate('"'),
+      ),
+      mimetype_fields($, MIMETYPE_PART),
+    ),
   kw_SchemaSpec: ($) => kw_text($, /SchemaSpec/i),
   kw_XMLNamespace: ($) => kw_text($, /XMLNamespace/i),
   kw_Name: ($) => kw_identifier($, /Name/i),
@@ -34,60 +34,32 @@
     (#set! injection.include-children "true")
 )
 
-; XDATA blocks.  There's a MimeType keyword that defines the content-type
-; but we need to individually match each one so that we can specify the
-; name of the tree-sitter grammar to inject.
+; XDATA blocks.  The MimeType keyword defines the content-type.  Its +suffix
+; names the syntax of structured types (image/svg+xml,
+; application/vnd.api+json), otherwise the subtype names it (text/markdown,
+; application/json); vnd. and other facets are separate nodes.  Only the
+; names of grammars we know are captured, everything else falls through to
+; xml below.
 (xdata
     keywords:
     (_
-        (kw_MimeType rhs: _ @_mimetype (#eq? @_mimetype "\"text/markdown\""))
+        (kw_MimeType rhs: (mimetype suffix: _ @injection.language))
     )
     body: (_) @injection.content
-    (#set! injection.language "markdown")
+    (#any-of? @injection.language "xml" "json" "yaml")
     (#set! injection.include-children "true")
 )
 
 (xdata
     keywords:
     (_
-        (kw_MimeType rhs: _ @_mimetype (#eq? @_mimetype "\"text/xml\""))
+        (kw_MimeType rhs: (mimetype !suffix subtype: _ @injection.language))
     )
     body: (_) @injection.content
-    (#set! injection.language "xml")
-    (#set! injection.include-children "true")
-)
-
-(xdata
-    keywords:
-    (_
-        (kw_MimeType rhs: _ @_mimetype (#eq? @_mimetype "\"text/html\""))
-    )
-    body: (_) @injection.content
-    (#set! injection.language "html")
-    (#set! injection.include-children "true")
-)
-
-(xdata
-    keywords:
-    (_
-        (kw_MimeType rhs: _ @_mimetype (#eq? @_mimetype "\"application/json\""))
-    )
-    body: (_) @injection.content
-    (#set! injection.language "json")
+    (#any-of? @injection.language "xml" "html" "css" "markdown" "json" "javascript" "yaml")
     (#set! injection.include-children "true")
 )
 
-(xdata
-    keywords:
-    (_
-        (kw_MimeType rhs: _ @_mimetype (#eq? @_mimetype "\"text/css\""))
-    )
-    body: (_) @injection.content
-    (#set! injection.language "css")
-    (#set! injection.include-children "true")
-)
-
-
 ; Match other less specific XDATAs
 (xdata
     body: (_) @injection.content
@@ -0,0 +1,110 @@
+; Generated by scripts/merge-queries.js from expr/queries/highlights.scm, core/queries/highlights.scm, udl/queries/highlights.scm, do not edit
+(gvn) @variable.special
+(ssvn) @variable.special
+(lvn) @variable
+(instance_variable) @variable.special
+(string_literal) @string
+(pattern_expression) @string.regex
+(_ operator: _ @operator)
+(integer_literal) @number
+(decimal_literal) @float
+(system_defined_variable) @function.builtin
+(system_defined_function) @function.builtin
+(dollarsf
+  (dollar_system_keyword) @function.builtin
+)
+(property_name) @property
+(parameter_name) @constant
+(parameter_name) @variable.parameter
+(class_method_call
+    (class_ref (class_name) @type.definition)
+    (method_name) @function.method.call
+)
+(oref_method (method_name) @function.method.call)
+(_ preproc_keyword: (_) @keyword.directive)
+(_ modifier: (_) @keyword.directive)
+(extrinsic_function) @function.call
+(_ label: (_) @label)
+(_ offset: (_) @number)
+(_ routine: (_) @namespace)
+(json_boolean_literal) @boolean
+(json_null_literal) @constant.builtin
+(json_number_literal) @number
+(json_string_literal) @string.escape
+(macro (macro_constant)) @constant.macro
+(macro (macro_function)) @function.macro
+(_ command_name: (_) @keyword)
+(_ macro_name: (_) @keyword.macro)
+(_ macro_arg: (_) @constant.macro)
+(_ mnemonic: (_) @constant.macro)
+(_ parameter: _ @variable.parameter)
+(doable_dollar_functions) @function.builtin
+(routine_tag_call) @function.call
+(instance_method_call) @function.method.call
+"{" @punctuation.bracket
+"}" @punctuation.bracket
+[
+  (line_comment_1)
+  (line_comment_2)
+  (line_comment_3)
+  (block_comment)
+] @comment
+(embedded_html
+  (keyword_embedded_html) @keyword.directive
+  "<" @keyword.directive
+  ">" @keyword.directive
+)
+(embedded_sql_amp
+  (keyword_embedded_sql_amp) @keyword.directive
+  "(" @keyword.directive
+  ")" @keyword.directive
+)
+(embedded_sql_hash
+  (keyword_embedded_sql_hash) @keyword.directive
+  "(" @keyword.directive
+  ")" @keyword.directive
+)
+(embedded_js
+  (keyword_embedded_js) @keyword.directive
+  "<" @keyword.directive
+  ">" @keyword.directive
+)
+(embedded_xml
+  (keyword_embedded_xml) @keyword.directive
+  "<" @keyword.directive
+  ">" @keyword.directive
+)
+(tag) @label
+(locktype) @type.qualifier
+(_ keyword: (_) @keyword)
+"{" @punctuation.bracket
+"}" @punctuation.bracket
+(include_clause (identifier) @keyword.import)
+(property (identifier) @property)
+(parameter (identifier) @constant)
+(projection (identifier) @type.definition)
+(trigger (identifier) @type.definition)
+(index (identifier) @type.definition)
+(relationship (identifier) @type.definition)
+(foreignkey (identifier) @type.definition)
+(xdata (identifier) @constant)
+(typename) @type
+(class_definition
+  class_name: (identifier) @type
+  (class_extends (identifier) @type))
+(method_definition (identifier (identifier)) @function)
+(query (identifier) @function)
+(argument (identifier) @variable.parameter)
+(keyword_name) @keyword
+(class_keywords (_ rhs: _ @constant.builtin))
+(parameter_keywords (_ rhs: _ @constant.builtin))
+(property_keywords (_ rhs: _ @constant.builtin))
+(xdata_keywords (_ rhs: _ @constant.builtin))
+(method_keywords (_ rhs: _ @constant.builtin))
+(trigger_keywords (_ rhs: _ @constant.builtin))
+(query_keywords (_ rhs: _ @constant.builtin))
+(index_keywords (_ rhs: _ @constant.builtin))
+(foreignkey_keywords (_ rhs: _ @constant.builtin))
+(projection_keywords (_ rhs: _ @constant.builtin))
+(relationship_keywords (_ rhs: _ @constant.builtin))
+(documatic_line) @comment.doc
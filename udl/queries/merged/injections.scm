@@ -0,0 +1,79 @@
+; Generated by scripts/merge-queries.js from expr/queries/injections.scm, core/queries/injections.scm, udl/queries/injections.scm, do not edit
+(embedded_html
+ (angled_bracket_fenced_text) @injection.content
+ (#set! injection.language "html")
+)
+(embedded_sql
+  (_
+    (paren_fenced_text) @injection.content
+  )
+ (#set! injection.language "sql")
+)
+(embedded_js
+ (angled_bracket_fenced_text) @injection.content
+ (#set! injection.language "javascript")
+)
+(embedded_xml
+ (angled_bracket_fenced_text) @injection.content
+ (#set! injection.language "xml")
+)
+([
+  (line_comment_1)
+  (line_comment_2)
+  (line_comment_3)
+  (block_comment)
+] @injection.content
+  (#set! injection.language "comment"))
+((documatic_line) @injection.content
+    (#set! injection.language "comment")
+)
+(method_definition
+	keywords:
+    (_
+    	(kw_External_Language rhs: _ @injection.language)
+    )
+    body: (_) @injection.content
+    (#set! injection.include-children "true")
+)
+(trigger
+	keywords:
+    (_
+    	(kw_External_Language rhs: _ @injection.language)
+    )
+    body: (_) @injection.content
+    (#set! injection.include-children "true")
+)
+(query
+	type: (_ (typename (identifier) @_querytype (#eq? @_querytype "%SQLQuery")))
+    (_ (query_body_content) @injection.content)
+    (#set! injection.language "sql")
+    (#set! injection.include-children "true")
+)
+(xdata
+    keywords:
+    (_
+        (kw_MimeType rhs: (mimetype suffix: _ @injection.language))
+    )
+    body: (_) @injection.content
+    (#any-of? @injection.language "xml" "json" "yaml")
+    (#set! injection.include-children "true")
+)
+(xdata
+    keywords:
+    (_
+        (kw_MimeType rhs: (mimetype !suffix subtype: _ @injection.language))
+    )
+    body: (_) @injection.content
+    (#any-of? @injection.language "xml" "html" "css" "markdown" "json" "javascript" "yaml")
+    (#set! injection.include-children "true")
+)
+(xdata
+    body: (_) @injection.content
+    (#set! injection.language "xml")
+    (#set! injection.include-children "true")
+)
+(storage
+    body: (_) @injection.content
+    (#set! injection.language "xml")
+    (#set! injection.include-children "true")
+)
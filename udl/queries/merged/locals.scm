@@ -0,0 +1 @@
+; Generated by scripts/merge-queries.js from expr/queries/locals.scm, core/queries/locals.scm, udl/queries/locals.scm, do not edit
@@ -1,5 +1,7 @@
 from os.path import isdir, join
 from platform import system
+from shlex import split
+from subprocess import CalledProcessError, check_output
 
 from setuptools import Extension, find_packages, setup
 from setuptools.command.build import build
@@ -22,12 +24,25 @@ class BdistWheel(bdist_wheel):
         return python, abi, platform
 
 
+def tree_sitter_flags():
+    """Compiler and linker flags of the tree-sitter runtime, from pkg-config"""
+    try:
+        cflags = check_output(["pkg-config", "--cflags", "tree-sitter"], text=True)
+        libs = check_output(["pkg-config", "--libs", "tree-sitter"], text=True)
+        return split(cflags), split(libs)
+    except (OSError, CalledProcessError):
+        return [], ["-ltree-sitter"] if system() != "Windows" else ["tree-sitter.lib"]
+
+
+ts_cflags, ts_libs = tree_sitter_flags()
+
+
 setup(
     packages=find_packages("bindings/python"),
     package_dir={"": "bindings/python"},
     package_data={
         "tree_sitter_objectscript_udl": ["*.pyi", "py.typed"],
-        "tree_sitter_objectscript_udl.queries": ["*.scm"],
+        "tree_sitter_objectscript_udl.queries": ["*.scm", "merged/*.scm"],
     },
     ext_package="tree_sitter_objectscript_udl",
     ext_modules=[
@@ -50,7 +65,35 @@ setup(
             ],
             include_dirs=["src"],
             py_limited_api=True,
-        )
+        ),
+        # parse_files()/parse_bytes_many(), which run the parser itself and so
+        # need the tree-sitter library.  Optional, the build carries on
+        # without it if the library isn't installed.
+        Extension(
+            name="_parallel",
+            sources=[
+                "bindings/python/tree_sitter_objectscript_udl/parallel.c",
+            ],
+            extra_compile_args=[
+                "-std=c11",
+                "-pthread",
+                *ts_cflags,
+            ] if system() != "Windows" else [
+                "/std:c11",
+                "/utf-8",
+                *ts_cflags,
+            ],
+            extra_link_args=[
+                "-pthread",
+                *ts_libs,
+            ] if system() != "Windows" else ts_libs,
+            define_macros=[
+                ("Py_LIMITED_API", "0x03080000"),
+                ("PY_SSIZE_T_CLEAN", None)
+            ],
+            py_limited_api=True,
+            optional=True,
+        ),
     ],
     cmdclass={
         "build": Build,
@@ -1,3 +1,6 @@
+// Ahead of the core scanner, so that its `#include "expr_scanner.h"` finds
+// this grammar's copy already included
+#include "expr_scanner.h"
 #include "../../core/src/scanner.h"
 #include "tree_sitter/parser.h"
 #include <stdlib.h>
@@ -94,9 +97,15 @@ unsigned tree_sitter_objectscript_udl_external_scanner_serialize(void *payload,
 
 void tree_sitter_objectscript_udl_external_scanner_deserialize(
     void *payload, const char *buffer, unsigned length) {
-  // This one is a bit funky.
+  struct ObjectScript_Udl_Scanner *scanner =
+      (struct ObjectScript_Udl_Scanner *)payload;
+  // An empty state is the start of a parse, see the core scanner
+  scanner->in_body = 0;
+  ObjectScript_Core_Scanner_init(&scanner->core_scanner);
   // length includes the sizeof(struct Scanner) and the structs it points to
-  memcpy(payload, buffer, length);
+  if (length == sizeof(struct ObjectScript_Udl_Scanner)) {
+    memcpy(scanner, buffer, length);
+  }
 }
 
 void tree_sitter_objectscript_udl_external_scanner_destroy(void *payload) {
@@ -0,0 +1,95 @@
+// A document read in chunks must parse the same as one string, wherever the
+// chunks split the tokens the external scanner reads ahead over
+// (`##continue`, `*/`, embedded SQL markers, fenced text, braces of
+// external method bodies).
+//
+//   npm run test:chunked
+
+const assert = require("node:assert");
+const fs = require("node:fs");
+const path = require("node:path");
+const { test } = require("node:test");
+
+const Parser = require("tree-sitter");
+const udl = require("..");
+const { chunkedInput, pieceTableInput } = udl;
+
+const source = fs.readFileSync(path.join(__dirname, "chunked", "boundaries.cls"), "utf8");
+
+const parser = new Parser();
+parser.setLanguage(udl);
+
+// Every node with its range, which a change of token boundary shows even
+// where the S-expression stays the same
+function describe(tree) {
+  const nodes = [];
+  const cursor = tree.walk();
+  for (;;) {
+    nodes.push(`${cursor.nodeType} ${cursor.startIndex}-${cursor.endIndex}`);
+    if (cursor.gotoFirstChild()) continue;
+    while (!cursor.gotoNextSibling()) {
+      if (!cursor.gotoParent()) return nodes.join("\n");
+    }
+  }
+}
+
+const expected = describe(parser.parse(source));
+
+test("the fixture parses without errors", () => {
+  assert.ok(!parser.parse(source).rootNode.hasError);
+});
+
+test("two chunks split at every position", () => {
+  for (let at = 0; at <= source.length; at++) {
+    const tree = parser.parse(chunkedInput([source.slice(0, at), source.slice(at)]));
+    assert.strictEqual(describe(tree), expected, `split at ${at}`);
+  }
+});
+
+test("one chunk per character", () => {
+  assert.strictEqual(describe(parser.parse(chunkedInput([...source]))), expected);
+});
+
+test("lines as chunks, with empty ones", () => {
+  const lines = source.split(/(?<=\n)/).flatMap((line) => [line, ""]);
+  assert.strictEqual(describe(parser.parse(chunkedInput(lines))), expected);
+});
+
+test("a piece table with an insertion at every marker", () => {
+  for (const marker of ["##continue", "*/", "&sqlAB", ")BA", "&js<", ">>", "[ Language"]) {
+    const at = source.indexOf(marker) + 1;
+    assert.ok(at > 0, marker);
+    // The original buffer lacks what was typed at `at`
+    const original = source.slice(0, at) + source.slice(at + marker.length - 1);
+    const added = source.slice(at, at + marker.length - 1);
+    const pieces = [
+      { buffer: 0, start: 0, length: at },
+      { buffer: 1, start: 0, length: added.length },
+      { buffer: 0, start: at, length: original.length - at },
+    ];
+    const tree = parser.parse(pieceTableInput([original, added], pieces));
+    assert.strictEqual(describe(tree), expected, marker);
+  }
+});
+
+test("an incremental reparse from chunks", () => {
+  const at = source.indexOf("$$$Twice(3)") + "$$$Twice(".length;
+  const edited = source.slice(0, at) + "42" + source.slice(at + 1);
+  const row = source.slice(0, at).split("\n").length - 1;
+  const column = at - (source.lastIndexOf("\n", at - 1) + 1);
+  const tree = parser.parse(source);
+  tree.edit({
+    startIndex: at,
+    oldEndIndex: at + 1,
+    newEndIndex: at + 2,
+    startPosition: { row, column },
+    oldEndPosition: { row, column: column + 1 },
+    newEndPosition: { row, column: column + 2 },
+  });
+  const middle = edited.indexOf("\n", at);
+  const chunks = [edited.slice(0, at), edited.slice(at, middle), edited.slice(middle)];
+  assert.strictEqual(
+    describe(parser.parse(chunkedInput(chunks), tree)),
+    describe(parser.parse(edited)),
+  );
+});
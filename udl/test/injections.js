@@ -0,0 +1,68 @@
+// The language injections.scm gives each XData body, taking the first
+// pattern that matches a node the way the tree-sitter highlighter does.
+//
+//   npm run test:injections
+
+const assert = require("node:assert");
+const { test } = require("node:test");
+
+const Parser = require("tree-sitter");
+const udl = require("..");
+
+const parser = new Parser();
+parser.setLanguage(udl);
+
+const xdata = (name, keywords) =>
+  `XData ${name}${keywords ? ` [ ${keywords} ]` : ""}\n{\n<x/>\n}\n\n`;
+
+// The injected language of the body of each XData block, by name
+function injectedLanguages(source) {
+  const tree = parser.parse(source);
+  assert.ok(!tree.rootNode.hasError, tree.rootNode.toString());
+  const chosen = new Map();
+  for (const match of udl.injectionsInRange(tree.rootNode, {
+    startIndex: 0,
+    endIndex: source.length,
+  })) {
+    const content = match.captures.find((c) => c.name === "injection.content");
+    if (!content || content.node.parent.type !== "xdata") continue;
+    const language =
+      match.captures.find((c) => c.name === "injection.language")?.node.text ??
+      match.setProperties?.["injection.language"];
+    const previous = chosen.get(content.node.id);
+    if (language && (!previous || match.pattern < previous.pattern)) {
+      chosen.set(content.node.id, { pattern: match.pattern, language, node: content.node });
+    }
+  }
+  const languages = {};
+  for (const { language, node } of chosen.values()) {
+    languages[node.parent.childForFieldName("name").text] = language;
+  }
+  return languages;
+}
+
+test("XData bodies are injected by MimeType", () => {
+  const source =
+    "Class Demo.XData\n{\n\n" +
+    xdata("Page", 'MimeType = "text/html"') +
+    xdata("Resource", 'MimeType = "application/fhir+json"') +
+    xdata("Api", 'MimeType = "application/vnd.api+json"') +
+    xdata("Config", 'MimeType = "application/json"') +
+    xdata("Charset", 'MimeType = "text/html; charset=utf-8"') +
+    xdata("Plain", 'MimeType = "text/plain"') +
+    xdata("Icon", 'MimeType = "image/svg+xml"') +
+    xdata("BPL", 'XMLNamespace = "http://www.intersystems.com/bpl"') +
+    xdata("Bare") +
+    "}\n";
+  assert.deepStrictEqual(injectedLanguages(source), {
+    Page: "html",
+    Resource: "json",
+    Api: "json",
+    Config: "json",
+    Charset: "html",
+    Plain: "xml",
+    Icon: "xml",
+    BPL: "xml",
+    Bare: "xml",
+  });
+});
@@ -0,0 +1,77 @@
+// Every case in test/pathological must finish or give up within its budget
+// (plus the time between two polls of the clock by the parser), and an
+// aborted parse must return promptly.
+//
+//   npm run test:pathological
+
+const assert = require("node:assert");
+const fs = require("node:fs");
+const path = require("node:path");
+const { test } = require("node:test");
+
+const { parseAsync, parseBatch } = require("..");
+
+const BUDGET_MS = 2000;
+const SLACK_MS = 500;
+
+function loadCases() {
+  const unescape = (field) =>
+    field.replace(/\\([\\nt])/g, (_, c) => ({ n: "\n", t: "\t" })[c] ?? c);
+  return fs
+    .readFileSync(path.join(__dirname, "pathological", "cases.tsv"), "utf8")
+    .split("\n")
+    .filter((line) => line && !line.startsWith("#"))
+    .map((line) => {
+      const fields = line.split("\t");
+      assert.strictEqual(fields.length, 5, `bad case: ${line}`);
+      const [name, count, prefix, repeat, suffix] = fields;
+      return {
+        name,
+        source:
+          unescape(prefix) + unescape(repeat).repeat(Number(count)) + unescape(suffix),
+      };
+    });
+}
+
+const cases = loadCases();
+
+for (const { name, source } of cases) {
+  test(`${name} stays within budget`, async () => {
+    const start = performance.now();
+    try {
+      await parseAsync(source, { sexp: false, timeoutMicros: BUDGET_MS * 1000 });
+    } catch (error) {
+      assert.strictEqual(error.code, "ETIMEDOUT");
+    }
+    const elapsed = performance.now() - start;
+    assert.ok(elapsed <= BUDGET_MS + SLACK_MS, `took ${elapsed.toFixed(0)} ms`);
+  });
+}
+
+test("parseBatch maps timeouts to null", async () => {
+  const results = await parseBatch(
+    cases.map((c) => c.source),
+    { sexp: false, timeoutMicros: BUDGET_MS * 1000 },
+  );
+  assert.strictEqual(results.length, cases.length);
+  for (const result of results) {
+    assert.ok(result === null || typeof result.rootType === "string");
+  }
+});
+
+test("an aborted parse returns promptly", async () => {
+  const largest = cases.reduce((a, b) => (b.source.length > a.source.length ? b : a));
+  const controller = new AbortController();
+  setTimeout(() => controller.abort(), 10);
+  const start = performance.now();
+  try {
+    await parseAsync(largest.source, { sexp: false, signal: controller.signal });
+  } catch (error) {
+    assert.strictEqual(error.name, "AbortError");
+  }
+  const elapsed = performance.now() - start;
+  assert.ok(elapsed <= SLACK_MS, `${largest.name} took ${elapsed.toFixed(0)} ms to stop`);
+
+  // Aborted before it starts
+  await assert.rejects(parseAsync("", { signal: controller.signal }), { code: "ABORT_ERR" });
+});
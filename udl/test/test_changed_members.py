@@ -0,0 +1,77 @@
+"""changed_members() names the class members an edit touched
+
+    pytest test/test_changed_members.py
+
+Including the members the edit moved, whose names must come from before
+the edit: a deleted member, and members below inserted lines.
+"""
+
+import pytest
+from tree_sitter import Language, Parser
+
+import tree_sitter_objectscript_udl as udl
+
+SOURCE = (
+    b"Class A.B\n{\n\nMethod M()\n{\n    set x = 1\n}\n\n"
+    b"Property P As %String;\n\nMethod N()\n{\n}\n\n}\n"
+)
+
+
+@pytest.fixture(scope="module")
+def parser():
+    return Parser(Language(udl.language()))
+
+
+def point(source, at):
+    return (source.count(b"\n", 0, at), at - (source.rfind(b"\n", 0, at) + 1))
+
+
+def member_changes(parser, edits):
+    """Applies each (text to find, bytes to replace there, replacement) to
+    SOURCE and its tree in order, and lists the changed members"""
+    old_tree = parser.parse(SOURCE)
+    # Before the edits, which leave the old tree out of line with its source
+    old_members = udl.class_members(old_tree)
+
+    source = SOURCE
+    applied = []
+    for find, length, text in edits:
+        at = source.index(find)
+        start_point, old_end_point = point(source, at), point(source, at + length)
+        source = source[:at] + text + source[at + length :]
+        old_tree.edit(
+            start_byte=at,
+            old_end_byte=at + length,
+            new_end_byte=at + len(text),
+            start_point=start_point,
+            old_end_point=old_end_point,
+            new_end_point=point(source, at + len(text)),
+        )
+        applied.append((at, at + length, at + len(text)))
+    new_tree = parser.parse(source, old_tree)
+    return [
+        f"{member.change} {member.kind} {member.name}"
+        for member in udl.changed_members(old_tree, new_tree, old_members, applied)
+    ]
+
+
+def test_edits_and_a_rename(parser):
+    # `set x = 1` to `set x = 2`, which keeps the syntax, and P to Q
+    changes = member_changes(parser, [(b"1\n}", 1, b"2"), (b"P As", 1, b"Q")])
+    assert changes == ["changed method M", "added property Q", "removed property P"]
+
+
+def test_deleted_member(parser):
+    changes = member_changes(parser, [(b"Property P", len(b"Property P As %String;\n\n"), b"")])
+    assert [change for change in changes if not change.startswith("changed")] == [
+        "removed property P"
+    ]
+
+
+def test_members_below_inserted_lines(parser):
+    # Every member after the insertion moves, and P changes its type
+    changes = member_changes(
+        parser,
+        [(b"Property P", 0, b"Parameter X = 1;\n\n"), (b"%String", len(b"%String"), b"%Integer")],
+    )
+    assert changes == ["added parameter X", "changed property P"]
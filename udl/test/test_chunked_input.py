@@ -0,0 +1,94 @@
+"""A document read in chunks must parse the same as one string
+
+    pytest test/test_chunked_input.py
+
+Wherever the chunks split the tokens the external scanner reads ahead over:
+``##continue``, ``*/``, embedded SQL markers, fenced text and the braces of
+external method bodies, and in the middle of a UTF-8 sequence.
+"""
+
+from pathlib import Path
+
+import pytest
+from tree_sitter import Language, Parser
+
+import tree_sitter_objectscript_udl as udl
+
+SOURCE = (Path(__file__).parent / "chunked" / "boundaries.cls").read_bytes()
+
+
+@pytest.fixture(scope="module")
+def parser():
+    return Parser(Language(udl.language()))
+
+
+def describe(tree):
+    """Every node with its range, which a change of token boundary shows
+    even where the S-expression stays the same"""
+    nodes = []
+    cursor = tree.walk()
+    while True:
+        nodes.append((cursor.node.type, cursor.node.start_byte, cursor.node.end_byte))
+        if cursor.goto_first_child():
+            continue
+        while not cursor.goto_next_sibling():
+            if not cursor.goto_parent():
+                return nodes
+
+
+@pytest.fixture(scope="module")
+def expected(parser):
+    tree = parser.parse(SOURCE)
+    assert not tree.root_node.has_error
+    return describe(tree)
+
+
+def test_two_chunks_split_at_every_byte(parser, expected):
+    for at in range(len(SOURCE) + 1):
+        tree = parser.parse(udl.chunked_input([SOURCE[:at], SOURCE[at:]]))
+        assert describe(tree) == expected, f"split at {at}"
+
+
+def test_one_chunk_per_byte(parser, expected):
+    chunks = [SOURCE[at : at + 1] for at in range(len(SOURCE))]
+    assert describe(parser.parse(udl.chunked_input(chunks))) == expected
+
+
+def test_lines_as_chunks_with_empty_ones(parser, expected):
+    chunks = []
+    for line in SOURCE.splitlines(keepends=True):
+        chunks += [bytearray(line), b""]
+    assert describe(parser.parse(udl.chunked_input(chunks))) == expected
+
+
+@pytest.mark.parametrize(
+    "marker", [b"##continue", b"*/", b"&sqlAB", b")BA", b"&js<", b">>", b"[ Language"]
+)
+def test_piece_table_insertion(parser, expected, marker):
+    at = SOURCE.index(marker) + 1
+    # The original buffer lacks what was typed at `at`
+    original = SOURCE[:at] + SOURCE[at + len(marker) - 1 :]
+    added = memoryview(SOURCE[at : at + len(marker) - 1])
+    pieces = [(0, 0, at), (1, 0, len(added)), (0, at, len(original) - at)]
+    tree = parser.parse(udl.piece_table_input([original, added], pieces))
+    assert describe(tree) == expected
+
+
+def test_incremental_reparse(parser):
+    at = SOURCE.index(b"$$$Twice(3)") + len(b"$$$Twice(")
+    edited = SOURCE[:at] + b"42" + SOURCE[at + 1 :]
+    row = SOURCE.count(b"\n", 0, at)
+    column = at - (SOURCE.rfind(b"\n", 0, at) + 1)
+    tree = parser.parse(SOURCE)
+    tree.edit(
+        start_byte=at,
+        old_end_byte=at + 1,
+        new_end_byte=at + 2,
+        start_point=(row, column),
+        old_end_point=(row, column + 1),
+        new_end_point=(row, column + 2),
+    )
+    middle = edited.index(b"\n", at)
+    chunks = [edited[:at], edited[at:middle], edited[middle:]]
+    new_tree = parser.parse(udl.chunked_input(chunks), tree)
+    assert describe(new_tree) == describe(parser.parse(edited))